@@ -132,6 +132,31 @@ extern "C" {
 #define AIPL_CONVERT_UYVY           TO_ARGB8888
 #define AIPL_CONVERT_RGB888P        (TO_RGB888 | TO_RGB565)
 
+/**
+ * Generic color conversion engine
+ *
+ * Options:
+ *  0 - only the conversions enabled above are available
+ *  1 - conversions not enabled above are done by the generic
+ *      engine that unpacks any format into an intermediate
+ *      block and packs it into any other format
+ *
+ * Disabled conversions are reached through aipl_color_convert(),
+ * their per pair functions are not built. With every conversion
+ * disabled above the engine takes about an eighth of the code size
+ * of all dedicated converters, at a fraction of their speed
+ */
+#define AIPL_CONVERT_GENERIC        1
+
+/**
+ * Number of significant bits of the Y16 samples, stored in the
+ * low bits of the 16-bit words. Used when Y16 is converted to and
+ * from other formats without an explicit shift
+ *
+ * Options: 10, 12 or 16
+ */
+#define AIPL_Y16_BITS               16
+
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
@@ -32,10 +32,19 @@ extern "C" {
 /*********************
  *      DEFINES
  *********************/
+/* Maximum number of outputs of a multi-output conversion */
+#define AIPL_CONVERT_MULTI_MAX 4
 
 /**********************
  *      TYPEDEFS
  **********************/
+/**
+ * Output buffer of a multi-output conversion
+ */
+typedef struct {
+    void* data;                     /**< Output image pointer */
+    aipl_color_format_t format;     /**< Output image format */
+} aipl_color_output_t;
 
 /**********************
  * GLOBAL PROTOTYPES
@@ -68,6 +77,210 @@ aipl_error_t aipl_color_convert(const void* input, void* output,
 aipl_error_t aipl_color_convert_img(const aipl_image_t* input,
                                     aipl_image_t* output);
 
+#if AIPL_CONVERT_GENERIC
+/**
+ * Convert image color format with the generic conversion engine
+ *
+ * Any pair of supported formats is converted through an intermediate
+ * ARGB8888 or YUV444 block, so no dedicated converter is required.
+ * aipl_color_convert() falls back to it for the pairs
+ * not enabled by the AIPL_CONVERT_<FORMAT> settings
+ *
+ * @param input         input image pointer
+ * @param output        output image pointer
+ * @param pitch         input image pitch
+ * @param width         image width
+ * @param height        image height
+ * @param input_format  input image format
+ * @param output_format output image format
+ * @return error code
+ */
+aipl_error_t aipl_color_convert_generic(const void* input, void* output,
+                                        uint32_t pitch,
+                                        uint32_t width, uint32_t height,
+                                        aipl_color_format_t input_format,
+                                        aipl_color_format_t output_format);
+#endif
+
+/**
+ * Convert image color format with selectable YUV colorimetry
+ *
+ * BT.601 limited range is the colorimetry of aipl_color_convert().
+ * Other colorimetries select a precomputed fixed-point coefficient
+ * set once per call for the RGB <-> YUV pairs. ARGB8888 to YUV is
+ * Helium accelerated, the other RGB <-> YUV pairs are converted by
+ * the generic engine and return AIPL_ERR_NOT_SUPPORTED when it is
+ * disabled (AIPL_CONVERT_GENERIC)
+ *
+ * @param input         input image pointer
+ * @param output        output image pointer
+ * @param pitch         input image pitch
+ * @param width         image width
+ * @param height        image height
+ * @param input_format  input image format
+ * @param output_format output image format
+ * @param colorimetry   YUV colorimetry
+ * @return error code
+ */
+aipl_error_t aipl_color_convert_colorimetry(const void* input, void* output,
+                                            uint32_t pitch,
+                                            uint32_t width, uint32_t height,
+                                            aipl_color_format_t input_format,
+                                            aipl_color_format_t output_format,
+                                            aipl_colorimetry_t colorimetry);
+
+/**
+ * Convert image color format with selectable YUV colorimetry
+ * using aipl_image_t interface
+ *
+ * @param input         input image
+ * @param output        output image
+ * @param colorimetry   YUV colorimetry
+ * @return error code
+ */
+aipl_error_t aipl_color_convert_colorimetry_img(const aipl_image_t* input,
+                                                aipl_image_t* output,
+                                                aipl_colorimetry_t colorimetry);
+
+/**
+ * Convert an image into several color formats at once
+ * using raw pointer interface
+ *
+ * When every output has a dedicated converter enabled in the
+ * configuration the outputs are converted one after another by
+ * aipl_color_convert(), so accelerated converters are used. Otherwise
+ * the generic engine reads and decodes every block of the input once
+ * and packs it into all of the outputs, so the input bandwidth and
+ * the YUV <-> RGB conversion are shared between them
+ *
+ * @param input         input image pointer
+ * @param pitch         input image pitch
+ * @param width         image width
+ * @param height        image height
+ * @param input_format  input image format
+ * @param outputs       output buffers and formats
+ * @param output_num    number of outputs, up to AIPL_CONVERT_MULTI_MAX
+ * @return error code
+ */
+aipl_error_t aipl_color_convert_multi(const void* input,
+                                      uint32_t pitch,
+                                      uint32_t width, uint32_t height,
+                                      aipl_color_format_t input_format,
+                                      const aipl_color_output_t* outputs,
+                                      uint32_t output_num);
+
+/**
+ * Convert an image into several color formats at once
+ * using aipl_image_t interface
+ *
+ * @param input         input image
+ * @param outputs       output images
+ * @param output_num    number of outputs, up to AIPL_CONVERT_MULTI_MAX
+ * @return error code
+ */
+aipl_error_t aipl_color_convert_multi_img(const aipl_image_t* input,
+                                          aipl_image_t* outputs,
+                                          uint32_t output_num);
+
+/**
+ * Copy an image without changing its color format
+ * using raw pointer interface
+ *
+ * Every plane of the image is repacked from the input pitch
+ * to the image width, in a single copy when the pitch matches the width
+ *
+ * @param input         input image pointer
+ * @param output        output image pointer
+ * @param pitch         input image pitch
+ * @param width         image width
+ * @param height        image height
+ * @param format        image format
+ * @return error code
+ */
+aipl_error_t aipl_color_copy(const void* input, void* output,
+                             uint32_t pitch,
+                             uint32_t width, uint32_t height,
+                             aipl_color_format_t format);
+
+/**
+ * Copy an image without changing its color format
+ * using aipl_image_t interface
+ *
+ * @param input         input image
+ * @param output        output image
+ * @return error code
+ */
+aipl_error_t aipl_color_copy_img(const aipl_image_t* input,
+                                 aipl_image_t* output);
+
+/**
+ * Convert Y16 image to I400 by shifting the samples right
+ *
+ * Samples exceeding 8 bits after the shift are saturated,
+ * e.g. shift 8 keeps the upper byte of full range samples,
+ * shift 2 maps 10-bit samples and shift 0 clips to the lowest 255 levels
+ *
+ * @param input         input image pointer
+ * @param output        output image pointer
+ * @param pitch         input image pitch
+ * @param width         image width
+ * @param height        image height
+ * @param shift         right shift of the samples, up to 15
+ * @return error code
+ */
+aipl_error_t aipl_color_convert_y16_to_i400(const void* input,
+                                            void* output,
+                                            uint32_t pitch,
+                                            uint32_t width,
+                                            uint32_t height,
+                                            uint8_t shift);
+
+/**
+ * Convert Y16 image to I400 through a lookup table
+ *
+ * Every sample is shifted right and used as a table index,
+ * so the table can apply any window, level or gamma curve
+ * to depth or thermal data
+ *
+ * @param input         input image pointer
+ * @param output        output image pointer
+ * @param pitch         input image pitch
+ * @param width         image width
+ * @param height        image height
+ * @param lut           lookup table of (0xffff >> shift) + 1 entries
+ * @param shift         right shift of the samples before the lookup,
+ *                      up to 15
+ * @return error code
+ */
+aipl_error_t aipl_color_convert_y16_lut(const void* input,
+                                        void* output,
+                                        uint32_t pitch,
+                                        uint32_t width,
+                                        uint32_t height,
+                                        const uint8_t* lut,
+                                        uint8_t shift);
+
+/**
+ * Convert I400 image to Y16 by shifting the samples left
+ *
+ * The vacated low bits repeat the top bits of the sample, so shift 8
+ * maps 255 to 0xffff and shift 2 maps 255 to the 10-bit maximum 0x3ff
+ *
+ * @param input         input image pointer
+ * @param output        output image pointer
+ * @param pitch         input image pitch
+ * @param width         image width
+ * @param height        image height
+ * @param shift         left shift of the samples, up to 8
+ * @return error code
+ */
+aipl_error_t aipl_color_convert_i400_to_y16(const void* input,
+                                            void* output,
+                                            uint32_t pitch,
+                                            uint32_t width,
+                                            uint32_t height,
+                                            uint8_t shift);
+
 #if AIPL_CONVERT_ALPHA8_I400
 /**
  * Convert ALPHA8 image to specified format
@@ -2397,7 +2610,8 @@ aipl_error_t aipl_color_convert_bgr888_to_argb8888(const void* input,
                                                    uint32_t height);
 
 #endif
-#if (AIPL_CONVERT_BGR888 & TO_ARGB4444)/**
+#if (AIPL_CONVERT_BGR888 & TO_ARGB4444)
+/**
  * Convert BGR888 image to ARGB4444
  *
  * @param input         input image pointer
@@ -2722,7 +2936,8 @@ aipl_error_t aipl_color_convert_rgb888_to_argb8888(const void* input,
                                                    uint32_t height);
 
 #endif
-#if (AIPL_CONVERT_RGB888 & TO_ARGB4444)/**
+#if (AIPL_CONVERT_RGB888 & TO_ARGB4444)
+/**
  * Convert RGB888 image to ARGB4444
  *
  * @param input         input image pointer
@@ -30,6 +30,9 @@ extern "C" {
 /*********************
  *      DEFINES
  *********************/
+/* Side of the square pixel tiles of AIPL_COLOR_TILED images */
+#define AIPL_TILE_SIZE                      (8)
+
 #define AIPL_YUV_Y_8BIT_RED_MULTIPLIER      (66)
 #define AIPL_YUV_Y_8BIT_GREEN_MULTIPLIER    (129)
 #define AIPL_YUV_Y_8BIT_BLUE_MULTIPLIER     (25)
@@ -113,19 +116,77 @@ typedef enum {
     AIPL_COLOR_YUY2,
     AIPL_COLOR_UYVY,
 
+    /* Formats added later are appended to keep the values above
+       stable, so the value order does not follow the groups */
+    AIPL_COLOR_BGRA8888,
+    AIPL_COLOR_ABGR8888,
+    AIPL_COLOR_XRGB8888,    /* ARGB8888 with the alpha byte ignored */
+    AIPL_COLOR_PARGB8888,   /* ARGB8888 with premultiplied alpha */
+    AIPL_COLOR_PRGBA8888,   /* RGBA8888 with premultiplied alpha */
+    AIPL_COLOR_PARGB4444,   /* ARGB4444 with premultiplied alpha */
+    AIPL_COLOR_Y16,         /* 16-bit luma, also 10 or 12-bit samples
+                               stored in the low bits of 16-bit words */
+    AIPL_COLOR_NV16,        /* NV12 with full height chroma */
+    AIPL_COLOR_NV61,        /* NV21 with full height chroma */
+
+    /* Number of color formats */
+    AIPL_COLOR_NUM,
+
     /* Other format flags */
     AIPL_COLOR_RLE = 0x80000000,
+    AIPL_COLOR_TILED = 0x40000000,      /* AIPL_TILE_SIZE square tiles stored
+                                           contiguously in row-major tile order,
+                                           rows of tiles cover the image width */
 
     /* Unknown color value */
     AIPL_COLOR_UNKNOWN = 0xffffffff
 } aipl_color_format_t;
 
+/**
+ * YUV colorimetry: matrix coefficients and quantization range
+ */
+typedef enum {
+    AIPL_COLORIMETRY_BT601_LIMITED,     /**< BT.601, Y in [16, 235] (default) */
+    AIPL_COLORIMETRY_BT601_FULL,        /**< BT.601, Y in [0, 255] */
+    AIPL_COLORIMETRY_BT709_LIMITED,     /**< BT.709, Y in [16, 235] */
+    AIPL_COLORIMETRY_BT709_FULL,        /**< BT.709, Y in [0, 255] */
+    AIPL_COLORIMETRY_NUM
+} aipl_colorimetry_t;
+
+/**
+ * Fixed-point RGB <-> YUV coefficients of a colorimetry,
+ * all multipliers are in 1/256 units
+ */
+typedef struct {
+    /* RGB to YUV */
+    int16_t y_red;
+    int16_t y_green;
+    int16_t y_blue;
+    int16_t u_red;
+    int16_t u_green;
+    int16_t u_blue;
+    int16_t v_red;
+    int16_t v_green;
+    int16_t v_blue;
+    uint8_t y_offset;
+
+    /* YUV to RGB */
+    int16_t c;
+    int16_t red_e;
+    int16_t green_d;
+    int16_t green_e;
+    int16_t blue_d;
+} aipl_yuv_coefs_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 /**
  * Get the color format space
  *
+ * Formats with the AIPL_COLOR_TILED or AIPL_COLOR_RLE flag
+ * have no color space, so operations on linear images reject them
+ *
  * @param format color format
  * @return color format space
  */
@@ -134,6 +195,9 @@ aipl_color_space_t aipl_color_format_space(aipl_color_format_t format);
 /**
  * Get the color format depth in bits
  *
+ * Formats with the AIPL_COLOR_TILED or AIPL_COLOR_RLE flag have no depth,
+ * mask the flag to get the pixel depth
+ *
  * @param format color format
  * @return color format depth
  */
@@ -147,6 +211,23 @@ uint8_t aipl_color_format_depth(aipl_color_format_t format);
  */
 const char* aipl_color_format_str(aipl_color_format_t format);
 
+/**
+ * Get the premultiplied alpha variant of a straight alpha color format
+ *
+ * @param format straight alpha color format
+ * @return premultiplied alpha color format or AIPL_COLOR_UNKNOWN
+ *         if the format has no premultiplied variant
+ */
+aipl_color_format_t aipl_color_format_premultiplied(aipl_color_format_t format);
+
+/**
+ * Get the fixed-point coefficients of a YUV colorimetry
+ *
+ * @param colorimetry YUV colorimetry
+ * @return static coefficient set or NULL if colorimetry is unknown
+ */
+const aipl_yuv_coefs_t* aipl_colorimetry_coefs(aipl_colorimetry_t colorimetry);
+
 /**********************
  *      MACROS
  **********************/
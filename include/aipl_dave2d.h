@@ -130,8 +130,8 @@ d2_u32 aipl_dave2d_color_mode_convert(const void* input, void* output,
  * @param x             x
  * @param y             y
  * @param rotation      rotation
- * @param flip_u        flip horizontally
- * @param flip_v        flip vertically
+ * @param flip_u        flip input horizontally before rotation
+ * @param flip_v        flip input vertically before rotation
  * @param scale         enable scaling
  * @param interpolate   apply bilinear filter
  * @return D/AVE2D driver error code (see dave_errorcodes.h)
@@ -145,6 +145,34 @@ d2_u32 aipl_dave2d_texturing(const void* input, void* output,
                              int32_t rotation,
                              bool flip_u, bool flip_v,
                              bool scale, bool interpolate);
+
+/**
+ * Map input image as texture onto the output image with an affine
+ * transform using D/AVE2D. Output pixels outside of the mapped
+ * input image are cleared to zero
+ *
+ * @param input         input image pointer
+ * @param output        output image pointer
+ * @param pitch         input image pitch
+ * @param width         input image width
+ * @param height        input image height
+ * @param format        input image format
+ * @param output_width  output image width
+ * @param output_height output image height
+ * @param matrix        2x3 row-major matrix mapping output pixel
+ *                      coordinates to input pixel coordinates
+ * @param interpolate   apply bilinear filter
+ * @return D/AVE2D driver error code (see dave_errorcodes.h)
+ */
+d2_u32 aipl_dave2d_affine_texturing(const void* input, void* output,
+                                    uint32_t pitch,
+                                    uint32_t width, uint32_t height,
+                                    d2_u32 format,
+                                    uint32_t output_width,
+                                    uint32_t output_height,
+                                    const float matrix[6],
+                                    bool interpolate);
+
 /**
  * Convert D/AVE2D driver error code to AIPL error code
  * Save the last converted original D/AVE2D driver error code
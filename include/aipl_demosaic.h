@@ -12,6 +12,10 @@
  * @file    aipl_demosaic.h
  * @brief   Bayer pattern demosaicing function definitions
  *
+ * The demosaicing variants below write the output formats of
+ * aipl_demosaic() directly. Any other output format goes through
+ * the generic conversion engine and needs AIPL_CONVERT_GENERIC
+ *
 ******************************************************************************/
 
 #ifndef AIPL_DEMOSAICING_H
@@ -28,6 +32,12 @@ extern "C" {
 #include "aipl_error.h"
 #include "aipl_image.h"
 
+/*********************
+ *      DEFINES
+ *********************/
+/* Fractional bits of the lens shading gains */
+#define AIPL_RAW_GAIN_BITS 12
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -48,9 +58,89 @@ typedef struct {
     const uint8_t* blue_src;
 } aipl_bayer_tile_t;
 
-/*********************
- *      DEFINES
- *********************/
+/**
+ * Raw image sample packing
+ */
+typedef enum {
+    AIPL_RAW8,          /**< One byte per sample */
+    AIPL_RAW10,         /**< MIPI CSI-2 RAW10, 4 samples in 5 bytes */
+    AIPL_RAW12,         /**< MIPI CSI-2 RAW12, 2 samples in 3 bytes */
+    AIPL_RAW_FORMAT_NUM,
+} aipl_raw_format_t;
+
+/**
+ * Demosaicing interpolation mode
+ */
+typedef enum {
+    AIPL_DEMOSAIC_QUAD,         /**< Each 2x2 quad from its own samples */
+    AIPL_DEMOSAIC_BILINEAR,     /**< 3x3 bilinear interpolation */
+    AIPL_DEMOSAIC_MHC,          /**< 5x5 Malvar-He-Cutler gradient-corrected
+                                     interpolation */
+    AIPL_DEMOSAIC_MODE_NUM,
+} aipl_demosaic_mode_t;
+
+/**
+ * Demosaicing scaling weights
+ */
+typedef enum {
+    AIPL_DEMOSAIC_SCALE_BILINEAR,   /**< Bilinear weights on quad centers */
+    AIPL_DEMOSAIC_SCALE_AREA,       /**< Average of the quads covered
+                                         by an output pixel */
+    AIPL_DEMOSAIC_SCALE_NUM,
+} aipl_demosaic_scale_t;
+
+/**
+ * Raw sample correction applied while demosaicing
+ *
+ * Channels 0 to 3 are the positions of the 2x2 quad at the image
+ * origin in raster order, whatever the bayer filter. A sample s of
+ * channel c becomes (s - black_level[c]) * gain, saturated to 8 bits.
+ * The gain is bilinearly interpolated from a grid of points spread
+ * evenly from the first to the last image sample, with four channel
+ * gains per point. Any scaling of the range left by the black level
+ * is expected to be folded into the gains. Constant channel gains
+ * multiply the grid gain
+ */
+typedef struct {
+    uint8_t black_level[4];     /**< Black level of each channel */
+    const uint16_t* gains;      /**< Gain grid in AIPL_RAW_GAIN_BITS fixed
+                                     point, row by row, or NULL for none */
+    uint16_t grid_width;        /**< Gain grid points per row, at least 2 */
+    uint16_t grid_height;       /**< Gain grid rows, at least 2 */
+    const uint16_t* channel_gains;  /**< White balance and digital gain of
+                                         each channel in AIPL_RAW_GAIN_BITS
+                                         fixed point, or NULL for none */
+    bool clip_highlights;       /**< Clip the samples to the level where the
+                                     channel with the smallest channel gain
+                                     saturates, keeping highlights neutral */
+} aipl_raw_correction_t;
+
+/**
+ * Statistics of one demosaicing grid cell
+ */
+typedef struct {
+    uint32_t sum_r;             /**< Sum of red values */
+    uint32_t sum_g;             /**< Sum of green values */
+    uint32_t sum_b;             /**< Sum of blue values */
+    uint32_t count;             /**< Number of pixels */
+    uint32_t sharpness;         /**< Sum of absolute horizontal
+                                     luma differences */
+} aipl_stats_cell_t;
+
+/**
+ * Demosaicing statistics for auto exposure, white balance and focus
+ *
+ * The grid cells split the image evenly and are stored row by row.
+ * Luma is computed as (77 * R + 150 * G + 29 * B + 128) >> 8.
+ * The caller provides the cell and histogram storage
+ */
+typedef struct {
+    uint16_t grid_width;        /**< Grid cells per row */
+    uint16_t grid_height;       /**< Grid rows */
+    uint16_t histogram_bins;    /**< Luma histogram bins, 64 or 256 */
+    aipl_stats_cell_t* cells;   /**< grid_width * grid_height cells */
+    uint32_t* histogram;        /**< histogram_bins counters */
+} aipl_demosaic_stats_t;
 
 /**********************
  * GLOBAL PROTOTYPES
@@ -76,9 +166,24 @@ aipl_bayer_tile_t aipl_bayer_tile(const void* input,
  */
 aipl_bayer_filter_t aipl_bayer_filter_swap_rb(aipl_bayer_filter_t filter);
 
+/**
+ * Get bayer filter of an image part starting at an offset
+ *
+ * @param filter input bayer filter
+ * @param x      horizontal offset
+ * @param y      vertical offset
+ * @return bayer filter at the offset
+ */
+aipl_bayer_filter_t aipl_bayer_filter_offset(aipl_bayer_filter_t filter,
+                                             uint32_t x, uint32_t y);
+
 /**
  * Perform demosaicing on an 8-bit raw image buffer
  *
+ * The last column is interpolated with the samples following the
+ * raw rows, so one sample past the width of each row must be
+ * readable. The last row repeats the one above it
+ *
  * @param input             input raw image pointer
  * @param output            output RGB image pointer
  * @param pitch             input raw image pitch
@@ -263,6 +368,52 @@ aipl_error_t aipl_demosaic_bgr888(const void* input, void* output,
                                   uint32_t width, uint32_t height,
                                   aipl_bayer_filter_t filter);
 
+/**
+ * Perform demosaicing on an 8-bit raw image buffer
+ * into RGB888P (planar) image
+ *
+ * @param input             input raw image pointer
+ * @param output            output RGB888P image pointer
+ * @param pitch             input raw image pitch
+ * @param width             image width
+ * @param height            image height
+ * @param filter            bayer filter
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_rgb888p(const void* input, void* output,
+                                   uint32_t pitch,
+                                   uint32_t width, uint32_t height,
+                                   aipl_bayer_filter_t filter);
+
+/**
+ * Perform demosaicing on an 8-bit raw image buffer
+ * into separate red, green and blue planes
+ *
+ * Every plane is written row by row with its own output pitch, so
+ * the planes may live in different buffers or share one with any
+ * plane stride. BGR planar order is written by swapping the red and
+ * blue plane pointers and their pitches
+ *
+ * @param input             input raw image pointer
+ * @param red               output red plane pointer
+ * @param green             output green plane pointer
+ * @param blue              output blue plane pointer
+ * @param pitch             input raw image pitch
+ * @param plane_pitch       red, green and blue output plane pitches
+ *                          in bytes, each at least width, or NULL
+ *                          for packed planes of width pitch
+ * @param width             image width
+ * @param height            image height
+ * @param filter            bayer filter
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_planar(const void* input,
+                                  void* red, void* green, void* blue,
+                                  uint32_t pitch,
+                                  const uint32_t plane_pitch[3],
+                                  uint32_t width, uint32_t height,
+                                  aipl_bayer_filter_t filter);
+
 /**
  * Perform demosaicing on an 8-bit raw image buffer
  * into RGB565 image
@@ -433,6 +584,381 @@ aipl_error_t aipl_demosaic_uyvy(const void* input, void* output,
                                 uint32_t width, uint32_t height,
                                 aipl_bayer_filter_t filter);
 
+/**
+ * Perform demosaicing on an 8-bit raw image buffer
+ * with selectable YUV colorimetry
+ *
+ * The colorimetry coefficients are selected once per call and
+ * apply to the YUV and I400 output formats. RGB output formats
+ * are demosaiced the same way as aipl_demosaic()
+ *
+ * @param input             input raw image pointer
+ * @param output            output image pointer
+ * @param pitch             input raw image pitch
+ * @param width             image width
+ * @param height            image height
+ * @param filter            bayer filter
+ * @param format            output image format
+ * @param colorimetry       YUV colorimetry
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_colorimetry(const void* input, void* output,
+                                       uint32_t pitch,
+                                       uint32_t width, uint32_t height,
+                                       aipl_bayer_filter_t filter,
+                                       aipl_color_format_t format,
+                                       aipl_colorimetry_t colorimetry);
+
+/**
+ * Perform demosaicing on an 8-bit raw image buffer
+ * with selectable interpolation mode
+ *
+ * AIPL_DEMOSAIC_QUAD is the same as aipl_demosaic(). The other
+ * modes interpolate every pixel from its neighbourhood in integer
+ * arithmetic, reading each raw row once into a small line buffer.
+ * Image borders are mirrored. They require an image of at least
+ * 3x3 pixels. Only AIPL_DEMOSAIC_QUAD uses the Helium kernels of
+ * aipl_demosaic(), the other modes run in scalar code
+ *
+ * @param input             input raw image pointer
+ * @param output            output image pointer
+ * @param pitch             input raw image pitch
+ * @param width             image width
+ * @param height            image height
+ * @param filter            bayer filter
+ * @param mode              interpolation mode
+ * @param format            output image format
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_interpolate(const void* input, void* output,
+                                       uint32_t pitch,
+                                       uint32_t width, uint32_t height,
+                                       aipl_bayer_filter_t filter,
+                                       aipl_demosaic_mode_t mode,
+                                       aipl_color_format_t format);
+
+/**
+ * Perform demosaicing on an 8-bit raw image buffer
+ * with defective pixel correction
+ *
+ * A sample more than threshold above the largest or below the
+ * smallest of its eight nearest same channel neighbours is replaced
+ * by that neighbour value before interpolation. Correction runs on
+ * the line buffer of aipl_demosaic_interpolate(), which this
+ * function otherwise matches for every mode, except that
+ * AIPL_DEMOSAIC_QUAD mirrors the image borders too.
+ * Correction and interpolation are scalar for every mode
+ *
+ * @param input             input raw image pointer
+ * @param output            output image pointer
+ * @param pitch             input raw image pitch
+ * @param width             image width
+ * @param height            image height
+ * @param filter            bayer filter
+ * @param mode              interpolation mode
+ * @param threshold         defect detection threshold
+ * @param format            output image format
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_dpc(const void* input, void* output,
+                               uint32_t pitch,
+                               uint32_t width, uint32_t height,
+                               aipl_bayer_filter_t filter,
+                               aipl_demosaic_mode_t mode,
+                               uint8_t threshold,
+                               aipl_color_format_t format);
+
+/**
+ * Perform half resolution demosaicing on an 8-bit raw image buffer
+ *
+ * Every 2x2 bayer quad becomes one output pixel made of its red
+ * sample, the average of its green samples and its blue sample.
+ * The output image is width / 2 by height / 2 pixels.
+ * There is no Helium variant of this function
+ *
+ * @param input             input raw image pointer
+ * @param output            output image pointer
+ * @param pitch             input raw image pitch
+ * @param width             input raw image width
+ * @param height            input raw image height
+ * @param filter            bayer filter
+ * @param format            output image format
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_bin2x2(const void* input, void* output,
+                                  uint32_t pitch,
+                                  uint32_t width, uint32_t height,
+                                  aipl_bayer_filter_t filter,
+                                  aipl_color_format_t format);
+
+/**
+ * Perform demosaicing on an 8-bit raw image buffer
+ * scaled to the output size in the same pass
+ *
+ * Every 2x2 bayer quad is treated as one pixel as in
+ * aipl_demosaic_bin2x2(), and the quad grid is sampled at the
+ * output pixel centers. The full resolution image is never stored.
+ * Sampling is done in scalar code on every target
+ *
+ * @param input             input raw image pointer
+ * @param output            output image pointer
+ * @param pitch             input raw image pitch
+ * @param width             input raw image width
+ * @param height            input raw image height
+ * @param filter            bayer filter
+ * @param format            output image format
+ * @param output_width      output image width
+ * @param output_height     output image height
+ * @param scale             scaling weights
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_resize(const void* input, void* output,
+                                  uint32_t pitch,
+                                  uint32_t width, uint32_t height,
+                                  aipl_bayer_filter_t filter,
+                                  aipl_color_format_t format,
+                                  uint32_t output_width,
+                                  uint32_t output_height,
+                                  aipl_demosaic_scale_t scale);
+
+/**
+ * Perform demosaicing on a rectangular part of an 8-bit raw image buffer
+ *
+ * Only the samples of the region and its adjacent row and column
+ * are read. The bayer filter phase is adjusted for odd offsets and
+ * the region matches the same part of the aipl_demosaic() output.
+ * The last row and column of the frame repeat the ones before them.
+ * The region is demosaiced by scalar code, also on Helium builds
+ *
+ * @param input             input raw image pointer
+ * @param output            output image pointer
+ * @param pitch             input raw image pitch
+ * @param width             input raw image width
+ * @param height            input raw image height
+ * @param filter            bayer filter of the whole image
+ * @param format            output image format
+ * @param left              left coordinate of the region
+ * @param top               top coordinate of the region
+ * @param right             right coordinate of the region
+ * @param bottom            bottom coordinate of the region
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_roi(const void* input, void* output,
+                               uint32_t pitch,
+                               uint32_t width, uint32_t height,
+                               aipl_bayer_filter_t filter,
+                               aipl_color_format_t format,
+                               uint32_t left, uint32_t top,
+                               uint32_t right, uint32_t bottom);
+
+/**
+ * Perform demosaicing on an 8-bit raw image buffer with black level
+ * subtraction and lens shading correction applied to the samples
+ * as they are loaded
+ *
+ * The raw buffer is left untouched
+ *
+ * @param input             input raw image pointer
+ * @param output            output image pointer
+ * @param pitch             input raw image pitch
+ * @param width             image width
+ * @param height            image height
+ * @param filter            bayer filter
+ * @param correction        raw sample correction
+ * @param format            output image format
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_corrected(const void* input, void* output,
+                                     uint32_t pitch,
+                                     uint32_t width, uint32_t height,
+                                     aipl_bayer_filter_t filter,
+                                     const aipl_raw_correction_t* correction,
+                                     aipl_color_format_t format);
+
+/**
+ * Perform demosaicing on an 8-bit raw image buffer
+ * and collect 3A statistics of the demosaiced pixels
+ *
+ * Every pixel adds to the channel sums and sharpness of its grid
+ * cell and to the luma histogram. The statistics are cleared first.
+ * The demosaiced image matches aipl_demosaic(), the last column
+ * included, but is computed without Helium acceleration
+ *
+ * @param input             input raw image pointer
+ * @param output            output image pointer
+ * @param pitch             input raw image pitch
+ * @param width             image width
+ * @param height            image height
+ * @param filter            bayer filter
+ * @param format            output image format
+ * @param stats             statistics grid and storage
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_stats(const void* input, void* output,
+                                 uint32_t pitch,
+                                 uint32_t width, uint32_t height,
+                                 aipl_bayer_filter_t filter,
+                                 aipl_color_format_t format,
+                                 aipl_demosaic_stats_t* stats);
+
+/**
+ * Get the size of a raw image row in bytes
+ *
+ * @param pitch             raw image pitch in samples
+ * @param raw               raw sample packing
+ * @return row size, 0 for an unsupported packing
+ */
+uint32_t aipl_raw_stride(uint32_t pitch, aipl_raw_format_t raw);
+
+/**
+ * Unpack a MIPI CSI-2 packed raw image into 8-bit samples
+ *
+ * The 8 most significant bits of every sample are kept.
+ * The pitch must be a multiple of the packing group size
+ * (4 samples for RAW10, 2 samples for RAW12)
+ *
+ * @param input             input packed raw image pointer
+ * @param output            output 8-bit raw image pointer
+ * @param pitch             input raw image pitch in samples
+ * @param width             image width
+ * @param height            image height
+ * @param raw               input sample packing
+ * @return error code
+ */
+aipl_error_t aipl_raw_unpack_8bit(const void* input, void* output,
+                                  uint32_t pitch,
+                                  uint32_t width, uint32_t height,
+                                  aipl_raw_format_t raw);
+
+/**
+ * Unpack a MIPI CSI-2 packed raw image into 16-bit samples
+ *
+ * Samples keep their full precision and are aligned
+ * to the least significant bit.
+ * The pitch must be a multiple of the packing group size
+ * (4 samples for RAW10, 2 samples for RAW12)
+ *
+ * @param input             input packed raw image pointer
+ * @param output            output 16-bit raw image pointer
+ * @param pitch             input raw image pitch in samples
+ * @param width             image width
+ * @param height            image height
+ * @param raw               input sample packing
+ * @return error code
+ */
+aipl_error_t aipl_raw_unpack_16bit(const void* input, void* output,
+                                   uint32_t pitch,
+                                   uint32_t width, uint32_t height,
+                                   aipl_raw_format_t raw);
+
+/**
+ * Get the gains of the raw image channels from red, green and blue gains
+ *
+ * The channels are the positions of the 2x2 quad at the image origin
+ * in raster order, as used by aipl_raw_white_balance() and
+ * aipl_raw_correction_t
+ *
+ * @param filter            bayer filter
+ * @param red               red gain
+ * @param green             green gain
+ * @param blue              blue gain
+ * @param gains             output array of 4 channel gains
+ */
+void aipl_bayer_channel_gains(aipl_bayer_filter_t filter,
+                              uint16_t red, uint16_t green, uint16_t blue,
+                              uint16_t* gains);
+
+/**
+ * Apply white balance and digital gain to an 8-bit raw image buffer
+ *
+ * Every sample is multiplied by the gain of its channel in
+ * AIPL_RAW_GAIN_BITS fixed point, rounded and saturated. The output
+ * may be the input when the pitch equals the width
+ *
+ * @param input             input raw image pointer
+ * @param output            output raw image pointer
+ * @param pitch             input raw image pitch
+ * @param width             image width
+ * @param height            image height
+ * @param gains             gains of the 4 quad positions in raster order
+ * @param clip_highlights   clip the samples to the level where the
+ *                          channel with the smallest gain saturates
+ * @return error code
+ */
+aipl_error_t aipl_raw_white_balance(const void* input, void* output,
+                                    uint32_t pitch,
+                                    uint32_t width, uint32_t height,
+                                    const uint16_t* gains,
+                                    bool clip_highlights);
+
+/**
+ * Perform demosaicing directly on a MIPI CSI-2 packed raw image buffer
+ *
+ * The 8 most significant bits of the samples are read straight
+ * from the packed rows, without an intermediate unpacked image.
+ * RAW8 input is demosaiced by aipl_demosaic(), RAW10 and RAW12
+ * input is unpacked and demosaiced in scalar code
+ *
+ * @param input             input packed raw image pointer
+ * @param output            output image pointer
+ * @param pitch             input raw image pitch in samples
+ * @param width             image width
+ * @param height            image height
+ * @param filter            bayer filter
+ * @param raw               input sample packing
+ * @param format            output image format
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_raw(const void* input, void* output,
+                               uint32_t pitch,
+                               uint32_t width, uint32_t height,
+                               aipl_bayer_filter_t filter,
+                               aipl_raw_format_t raw,
+                               aipl_color_format_t format);
+
+/**
+ * Perform demosaicing on a high bit depth raw image buffer
+ *
+ * Every sample is stored in the low bits of a 16-bit word.
+ * Demosaiced channels are rounded to 8 bits on output
+ *
+ * @param input             input 16-bit raw image pointer
+ * @param output            output image pointer
+ * @param pitch             input raw image pitch in samples
+ * @param width             image width
+ * @param height            image height
+ * @param filter            bayer filter
+ * @param bits              sample bit depth (8 to 16)
+ * @param format            output image format
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_16bit(const void* input, void* output,
+                                 uint32_t pitch,
+                                 uint32_t width, uint32_t height,
+                                 aipl_bayer_filter_t filter,
+                                 uint8_t bits,
+                                 aipl_color_format_t format);
+
+/**
+ * Perform demosaicing on a high bit depth raw image buffer
+ * into interleaved 16-bit R, G and B samples
+ *
+ * The output keeps the bit depth of the input samples
+ * for the stages that follow demosaicing
+ *
+ * @param input             input 16-bit raw image pointer
+ * @param output            output 16-bit RGB image pointer
+ * @param pitch             input raw image pitch in samples
+ * @param width             image width
+ * @param height            image height
+ * @param filter            bayer filter
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_16bit_rgb16(const void* input, void* output,
+                                       uint32_t pitch,
+                                       uint32_t width, uint32_t height,
+                                       aipl_bayer_filter_t filter);
+
 
 /**********************
 *      MACROS
@@ -28,6 +28,7 @@ extern "C" {
 
 #ifdef AIPL_HELIUM_ACCELERATION
 #include "aipl_arm_mve.h"
+#include "aipl_color_formats.h"
 
 /*********************
  *      DEFINES
@@ -537,6 +538,66 @@ INLINE void aipl_mve_cnvt_16px_xrgb8888_to_yuv_v(uint8x16_t* dst,
     *dst = vmovntq(vreinterpretq_u8(t_r), b_r);
 }
 
+/**
+ * Convert 8 XRGB8888 pixels to Y channel
+ * using colorimetry coefficients
+ * using Helium vector register
+ *
+ * @param dst   destination pixel vector pointer
+ * @param src   source pixel vector
+ * @param coefs colorimetry coefficients
+ */
+INLINE void aipl_mve_cnvt_8px_xrgb8888_to_yuv_y_coefs(uint16x8_t* dst,
+                                                      aipl_mve_rgb_x8_t src,
+                                                      const aipl_yuv_coefs_t* coefs)
+{
+    *dst = vmulq_n_u16(src.r, (uint16_t)coefs->y_red);
+    *dst = vmlaq_n_u16(*dst, src.g, (uint16_t)coefs->y_green);
+    *dst = vmlaq_n_u16(*dst, src.b, (uint16_t)coefs->y_blue);
+    *dst = vshrq(vaddq(*dst, 128), 8);
+    *dst = vaddq(*dst, coefs->y_offset);
+}
+
+/**
+ * Convert 8 XRGB8888 pixels to U channel
+ * using colorimetry coefficients
+ * using Helium vector register
+ *
+ * @param dst   destination pixel vector pointer
+ * @param src   source pixel vector
+ * @param coefs colorimetry coefficients
+ */
+INLINE void aipl_mve_cnvt_8px_xrgb8888_to_yuv_u_coefs(uint16x8_t* dst,
+                                                      aipl_mve_rgb_x8_t src,
+                                                      const aipl_yuv_coefs_t* coefs)
+{
+    *dst = vmulq_n_u16(src.r, (uint16_t)coefs->u_red);
+    *dst = vmlaq_n_u16(*dst, src.g, (uint16_t)coefs->u_green);
+    *dst = vmlaq_n_u16(*dst, src.b, (uint16_t)coefs->u_blue);
+    *dst = vshrq(vaddq(*dst, 128), 8);
+    *dst = vaddq(*dst, 128);
+}
+
+/**
+ * Convert 8 XRGB8888 pixels to V channel
+ * using colorimetry coefficients
+ * using Helium vector register
+ *
+ * @param dst   destination pixel vector pointer
+ * @param src   source pixel vector
+ * @param coefs colorimetry coefficients
+ */
+INLINE void aipl_mve_cnvt_8px_xrgb8888_to_yuv_v_coefs(uint16x8_t* dst,
+                                                      aipl_mve_rgb_x8_t src,
+                                                      const aipl_yuv_coefs_t* coefs)
+{
+    *dst = vmulq_n_u16(src.r, (uint16_t)coefs->v_red);
+    *dst = vmlaq_n_u16(*dst, src.g, (uint16_t)coefs->v_green);
+    *dst = vmlaq_n_u16(*dst, src.b, (uint16_t)coefs->v_blue);
+    *dst = vshrq(vaddq(*dst, 128), 8);
+    *dst = vaddq(*dst, 128);
+}
+
 /**
  * Store 4 ARGB8888 pixels to memory from
  * Helium vector register
@@ -3409,6 +3470,74 @@ INLINE void aipl_mve_lut_transform_rgb_x16(aipl_mve_rgb_x16_t* pix,
     aipl_mve_lut_transform_rgb_channels_x16(&pix->r, &pix->g, &pix->b, lut);
 }
 
+/**
+ * Premultiply the color channels of 4 pixels
+ * packed in 32-bit vector lanes by their alpha
+ *
+ * @param px        pixel vector pointer
+ * @param a_shift   bit offset of the alpha channel
+ * @param c_shift   bit offset of the first color channel,
+ *                  the other two follow it
+ * @param bits      channel bit depth (4 or 8)
+ */
+INLINE void aipl_mve_premultiply_x4(uint32x4_t* px, uint8_t a_shift,
+                                    uint8_t c_shift, uint8_t bits)
+{
+    uint32x4_t mask = vdupq_n_u32((1 << bits) - 1);
+    uint32x4_t a = vandq(vshlq_r(*px, -a_shift), mask);
+    uint32x4_t res = vshlq_r(a, a_shift);
+
+    for (uint8_t i = 0; i < 3; ++i)
+    {
+        int32_t shift = c_shift + i * bits;
+        uint32x4_t c = vandq(vshlq_r(*px, -shift), mask);
+
+        /* round(c * a / max) as (t + (t >> bits)) >> bits */
+        uint32x4_t t = vaddq_n_u32(vmulq(c, a), 1 << (bits - 1));
+        t = vshlq_r(vaddq(t, vshlq_r(t, -bits)), -bits);
+
+        res = vorrq(res, vshlq_r(t, shift));
+    }
+
+    *px = res;
+}
+
+/**
+ * Unpremultiply the color channels of 4 pixels
+ * packed in 32-bit vector lanes by their alpha
+ *
+ * @param px        pixel vector pointer
+ * @param lut       Q16 alpha reciprocal lookup table
+ * @param a_shift   bit offset of the alpha channel
+ * @param c_shift   bit offset of the first color channel,
+ *                  the other two follow it
+ * @param bits      channel bit depth (4 or 8)
+ */
+INLINE void aipl_mve_unpremultiply_x4(uint32x4_t* px, const uint32_t* lut,
+                                      uint8_t a_shift, uint8_t c_shift,
+                                      uint8_t bits)
+{
+    uint32_t max = (1 << bits) - 1;
+    uint32x4_t mask = vdupq_n_u32(max);
+    uint32x4_t a = vandq(vshlq_r(*px, -a_shift), mask);
+    uint32x4_t recip = vldrwq_gather_shifted_offset(lut,
+                                                    vmulq_n_u32(a, 255 / max));
+    uint32x4_t res = vshlq_r(a, a_shift);
+
+    for (uint8_t i = 0; i < 3; ++i)
+    {
+        int32_t shift = c_shift + i * bits;
+        uint32x4_t c = vandq(vshlq_r(*px, -shift), mask);
+
+        uint32x4_t t = vaddq_n_u32(vmulq(c, recip), 0x8000);
+        t = vminq(vshrq_n_u32(t, 16), mask);
+
+        res = vorrq(res, vshlq_r(t, shift));
+    }
+
+    *px = res;
+}
+
 /**********************
  *      MACROS
  **********************/
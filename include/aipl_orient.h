@@ -0,0 +1,123 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/******************************************************************************
+ * @file    aipl_orient.h
+ * @brief   Orientation transform function definitions
+ *
+******************************************************************************/
+
+#ifndef AIPL_ORIENT_H
+#define AIPL_ORIENT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdbool.h>
+
+#include "aipl_color_formats.h"
+#include "aipl_error.h"
+#include "aipl_image.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/**
+ * Orientation transforms numbered as EXIF orientation tag values.
+ * Each value describes the transform applied to the input image
+ */
+typedef enum {
+    AIPL_ORIENT_NORMAL = 1,     /**< Copy */
+    AIPL_ORIENT_FLIP_H = 2,     /**< Mirror horizontally */
+    AIPL_ORIENT_ROTATE_180 = 3, /**< Rotate 180 degrees */
+    AIPL_ORIENT_FLIP_V = 4,     /**< Mirror vertically */
+    AIPL_ORIENT_TRANSPOSE = 5,  /**< Mirror along the main diagonal */
+    AIPL_ORIENT_ROTATE_90 = 6,  /**< Rotate 90 degrees clockwise */
+    AIPL_ORIENT_TRANSVERSE = 7, /**< Mirror along the anti-diagonal */
+    AIPL_ORIENT_ROTATE_270 = 8  /**< Rotate 270 degrees clockwise */
+} aipl_orientation_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Crop, rotate and mirror an image in a single pass
+ * using raw pointer interface
+ *
+ * Output image is packed and has the size of the source rectangle,
+ * with width and height swapped for the orientations
+ * that transpose the image
+ *
+ * @param input             input image pointer
+ * @param output            output image pointer
+ * @param pitch             input image pitch
+ * @param width             input image width
+ * @param height            input image height
+ * @param format            input image format
+ * @param orientation       orientation transform
+ * @param left              source rectangle left border
+ * @param top               source rectangle top border
+ * @param right             source rectangle right border
+ * @param bottom            source rectangle bottom border
+ * @return error code
+ */
+aipl_error_t aipl_orient(const void* input, void* output,
+                         uint32_t pitch,
+                         uint32_t width, uint32_t height,
+                         aipl_color_format_t format,
+                         aipl_orientation_t orientation,
+                         uint32_t left, uint32_t top,
+                         uint32_t right, uint32_t bottom);
+
+/**
+ * Crop, rotate and mirror an image in a single pass
+ * using aipl_image_t interface
+ *
+ * @param input             input image
+ * @param output            output image
+ * @param orientation       orientation transform
+ * @param left              source rectangle left border
+ * @param top               source rectangle top border
+ * @param right             source rectangle right border
+ * @param bottom            source rectangle bottom border
+ * @return error code
+ */
+aipl_error_t aipl_orient_img(const aipl_image_t* input,
+                             aipl_image_t* output,
+                             aipl_orientation_t orientation,
+                             uint32_t left, uint32_t top,
+                             uint32_t right, uint32_t bottom);
+
+/**
+ * Check if orientation swaps image width and height
+ *
+ * @param orientation       orientation transform
+ * @return true if the orientation transposes the image
+ */
+bool aipl_orientation_is_transposed(aipl_orientation_t orientation);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif  /* AIPL_ORIENT_H */
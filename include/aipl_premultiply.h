@@ -0,0 +1,205 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/******************************************************************************
+ * @file    aipl_premultiply.h
+ * @brief   Premultiplied alpha function definitions
+ *
+******************************************************************************/
+
+#ifndef AIPL_PREMULTIPLY_H
+#define AIPL_PREMULTIPLY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "aipl_color_formats.h"
+#include "aipl_error.h"
+#include "aipl_image.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+/**
+ * Multiply the color channels of a straight alpha image by its alpha
+ * using raw pointer interface
+ *
+ * c' = round(c * a / 255)
+ *
+ * The output has the premultiplied variant of the input format,
+ * see aipl_color_format_premultiplied()
+ *
+ * @param input         input image pointer
+ * @param output        output image pointer
+ * @param pitch         input image pitch
+ * @param width         image width
+ * @param height        image height
+ * @param format        input image format (ARGB8888, RGBA8888 or ARGB4444)
+ * @return error code
+ */
+aipl_error_t aipl_premultiply(const void* input, void* output,
+                              uint32_t pitch,
+                              uint32_t width, uint32_t height,
+                              aipl_color_format_t format);
+
+/**
+ * Multiply the color channels of a straight alpha image by its alpha
+ * using aipl_image_t interface
+ *
+ * @param input         input image
+ * @param output        output image of the premultiplied format
+ * @return error code
+ */
+aipl_error_t aipl_premultiply_img(const aipl_image_t* input,
+                                  aipl_image_t* output);
+
+/**
+ * Divide the color channels of a premultiplied alpha image by its alpha
+ * using raw pointer interface
+ *
+ * c = min(round(c' * 255 / a), 255), computed with a reciprocal lookup
+ * table instead of a division so the result may differ by one level
+ * on exact halves. Fully transparent pixels become transparent black
+ *
+ * @param input         input image pointer
+ * @param output        output image pointer
+ * @param pitch         input image pitch
+ * @param width         image width
+ * @param height        image height
+ * @param format        input image format (PARGB8888, PRGBA8888 or PARGB4444)
+ * @return error code
+ */
+aipl_error_t aipl_unpremultiply(const void* input, void* output,
+                                uint32_t pitch,
+                                uint32_t width, uint32_t height,
+                                aipl_color_format_t format);
+
+/**
+ * Divide the color channels of a premultiplied alpha image by its alpha
+ * using aipl_image_t interface
+ *
+ * @param input         input image
+ * @param output        output image of the straight alpha format
+ * @return error code
+ */
+aipl_error_t aipl_unpremultiply_img(const aipl_image_t* input,
+                                    aipl_image_t* output);
+
+/**
+ * Convert straight alpha ARGB8888 image to PARGB8888
+ * using raw pointer interface
+ *
+ * @param input         input image pointer
+ * @param output        output image pointer
+ * @param pitch         input image pitch
+ * @param width         image width
+ * @param height        image height
+ * @return error code
+ */
+aipl_error_t aipl_premultiply_argb8888(const void* input, void* output,
+                                       uint32_t pitch,
+                                       uint32_t width, uint32_t height);
+
+/**
+ * Convert straight alpha RGBA8888 image to PRGBA8888
+ * using raw pointer interface
+ *
+ * @param input         input image pointer
+ * @param output        output image pointer
+ * @param pitch         input image pitch
+ * @param width         image width
+ * @param height        image height
+ * @return error code
+ */
+aipl_error_t aipl_premultiply_rgba8888(const void* input, void* output,
+                                       uint32_t pitch,
+                                       uint32_t width, uint32_t height);
+
+/**
+ * Convert straight alpha ARGB4444 image to PARGB4444
+ * using raw pointer interface
+ *
+ * @param input         input image pointer
+ * @param output        output image pointer
+ * @param pitch         input image pitch
+ * @param width         image width
+ * @param height        image height
+ * @return error code
+ */
+aipl_error_t aipl_premultiply_argb4444(const void* input, void* output,
+                                       uint32_t pitch,
+                                       uint32_t width, uint32_t height);
+
+/**
+ * Convert premultiplied alpha PARGB8888 image to ARGB8888
+ * using raw pointer interface
+ *
+ * @param input         input image pointer
+ * @param output        output image pointer
+ * @param pitch         input image pitch
+ * @param width         image width
+ * @param height        image height
+ * @return error code
+ */
+aipl_error_t aipl_unpremultiply_pargb8888(const void* input, void* output,
+                                          uint32_t pitch,
+                                          uint32_t width, uint32_t height);
+
+/**
+ * Convert premultiplied alpha PRGBA8888 image to RGBA8888
+ * using raw pointer interface
+ *
+ * @param input         input image pointer
+ * @param output        output image pointer
+ * @param pitch         input image pitch
+ * @param width         image width
+ * @param height        image height
+ * @return error code
+ */
+aipl_error_t aipl_unpremultiply_prgba8888(const void* input, void* output,
+                                          uint32_t pitch,
+                                          uint32_t width, uint32_t height);
+
+/**
+ * Convert premultiplied alpha PARGB4444 image to ARGB4444
+ * using raw pointer interface
+ *
+ * @param input         input image pointer
+ * @param output        output image pointer
+ * @param pitch         input image pitch
+ * @param width         image width
+ * @param height        image height
+ * @return error code
+ */
+aipl_error_t aipl_unpremultiply_pargb4444(const void* input, void* output,
+                                          uint32_t pitch,
+                                          uint32_t width, uint32_t height);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif  /* AIPL_PREMULTIPLY_H */
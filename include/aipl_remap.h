@@ -0,0 +1,132 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/******************************************************************************
+ * @file    aipl_remap.h
+ * @brief   Coordinate map based image remapping function definitions
+ *
+******************************************************************************/
+
+#ifndef AIPL_REMAP_H
+#define AIPL_REMAP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "aipl_color_formats.h"
+#include "aipl_error.h"
+#include "aipl_image.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/* Largest supported grid step shift (grid cells of 128x128 pixels) */
+#define AIPL_REMAP_MAX_STEP_SHIFT 7
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/**
+ * Source coordinate in fixed point. The sampled position is
+ * x + fx / 256, y + fy / 256 with pixel centers at integer positions
+ */
+typedef struct {
+    int16_t x;      /**< Integer part (floor) of the horizontal coordinate */
+    int16_t y;      /**< Integer part (floor) of the vertical coordinate */
+    uint8_t fx;     /**< Horizontal fraction in 1/256 */
+    uint8_t fy;     /**< Vertical fraction in 1/256 */
+} aipl_remap_point_t;
+
+/**
+ * Coordinate map
+ *
+ * The point at grid column i and grid row j holds the source coordinate
+ * of output pixel (i << step_shift, j << step_shift). Coordinates
+ * of the pixels between grid points are interpolated bilinearly.
+ * A step_shift of 0 describes a dense map with a point per output pixel
+ */
+typedef struct {
+    const aipl_remap_point_t* points;   /**< Row-major grid points */
+    uint32_t grid_width;                /**< Number of grid columns */
+    uint32_t grid_height;               /**< Number of grid rows */
+    uint32_t step_shift;                /**< log2 of the grid step in pixels */
+} aipl_remap_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Remap an image with a coordinate map using raw pointer interface
+ *
+ * Every output pixel samples the input at the coordinate given by the map.
+ * Output pixels mapped outside of the input image are set to black.
+ * Chroma of subsampled YUV formats is sampled at the coordinates
+ * of the top left pixel of every chroma block
+ *
+ * @param input             input image pointer
+ * @param output            output image pointer
+ * @param pitch             input image pitch
+ * @param width             input image width
+ * @param height            input image height
+ * @param format            input image format
+ * @param output_width      output image width
+ * @param output_height     output image height
+ * @param map               coordinate map
+ * @param interpolate       apply bilinear interpolation
+ * @return error code
+ */
+aipl_error_t aipl_remap(const void* input, void* output,
+                        uint32_t pitch,
+                        uint32_t width, uint32_t height,
+                        aipl_color_format_t format,
+                        uint32_t output_width, uint32_t output_height,
+                        const aipl_remap_t* map,
+                        bool interpolate);
+
+/**
+ * Remap an image with a coordinate map using aipl_image_t interface
+ *
+ * @param input             input image
+ * @param output            output image
+ * @param map               coordinate map
+ * @param interpolate       apply bilinear interpolation
+ * @return error code
+ */
+aipl_error_t aipl_remap_img(const aipl_image_t* input,
+                            aipl_image_t* output,
+                            const aipl_remap_t* map,
+                            bool interpolate);
+
+/**
+ * Convert a source coordinate into a fixed point map point
+ *
+ * @param x                 horizontal source coordinate
+ * @param y                 vertical source coordinate
+ * @return map point
+ */
+aipl_remap_point_t aipl_remap_point(float x, float y);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif  /* AIPL_REMAP_H */
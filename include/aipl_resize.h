@@ -43,6 +43,10 @@ extern "C" {
 /**
  * Resize image using raw pointer interface
  *
+ * Images with the AIPL_COLOR_TILED format flag are resized
+ * tile by tile into a tiled output image. Tiled images are packed,
+ * so the pitch is not used for them
+ *
  * @param input             input image pointer
  * @param output            output image pointer
  * @param pitch             input image pitch
@@ -49,6 +49,10 @@ typedef enum {
 /**
  * Rotate an image in 90-degree steps using raw pointer interface
  *
+ * Images with the AIPL_COLOR_TILED format flag are rotated
+ * tile by tile into a tiled output image. Tiled images are packed,
+ * so the pitch is not used for them
+ *
  * @param input             input image pointer
  * @param output            output image pointer
  * @param pitch             input image pitch
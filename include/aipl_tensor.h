@@ -0,0 +1,201 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/******************************************************************************
+ * @file    aipl_tensor.h
+ * @brief   Neural network input tensor function definitions
+ *
+******************************************************************************/
+
+#ifndef AIPL_TENSOR_H
+#define AIPL_TENSOR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+
+#include "aipl_color_formats.h"
+#include "aipl_demosaic.h"
+#include "aipl_error.h"
+#include "aipl_image.h"
+#include "aipl_config.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/* Largest supported magnitude of a channel scale */
+#define AIPL_TENSOR_MAX_SCALE 32.0f
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/**
+ * Tensor element type
+ */
+typedef enum {
+    AIPL_TENSOR_INT8,           /**< Signed 8-bit quantized values */
+    AIPL_TENSOR_UINT8,          /**< Unsigned 8-bit quantized values */
+    AIPL_TENSOR_FLOAT32,        /**< Single precision floating point values */
+    AIPL_TENSOR_FLOAT16,        /**< Half precision floating point values */
+} aipl_tensor_type_t;
+
+/**
+ * Tensor memory layout
+ */
+typedef enum {
+    AIPL_TENSOR_HWC,            /**< Interleaved channels */
+    AIPL_TENSOR_CHW,            /**< Planar channels */
+} aipl_tensor_layout_t;
+
+/**
+ * Tensor channel order
+ */
+typedef enum {
+    AIPL_TENSOR_RGB,
+    AIPL_TENSOR_BGR,
+} aipl_tensor_order_t;
+
+/**
+ * Tensor output parameters
+ *
+ * Every 8-bit channel value x is mapped to
+ * q = round((x - mean) * scale) + zero_point
+ * saturated to the range of the element type.
+ * A model input normalized as (x - mean) / std and quantized
+ * with scale s and zero point z takes scale = 1 / (std * s)
+ * and zero_point = z
+ *
+ * Floating point tensors take f = (x - mean) * scale + zero_point
+ * without rounding or saturation. A model input normalized as
+ * (x / 255 - mean) / std takes mean = 255 * mean,
+ * scale = 1 / (255 * std) and zero_point = 0
+ *
+ * Tensor elements are written by scalar code, also on Helium
+ * builds. The floating point types take a single precision
+ * multiply-add per channel, plus a conversion to half precision
+ * for AIPL_TENSOR_FLOAT16, where the quantized types stay in
+ * integer arithmetic
+ */
+typedef struct {
+    aipl_tensor_type_t type;
+    aipl_tensor_layout_t layout;
+    aipl_tensor_order_t order;
+    float mean[3];              /**< Channel means in R, G, B order */
+    float scale[3];             /**< Channel scales in R, G, B order */
+    int32_t zero_point[3];      /**< Channel zero points in R, G, B order */
+} aipl_tensor_params_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+#if AIPL_CONVERT_GENERIC
+/**
+ * Convert an image into a neural network input tensor
+ * using raw pointer interface
+ *
+ * The image is decoded and quantized in a single pass
+ *
+ * @param input             input image pointer
+ * @param output            output tensor pointer
+ * @param pitch             input image pitch
+ * @param width             image width
+ * @param height            image height
+ * @param format            input image format
+ * @param params            tensor output parameters
+ * @return error code
+ */
+aipl_error_t aipl_tensor_convert(const void* input, void* output,
+                                 uint32_t pitch,
+                                 uint32_t width, uint32_t height,
+                                 aipl_color_format_t format,
+                                 const aipl_tensor_params_t* params);
+
+/**
+ * Convert an image into a neural network input tensor
+ * using aipl_image_t interface
+ *
+ * @param input             input image
+ * @param output            output tensor pointer
+ * @param params            tensor output parameters
+ * @return error code
+ */
+aipl_error_t aipl_tensor_convert_img(const aipl_image_t* input,
+                                     void* output,
+                                     const aipl_tensor_params_t* params);
+#endif
+
+/**
+ * Demosaic an 8-bit raw image buffer into a neural network input tensor
+ *
+ * The image is demosaiced and quantized in a single pass
+ *
+ * @param input             input raw image pointer
+ * @param output            output tensor pointer
+ * @param pitch             input raw image pitch
+ * @param width             image width
+ * @param height            image height
+ * @param filter            bayer filter
+ * @param params            tensor output parameters
+ * @return error code
+ */
+aipl_error_t aipl_tensor_demosaic(const void* input, void* output,
+                                  uint32_t pitch,
+                                  uint32_t width, uint32_t height,
+                                  aipl_bayer_filter_t filter,
+                                  const aipl_tensor_params_t* params);
+
+/**
+ * Demosaic an 8-bit raw image buffer at half resolution
+ * into a neural network input tensor
+ *
+ * Every 2x2 bayer quad becomes one tensor element, see
+ * aipl_demosaic_bin2x2(). The tensor is width / 2 by height / 2
+ *
+ * @param input             input raw image pointer
+ * @param output            output tensor pointer
+ * @param pitch             input raw image pitch
+ * @param width             input raw image width
+ * @param height            input raw image height
+ * @param filter            bayer filter
+ * @param params            tensor output parameters
+ * @return error code
+ */
+aipl_error_t aipl_tensor_demosaic_bin2x2(const void* input, void* output,
+                                         uint32_t pitch,
+                                         uint32_t width, uint32_t height,
+                                         aipl_bayer_filter_t filter,
+                                         const aipl_tensor_params_t* params);
+
+/**
+ * Get the size of a 3 channel tensor in bytes
+ *
+ * @param width             tensor width
+ * @param height            tensor height
+ * @param type              tensor element type
+ * @return tensor size
+ */
+uint32_t aipl_tensor_size(uint32_t width, uint32_t height,
+                          aipl_tensor_type_t type);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif  /* AIPL_TENSOR_H */
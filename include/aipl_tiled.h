@@ -0,0 +1,112 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/******************************************************************************
+ * @file    aipl_tiled.h
+ * @brief   Tiled memory layout conversion function definitions
+ *
+******************************************************************************/
+
+#ifndef AIPL_TILED_H
+#define AIPL_TILED_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "aipl_color_formats.h"
+#include "aipl_error.h"
+#include "aipl_image.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Convert a row-major image into the AIPL_COLOR_TILED layout
+ * using raw pointer interface
+ *
+ * Output image is packed: its rows of tiles cover the image width
+ * rounded up to AIPL_TILE_SIZE
+ *
+ * @param input             input image pointer
+ * @param output            output image pointer
+ * @param pitch             input image pitch
+ * @param width             input image width
+ * @param height            input image height
+ * @param format            image format without the tiled flag
+ * @return error code
+ */
+aipl_error_t aipl_tiled_from_linear(const void* input, void* output,
+                                    uint32_t pitch,
+                                    uint32_t width, uint32_t height,
+                                    aipl_color_format_t format);
+
+/**
+ * Convert a row-major image into the AIPL_COLOR_TILED layout
+ * using aipl_image_t interface
+ *
+ * @param input             input image
+ * @param output            output image with the tiled input format
+ * @return error code
+ */
+aipl_error_t aipl_tiled_from_linear_img(const aipl_image_t* input,
+                                        aipl_image_t* output);
+
+/**
+ * Convert an AIPL_COLOR_TILED image into the row-major layout
+ * using raw pointer interface
+ *
+ * Input image is packed like the output of aipl_tiled_from_linear()
+ *
+ * @param input             input image pointer
+ * @param output            output image pointer
+ * @param pitch             output image pitch
+ * @param width             input image width
+ * @param height            input image height
+ * @param format            image format without the tiled flag
+ * @return error code
+ */
+aipl_error_t aipl_tiled_to_linear(const void* input, void* output,
+                                  uint32_t pitch,
+                                  uint32_t width, uint32_t height,
+                                  aipl_color_format_t format);
+
+/**
+ * Convert an AIPL_COLOR_TILED image into the row-major layout
+ * using aipl_image_t interface
+ *
+ * @param input             input image
+ * @param output            output image with the untiled input format
+ * @return error code
+ */
+aipl_error_t aipl_tiled_to_linear_img(const aipl_image_t* input,
+                                      aipl_image_t* output);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif  /* AIPL_TILED_H */
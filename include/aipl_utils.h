@@ -26,6 +26,7 @@ extern "C" {
  *********************/
 #include <stdint.h>
 
+#include "aipl_color_formats.h"
 #include "aipl_error.h"
 
 /*********************
@@ -77,6 +78,20 @@ typedef struct {
     uint8_t r;
 } aipl_rgba8888_px_t;
 
+typedef struct {
+    uint8_t a;
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+} aipl_bgra8888_px_t;
+
+typedef struct {
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+    uint8_t a;
+} aipl_abgr8888_px_t;
+
 typedef struct {
     union {
         struct {
@@ -114,6 +129,40 @@ typedef struct {
     };
 } aipl_rgb565_px_t;
 
+/**
+ * Consumer of a run of decoded pixels of an image row
+ *
+ * @param px    decoded pixels
+ * @param x     column of the first pixel
+ * @param y     row of the pixels
+ * @param count number of pixels
+ * @param ctx   consumer context
+ */
+typedef void (*aipl_argb8888_sink_t)(const aipl_argb8888_px_t* px,
+                                     uint32_t x, uint32_t y,
+                                     uint32_t count,
+                                     void* ctx);
+
+/**
+ * Producer of a run of pixels of an image row to be encoded
+ *
+ * @param px    pixels to fill in
+ * @param x     column of the first pixel
+ * @param y     row of the pixels
+ * @param count number of pixels
+ * @param ctx   producer context
+ */
+typedef void (*aipl_argb8888_source_t)(aipl_argb8888_px_t* px,
+                                       uint32_t x, uint32_t y,
+                                       uint32_t count,
+                                       void* ctx);
+
+/**
+ * Q16 reciprocals of the alpha values for unpremultiplication
+ * round(255 * 65536 / a), with 0 for a fully transparent pixel
+ */
+extern const uint32_t aipl_unpremultiply_lut[256];
+
 /**********************
  *      MACROS
  **********************/
@@ -213,6 +262,36 @@ INLINE void aipl_cnvt_px_argb8888_to_rgba8888(aipl_rgba8888_px_t* dst,
     dst->a = src->a;
 }
 
+/**
+ * Convert ARGB8888 pixel into BGRA8888
+ *
+ * @param dst desitnation BGRA8888 pixel pointer
+ * @param src source ARGB8888 pixel pointer
+ */
+INLINE void aipl_cnvt_px_argb8888_to_bgra8888(aipl_bgra8888_px_t* dst,
+                                              const aipl_argb8888_px_t* src)
+{
+    dst->r = src->r;
+    dst->g = src->g;
+    dst->b = src->b;
+    dst->a = src->a;
+}
+
+/**
+ * Convert ARGB8888 pixel into ABGR8888
+ *
+ * @param dst desitnation ABGR8888 pixel pointer
+ * @param src source ARGB8888 pixel pointer
+ */
+INLINE void aipl_cnvt_px_argb8888_to_abgr8888(aipl_abgr8888_px_t* dst,
+                                              const aipl_argb8888_px_t* src)
+{
+    dst->r = src->r;
+    dst->g = src->g;
+    dst->b = src->b;
+    dst->a = src->a;
+}
+
 /**
  * Convert ARGB8888 pixel into RGBA4444
  *
@@ -662,6 +741,36 @@ INLINE void aipl_cnvt_px_rgba8888_to_argb8888(aipl_argb8888_px_t* dst,
     dst->b = src->b;
 }
 
+/**
+ * Convert BGRA8888 pixel into ARGB8888
+ *
+ * @param dst destination ARGB8888 pixel pointer
+ * @param src source BGRA8888 pixel pointer
+ */
+INLINE void aipl_cnvt_px_bgra8888_to_argb8888(aipl_argb8888_px_t* dst,
+                                              const aipl_bgra8888_px_t* src)
+{
+    dst->a = src->a;
+    dst->r = src->r;
+    dst->g = src->g;
+    dst->b = src->b;
+}
+
+/**
+ * Convert ABGR8888 pixel into ARGB8888
+ *
+ * @param dst destination ARGB8888 pixel pointer
+ * @param src source ABGR8888 pixel pointer
+ */
+INLINE void aipl_cnvt_px_abgr8888_to_argb8888(aipl_argb8888_px_t* dst,
+                                              const aipl_abgr8888_px_t* src)
+{
+    dst->a = src->a;
+    dst->r = src->r;
+    dst->g = src->g;
+    dst->b = src->b;
+}
+
 /**
  * Convert RGBA8888 pixel into ARGB4444
  *
@@ -1953,6 +2062,94 @@ INLINE void aipl_cnvt_px_rgb_to_yuv_uv(uint8_t* u_dst,
     *v_dst = AIPL_CNVT_RGB888_TO_YUV_V(red, green, blue);
 }
 
+/**
+ * Convert 16bit pixel of any 16bit RGB format into ARGB8888 pixel
+ *
+ * @param dst       destination ARGB8888 pixel pointer
+ * @param src       source 16bit pixel pointer
+ * @param format    source pixel format
+ */
+INLINE void aipl_cnvt_px_16bit_to_argb8888(aipl_argb8888_px_t* dst,
+                                           const uint8_t* src,
+                                           aipl_color_format_t format)
+{
+    switch (format)
+    {
+        case AIPL_COLOR_ARGB4444:
+            aipl_cnvt_px_argb4444_to_argb8888(dst, (const aipl_argb4444_px_t*)src);
+            break;
+        case AIPL_COLOR_ARGB1555:
+            aipl_cnvt_px_argb1555_to_argb8888(dst, (const aipl_argb1555_px_t*)src);
+            break;
+        case AIPL_COLOR_RGBA4444:
+            aipl_cnvt_px_rgba4444_to_argb8888(dst, (const aipl_rgba4444_px_t*)src);
+            break;
+        case AIPL_COLOR_RGBA5551:
+            aipl_cnvt_px_rgba5551_to_argb8888(dst, (const aipl_rgba5551_px_t*)src);
+            break;
+        default:
+            aipl_cnvt_px_rgb565_to_argb8888(dst, (const aipl_rgb565_px_t*)src);
+            break;
+    }
+}
+
+/**
+ * Convert ARGB8888 pixel into any 16bit RGB format pixel
+ *
+ * @param dst       destination 16bit pixel pointer
+ * @param src       source ARGB8888 pixel pointer
+ * @param format    destination pixel format
+ */
+INLINE void aipl_cnvt_px_argb8888_to_16bit(uint8_t* dst,
+                                           const aipl_argb8888_px_t* src,
+                                           aipl_color_format_t format)
+{
+    switch (format)
+    {
+        case AIPL_COLOR_ARGB4444:
+            aipl_cnvt_px_argb8888_to_argb4444((aipl_argb4444_px_t*)dst, src);
+            break;
+        case AIPL_COLOR_ARGB1555:
+            aipl_cnvt_px_argb8888_to_argb1555((aipl_argb1555_px_t*)dst, src);
+            break;
+        case AIPL_COLOR_RGBA4444:
+            aipl_cnvt_px_argb8888_to_rgba4444((aipl_rgba4444_px_t*)dst, src);
+            break;
+        case AIPL_COLOR_RGBA5551:
+            aipl_cnvt_px_argb8888_to_rgba5551((aipl_rgba5551_px_t*)dst, src);
+            break;
+        default:
+            aipl_cnvt_px_argb8888_to_rgb565((aipl_rgb565_px_t*)dst, src);
+            break;
+    }
+}
+
+/**
+ * Bilinear interpolation of 2x2 pixels with 8bit channels
+ *
+ * @param dst       destination pixel pointer
+ * @param p00       top left pixel pointer
+ * @param p01       top right pixel pointer
+ * @param p10       bottom left pixel pointer
+ * @param p11       bottom right pixel pointer
+ * @param fx        horizontal weight of right pixels in 1/256
+ * @param fy        vertical weight of bottom pixels in 1/256
+ * @param channels  number of channels
+ */
+INLINE void aipl_bilinear_px(uint8_t* dst,
+                             const uint8_t* p00, const uint8_t* p01,
+                             const uint8_t* p10, const uint8_t* p11,
+                             uint32_t fx, uint32_t fy,
+                             uint32_t channels)
+{
+    for (uint32_t c = 0; c < channels; ++c)
+    {
+        uint32_t top = p00[c] * (256 - fx) + p01[c] * fx;
+        uint32_t bot = p10[c] * (256 - fx) + p11[c] * fx;
+        dst[c] = (top * (256 - fy) + bot * fy + 0x8000) >> 16;
+    }
+}
+
 /**
  * Convert R, G and B channels into Y, U and V channels
  *
@@ -1975,6 +2172,186 @@ INLINE void aipl_cnvt_px_rgb_to_yuv(uint8_t* y_dst,
     *v_dst = AIPL_CNVT_RGB888_TO_YUV_V(red, green, blue);
 }
 
+/**
+ * Convert R, G and B channels into Y channel
+ * using colorimetry coefficients
+ *
+ * @param dst       destination Y channel pointer
+ * @param red       red channel
+ * @param green     green channel
+ * @param blue      blue channel
+ * @param coefs     colorimetry coefficients
+ */
+INLINE void aipl_cnvt_px_rgb_to_yuv_y_coefs(uint8_t* dst,
+                                            uint8_t red,
+                                            uint8_t green,
+                                            uint8_t blue,
+                                            const aipl_yuv_coefs_t* coefs)
+{
+    *dst = ((coefs->y_red * red + coefs->y_green * green
+             + coefs->y_blue * blue + 128) >> 8) + coefs->y_offset;
+}
+
+/**
+ * Convert R, G and B channels into Y, U and V channels
+ * using colorimetry coefficients
+ *
+ * @param y_dst     destination Y channel pointer
+ * @param u_dst     destination U channel pointer
+ * @param v_dst     destination V channel pointer
+ * @param red       red channel
+ * @param green     green channel
+ * @param blue      blue channel
+ * @param coefs     colorimetry coefficients
+ */
+INLINE void aipl_cnvt_px_rgb_to_yuv_coefs(uint8_t* y_dst,
+                                          uint8_t* u_dst,
+                                          uint8_t* v_dst,
+                                          uint8_t red,
+                                          uint8_t green,
+                                          uint8_t blue,
+                                          const aipl_yuv_coefs_t* coefs)
+{
+    aipl_cnvt_px_rgb_to_yuv_y_coefs(y_dst, red, green, blue, coefs);
+    *u_dst = ((coefs->u_red * red + coefs->u_green * green
+               + coefs->u_blue * blue + 128) >> 8) + 128;
+    *v_dst = ((coefs->v_red * red + coefs->v_green * green
+               + coefs->v_blue * blue + 128) >> 8) + 128;
+}
+
+/**
+ * A util function for color conversions from YUV formats
+ * using colorimetry coefficients.
+ * Precalculate the values of RGB channels
+ *
+ * @param r     a pointer to output R precalculated channel data
+ * @param g     a pointer to output G precalculated channel data
+ * @param b     a pointer to output B precalculated channel data
+ * @param u     U channel value
+ * @param v     V channel value
+ * @param coefs colorimetry coefficients
+ */
+INLINE void aipl_pre_cnvt_px_yuv_to_rgb_coefs(int32_t* r, int32_t* g, int32_t* b,
+                                              uint8_t u, uint8_t v,
+                                              const aipl_yuv_coefs_t* coefs)
+{
+    int16_t d = u - 128;
+    int16_t e = v - 128;
+
+    *r = coefs->red_e * e + 128;
+    *g = coefs->green_d * d + coefs->green_e * e + 128;
+    *b = coefs->blue_d * d + 128;
+}
+
+/**
+ * A util function for color conversions from YUV formats
+ * using colorimetry coefficients.
+ * Precalculate Y channel related values for RGB channels
+ *
+ * @param c     precalculated value
+ * @param y     Y channel value
+ * @param coefs colorimetry coefficients
+ */
+INLINE void aipl_pre_cnvt_px_y_coefs(int32_t* c, uint8_t y,
+                                     const aipl_yuv_coefs_t* coefs)
+{
+    *c = (y - coefs->y_offset) * coefs->c;
+}
+
+/**
+ * Premultiply an 8-bit channel value by alpha
+ * Exactly round(c * a / 255) without a division
+ *
+ * @param c     channel value
+ * @param a     alpha value
+ * @return premultiplied channel value
+ */
+INLINE uint8_t aipl_premultiply_channel(uint8_t c, uint8_t a)
+{
+    uint32_t t = c * a + 128;
+
+    return (t + (t >> 8)) >> 8;
+}
+
+/**
+ * Unpremultiply an 8-bit channel value by alpha
+ * using the reciprocal lookup table
+ *
+ * @param c     premultiplied channel value
+ * @param a     alpha value
+ * @return straight channel value
+ */
+INLINE uint8_t aipl_unpremultiply_channel(uint8_t c, uint8_t a)
+{
+    uint32_t t = (c * aipl_unpremultiply_lut[a] + 0x8000) >> 16;
+
+    return t > 255 ? 255 : t;
+}
+
+/**
+ * Premultiply a 4-bit channel value by alpha
+ * Exactly round(c * a / 15) without a division
+ *
+ * @param c     channel value
+ * @param a     alpha value
+ * @return premultiplied channel value
+ */
+INLINE uint8_t aipl_premultiply_channel_4bit(uint8_t c, uint8_t a)
+{
+    uint32_t t = c * a + 8;
+
+    return (t + (t >> 4)) >> 4;
+}
+
+/**
+ * Unpremultiply a 4-bit channel value by alpha
+ * using the reciprocal lookup table
+ *
+ * @param c     premultiplied channel value
+ * @param a     alpha value
+ * @return straight channel value
+ */
+INLINE uint8_t aipl_unpremultiply_channel_4bit(uint8_t c, uint8_t a)
+{
+    uint32_t t = (c * aipl_unpremultiply_lut[a * 0x11] + 0x8000) >> 16;
+
+    return t > 15 ? 15 : t;
+}
+
+/**
+ * Premultiply ARGB8888 pixel color channels by its alpha
+ *
+ * @param dst destination pixel pointer
+ * @param src source pixel pointer
+ */
+INLINE void aipl_cnvt_px_premultiply(aipl_argb8888_px_t* dst,
+                                     const aipl_argb8888_px_t* src)
+{
+    uint8_t a = src->a;
+
+    dst->r = aipl_premultiply_channel(src->r, a);
+    dst->g = aipl_premultiply_channel(src->g, a);
+    dst->b = aipl_premultiply_channel(src->b, a);
+    dst->a = a;
+}
+
+/**
+ * Unpremultiply ARGB8888 pixel color channels by its alpha
+ *
+ * @param dst destination pixel pointer
+ * @param src source pixel pointer
+ */
+INLINE void aipl_cnvt_px_unpremultiply(aipl_argb8888_px_t* dst,
+                                       const aipl_argb8888_px_t* src)
+{
+    uint8_t a = src->a;
+
+    dst->r = aipl_unpremultiply_channel(src->r, a);
+    dst->g = aipl_unpremultiply_channel(src->g, a);
+    dst->b = aipl_unpremultiply_channel(src->b, a);
+    dst->a = a;
+}
+
 
 /**********************
  *      MACROS
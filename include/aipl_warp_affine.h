@@ -0,0 +1,113 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/******************************************************************************
+ * @file    aipl_warp_affine.h
+ * @brief   Affine warp function definitions
+ *
+******************************************************************************/
+
+#ifndef AIPL_WARP_AFFINE_H
+#define AIPL_WARP_AFFINE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdbool.h>
+
+#include "aipl_color_formats.h"
+#include "aipl_error.h"
+#include "aipl_image.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Warp an image with an affine transform using raw pointer interface
+ *
+ * The matrix maps every output pixel to the input pixel it samples:
+ * x_in = m[0] * x_out + m[1] * y_out + m[2]
+ * y_in = m[3] * x_out + m[4] * y_out + m[5]
+ * Output pixels mapped outside of the input image are set to zero
+ *
+ * @param input             input image pointer
+ * @param output            output image pointer
+ * @param pitch             input image pitch
+ * @param width             input image width
+ * @param height            input image height
+ * @param format            input image format
+ * @param output_width      output image width
+ * @param output_height     output image height
+ * @param matrix            2x3 row-major transform matrix
+ * @param interpolate       apply bilinear interpolation
+ * @return error code
+ */
+aipl_error_t aipl_warp_affine(const void* input, void* output,
+                              uint32_t pitch,
+                              uint32_t width, uint32_t height,
+                              aipl_color_format_t format,
+                              uint32_t output_width, uint32_t output_height,
+                              const float matrix[6],
+                              bool interpolate);
+
+/**
+ * Warp an image with an affine transform using aipl_image_t interface
+ *
+ * @param input             input image
+ * @param output            output image
+ * @param matrix            2x3 row-major transform matrix
+ * @param interpolate       apply bilinear interpolation
+ * @return error code
+ */
+aipl_error_t aipl_warp_affine_img(const aipl_image_t* input,
+                                  aipl_image_t* output,
+                                  const float matrix[6],
+                                  bool interpolate);
+
+/**
+ * Build the aipl_warp_affine matrix that rotates an image clockwise
+ * by an arbitrary angle and scales it around the image centers
+ *
+ * @param matrix            output 2x3 row-major transform matrix
+ * @param angle             clockwise rotation angle in degrees
+ * @param scale             scaling factor
+ * @param width             input image width
+ * @param height            input image height
+ * @param output_width      output image width
+ * @param output_height     output image height
+ */
+void aipl_warp_affine_rotation_matrix(float matrix[6],
+                                      float angle, float scale,
+                                      uint32_t width, uint32_t height,
+                                      uint32_t output_width,
+                                      uint32_t output_height);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif  /* AIPL_WARP_AFFINE_H */
@@ -6957,6 +6957,84 @@ aipl_error_t aipl_color_convert_rgb888p_to_rgb565_default(const void* input,
 #endif
 #endif
 
+/**
+ * Copy an image without changing its color format
+ * using default implementation with compiler imposed optimization
+ *
+ * @param input         input image pointer
+ * @param output        output image pointer
+ * @param pitch         input image pitch
+ * @param width         image width
+ * @param height        image height
+ * @param format        image format
+ * @return error code
+ */
+aipl_error_t aipl_color_copy_default(const void* input, void* output,
+                                     uint32_t pitch,
+                                     uint32_t width, uint32_t height,
+                                     aipl_color_format_t format);
+
+#if !defined(AIPL_HELIUM_ACCELERATION) || defined(AIPL_INCLUDE_ALL_DEFAULT)
+/**
+ * Convert Y16 image to I400 by shifting the samples right
+ * using default implementation with compiler imposed optimization
+ *
+ * @param input         input image pointer
+ * @param output        output image pointer
+ * @param pitch         input image pitch
+ * @param width         image width
+ * @param height        image height
+ * @param shift         right shift of the samples, up to 15
+ * @return error code
+ */
+aipl_error_t aipl_color_convert_y16_to_i400_default(const void* input,
+                                                    void* output,
+                                                    uint32_t pitch,
+                                                    uint32_t width,
+                                                    uint32_t height,
+                                                    uint8_t shift);
+
+/**
+ * Convert Y16 image to I400 through a lookup table
+ * using default implementation with compiler imposed optimization
+ *
+ * @param input         input image pointer
+ * @param output        output image pointer
+ * @param pitch         input image pitch
+ * @param width         image width
+ * @param height        image height
+ * @param lut           lookup table of (0xffff >> shift) + 1 entries
+ * @param shift         right shift of the samples before the lookup
+ * @return error code
+ */
+aipl_error_t aipl_color_convert_y16_lut_default(const void* input,
+                                                void* output,
+                                                uint32_t pitch,
+                                                uint32_t width,
+                                                uint32_t height,
+                                                const uint8_t* lut,
+                                                uint8_t shift);
+
+/**
+ * Convert I400 image to Y16 by shifting the samples left
+ * using default implementation with compiler imposed optimization
+ *
+ * @param input         input image pointer
+ * @param output        output image pointer
+ * @param pitch         input image pitch
+ * @param width         image width
+ * @param height        image height
+ * @param shift         left shift of the samples, up to 8
+ * @return error code
+ */
+aipl_error_t aipl_color_convert_i400_to_y16_default(const void* input,
+                                                    void* output,
+                                                    uint32_t pitch,
+                                                    uint32_t width,
+                                                    uint32_t height,
+                                                    uint8_t shift);
+#endif
+
 /**********************
  *      MACROS
  **********************/
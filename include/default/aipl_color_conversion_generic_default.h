@@ -0,0 +1,148 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/******************************************************************************
+ * @file    aipl_color_conversion_generic_default.h
+ * @brief   Default generic color conversion engine definitions
+ *
+******************************************************************************/
+
+#ifndef AIPL_COLOR_CONVERSION_GENERIC_DEFAULT_H
+#define AIPL_COLOR_CONVERSION_GENERIC_DEFAULT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "aipl_color_conversion.h"
+#include "aipl_color_formats.h"
+#include "aipl_error.h"
+#include "aipl_image.h"
+#include "aipl_utils.h"
+#include "aipl_config.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+#if AIPL_CONVERT_GENERIC
+/**
+ * Convert image color format with the generic conversion engine
+ * using default implementation with compiler imposed optimization
+ *
+ * @param input         input image pointer
+ * @param output        output image pointer
+ * @param pitch         input image pitch
+ * @param width         image width
+ * @param height        image height
+ * @param input_format  input image format
+ * @param output_format output image format
+ * @param coefs         YUV colorimetry coefficients
+ * @return error code
+ */
+aipl_error_t aipl_color_convert_generic_default(const void* input,
+                                                void* output,
+                                                uint32_t pitch,
+                                                uint32_t width,
+                                                uint32_t height,
+                                                aipl_color_format_t input_format,
+                                                aipl_color_format_t output_format,
+                                                const aipl_yuv_coefs_t* coefs);
+
+/**
+ * Convert an image into several color formats at once with the generic
+ * conversion engine, unpacking every input block only once
+ * using default implementation with compiler imposed optimization
+ *
+ * @param input         input image pointer
+ * @param pitch         input image pitch
+ * @param width         image width
+ * @param height        image height
+ * @param input_format  input image format
+ * @param outputs       output buffers and formats
+ * @param output_num    number of outputs, up to AIPL_CONVERT_MULTI_MAX
+ * @param coefs         YUV colorimetry coefficients
+ * @return error code
+ */
+aipl_error_t aipl_color_convert_multi_generic_default(const void* input,
+                                                      uint32_t pitch,
+                                                      uint32_t width,
+                                                      uint32_t height,
+                                                      aipl_color_format_t input_format,
+                                                      const aipl_color_output_t* outputs,
+                                                      uint32_t output_num,
+                                                      const aipl_yuv_coefs_t* coefs);
+
+/**
+ * Decode an image into runs of ARGB8888 pixels with the generic
+ * conversion engine and pass every run to a consumer
+ * using default implementation with compiler imposed optimization
+ *
+ * @param input         input image pointer
+ * @param pitch         input image pitch
+ * @param width         image width
+ * @param height        image height
+ * @param format        input image format
+ * @param coefs         YUV colorimetry coefficients
+ * @param sink          consumer of the decoded pixel runs
+ * @param ctx           consumer context
+ * @return error code
+ */
+aipl_error_t aipl_color_decode_generic_default(const void* input,
+                                               uint32_t pitch,
+                                               uint32_t width,
+                                               uint32_t height,
+                                               aipl_color_format_t format,
+                                               const aipl_yuv_coefs_t* coefs,
+                                               aipl_argb8888_sink_t sink,
+                                               void* ctx);
+
+/**
+ * Encode runs of ARGB8888 pixels taken from a producer into an image
+ * with the generic conversion engine
+ * using default implementation with compiler imposed optimization
+ *
+ * @param output        output image pointer
+ * @param width         image width
+ * @param height        image height
+ * @param format        output image format
+ * @param coefs         YUV colorimetry coefficients
+ * @param source        producer of the pixel runs
+ * @param ctx           producer context
+ * @return error code
+ */
+aipl_error_t aipl_color_encode_generic_default(void* output,
+                                               uint32_t width,
+                                               uint32_t height,
+                                               aipl_color_format_t format,
+                                               const aipl_yuv_coefs_t* coefs,
+                                               aipl_argb8888_source_t source,
+                                               void* ctx);
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif  /* AIPL_COLOR_CONVERSION_GENERIC_DEFAULT_H */
@@ -26,6 +26,7 @@ extern "C" {
  *      INCLUDES
  *********************/
 #include "aipl_demosaic.h"
+#include "aipl_utils.h"
 
 /**********************
  *      TYPEDEFS
@@ -244,6 +245,49 @@ aipl_error_t aipl_demosaic_bgr888_default(const void* input,
                                           uint32_t height,
                                           aipl_bayer_filter_t filter);
 
+/**
+ * Perform demosaicing on an 8-bit raw image buffer
+ * into RGB888P (planar) image using default compiler optimizations
+ *
+ * @param input             input raw image pointer
+ * @param output            output RGB888P image pointer
+ * @param pitch             input raw image pitch
+ * @param width             image width
+ * @param height            image height
+ * @param filter            bayer filter
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_rgb888p_default(const void* input,
+                                           void* output,
+                                           uint32_t pitch,
+                                           uint32_t width,
+                                           uint32_t height,
+                                           aipl_bayer_filter_t filter);
+
+/**
+ * Perform demosaicing on an 8-bit raw image buffer
+ * into separate red, green and blue planes
+ * using default compiler optimizations
+ *
+ * @param input             input raw image pointer
+ * @param red               output red plane pointer
+ * @param green             output green plane pointer
+ * @param blue              output blue plane pointer
+ * @param pitch             input raw image pitch
+ * @param plane_pitch       red, green and blue output plane pitches
+ *                          in bytes, or NULL for width
+ * @param width             image width
+ * @param height            image height
+ * @param filter            bayer filter
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_planar_default(const void* input,
+                                          void* red, void* green, void* blue,
+                                          uint32_t pitch,
+                                          const uint32_t plane_pitch[3],
+                                          uint32_t width, uint32_t height,
+                                          aipl_bayer_filter_t filter);
+
 /**
  * Perform demosaicing on an 8-bit raw image buffer
  * into RGB565 image using default compiler optimizations
@@ -416,6 +460,371 @@ aipl_error_t aipl_demosaic_uyvy_default(const void* input, void* output,
                                         uint32_t width, uint32_t height,
                                         aipl_bayer_filter_t filter);
 
+/**
+ * Perform demosaicing on an 8-bit raw image buffer
+ * with selectable YUV colorimetry coefficients
+ * using default compiler optimizations
+ *
+ * @param input             input raw image pointer
+ * @param output            output image pointer
+ * @param pitch             input raw image pitch
+ * @param width             image width
+ * @param height            image height
+ * @param filter            bayer filter
+ * @param format            output image format
+ * @param coefs             YUV colorimetry coefficients
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_colorimetry_default(const void* input, void* output,
+                                               uint32_t pitch,
+                                               uint32_t width, uint32_t height,
+                                               aipl_bayer_filter_t filter,
+                                               aipl_color_format_t format,
+                                               const aipl_yuv_coefs_t* coefs);
+
+/**
+ * Perform demosaicing on an 8-bit raw image buffer
+ * with selectable interpolation mode
+ * using default compiler optimizations
+ *
+ * @param input             input raw image pointer
+ * @param output            output image pointer
+ * @param pitch             input raw image pitch
+ * @param width             image width
+ * @param height            image height
+ * @param filter            bayer filter
+ * @param mode              interpolation mode
+ * @param format            output image format
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_interpolate_default(const void* input,
+                                               void* output,
+                                               uint32_t pitch,
+                                               uint32_t width, uint32_t height,
+                                               aipl_bayer_filter_t filter,
+                                               aipl_demosaic_mode_t mode,
+                                               aipl_color_format_t format);
+
+/**
+ * Perform demosaicing on an 8-bit raw image buffer
+ * with defective pixel correction
+ * using default compiler optimizations
+ *
+ * @param input             input raw image pointer
+ * @param output            output image pointer
+ * @param pitch             input raw image pitch
+ * @param width             image width
+ * @param height            image height
+ * @param filter            bayer filter
+ * @param mode              interpolation mode
+ * @param threshold         defect detection threshold
+ * @param format            output image format
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_dpc_default(const void* input, void* output,
+                                       uint32_t pitch,
+                                       uint32_t width, uint32_t height,
+                                       aipl_bayer_filter_t filter,
+                                       aipl_demosaic_mode_t mode,
+                                       uint8_t threshold,
+                                       aipl_color_format_t format);
+
+/**
+ * Perform half resolution demosaicing on an 8-bit raw image buffer
+ * using default compiler optimizations
+ *
+ * @param input             input raw image pointer
+ * @param output            output image pointer
+ * @param pitch             input raw image pitch
+ * @param width             input raw image width
+ * @param height            input raw image height
+ * @param filter            bayer filter
+ * @param format            output image format
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_bin2x2_default(const void* input, void* output,
+                                          uint32_t pitch,
+                                          uint32_t width, uint32_t height,
+                                          aipl_bayer_filter_t filter,
+                                          aipl_color_format_t format);
+
+/**
+ * Perform demosaicing on an 8-bit raw image buffer
+ * scaled to the output size in the same pass
+ * using default compiler optimizations
+ *
+ * @param input             input raw image pointer
+ * @param output            output image pointer
+ * @param pitch             input raw image pitch
+ * @param width             input raw image width
+ * @param height            input raw image height
+ * @param filter            bayer filter
+ * @param format            output image format
+ * @param output_width      output image width
+ * @param output_height     output image height
+ * @param scale             scaling weights
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_resize_default(const void* input, void* output,
+                                          uint32_t pitch,
+                                          uint32_t width, uint32_t height,
+                                          aipl_bayer_filter_t filter,
+                                          aipl_color_format_t format,
+                                          uint32_t output_width,
+                                          uint32_t output_height,
+                                          aipl_demosaic_scale_t scale);
+
+/**
+ * Perform demosaicing on a rectangular part of an 8-bit raw image buffer
+ * using default compiler optimizations
+ *
+ * @param input             input raw image pointer
+ * @param output            output image pointer
+ * @param pitch             input raw image pitch
+ * @param width             input raw image width
+ * @param height            input raw image height
+ * @param filter            bayer filter of the whole image
+ * @param format            output image format
+ * @param left              left coordinate of the region
+ * @param top               top coordinate of the region
+ * @param right             right coordinate of the region
+ * @param bottom            bottom coordinate of the region
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_roi_default(const void* input, void* output,
+                                       uint32_t pitch,
+                                       uint32_t width, uint32_t height,
+                                       aipl_bayer_filter_t filter,
+                                       aipl_color_format_t format,
+                                       uint32_t left, uint32_t top,
+                                       uint32_t right, uint32_t bottom);
+
+/**
+ * Perform demosaicing on an 8-bit raw image buffer with black level
+ * subtraction and lens shading correction
+ * using default compiler optimizations
+ *
+ * @param input             input raw image pointer
+ * @param output            output image pointer
+ * @param pitch             input raw image pitch
+ * @param width             image width
+ * @param height            image height
+ * @param filter            bayer filter
+ * @param correction        raw sample correction
+ * @param format            output image format
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_corrected_default(const void* input, void* output,
+                                             uint32_t pitch,
+                                             uint32_t width, uint32_t height,
+                                             aipl_bayer_filter_t filter,
+                                             const aipl_raw_correction_t* correction,
+                                             aipl_color_format_t format);
+
+/**
+ * Perform demosaicing on an 8-bit raw image buffer
+ * and collect 3A statistics of the demosaiced pixels
+ * using default compiler optimizations
+ *
+ * @param input             input raw image pointer
+ * @param output            output image pointer
+ * @param pitch             input raw image pitch
+ * @param width             image width
+ * @param height            image height
+ * @param filter            bayer filter
+ * @param format            output image format
+ * @param stats             statistics grid and storage
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_stats_default(const void* input, void* output,
+                                         uint32_t pitch,
+                                         uint32_t width, uint32_t height,
+                                         aipl_bayer_filter_t filter,
+                                         aipl_color_format_t format,
+                                         aipl_demosaic_stats_t* stats);
+
+/**
+ * Demosaic an 8-bit raw image buffer into runs of ARGB8888 pixels
+ * and pass every run to a consumer
+ * using default compiler optimizations
+ *
+ * @param input             input raw image pointer
+ * @param pitch             input raw image pitch
+ * @param width             image width
+ * @param height            image height
+ * @param filter            bayer filter
+ * @param sink              consumer of the decoded pixel runs
+ * @param ctx               consumer context
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_decode_default(const void* input,
+                                          uint32_t pitch,
+                                          uint32_t width, uint32_t height,
+                                          aipl_bayer_filter_t filter,
+                                          aipl_argb8888_sink_t sink,
+                                          void* ctx);
+
+/**
+ * Demosaic an 8-bit raw image buffer at half resolution into runs
+ * of ARGB8888 pixels and pass every run to a consumer
+ * using default compiler optimizations
+ *
+ * @param input             input raw image pointer
+ * @param pitch             input raw image pitch
+ * @param width             input raw image width
+ * @param height            input raw image height
+ * @param filter            bayer filter
+ * @param sink              consumer of the decoded pixel runs
+ * @param ctx               consumer context
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_bin2x2_decode_default(const void* input,
+                                                 uint32_t pitch,
+                                                 uint32_t width,
+                                                 uint32_t height,
+                                                 aipl_bayer_filter_t filter,
+                                                 aipl_argb8888_sink_t sink,
+                                                 void* ctx);
+
+/**
+ * Write the runs of ARGB8888 pixels produced by a demosaicing source
+ * into an output image of any demosaicing output format
+ * using default compiler optimizations
+ *
+ * Rows are requested in pairs, in runs from left to right.
+ * Formats that are not demosaicing outputs are written by
+ * the generic conversion engine when it is built in
+ *
+ * @param output            output image pointer
+ * @param width             output image width
+ * @param height            output image height
+ * @param format            output image color format
+ * @param coefs             colorimetry coefficients of YUV output
+ * @param source            producer of the pixel runs
+ * @param ctx               producer context
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_encode_default(void* output,
+                                          uint32_t width, uint32_t height,
+                                          aipl_color_format_t format,
+                                          const aipl_yuv_coefs_t* coefs,
+                                          aipl_argb8888_source_t source,
+                                          void* ctx);
+
+/**
+ * Unpack a MIPI CSI-2 packed raw image into 8-bit samples
+ * using default compiler optimizations
+ *
+ * @param input             input packed raw image pointer
+ * @param output            output 8-bit raw image pointer
+ * @param pitch             input raw image pitch in samples
+ * @param width             image width
+ * @param height            image height
+ * @param raw               input sample packing
+ * @return error code
+ */
+aipl_error_t aipl_raw_unpack_8bit_default(const void* input, void* output,
+                                          uint32_t pitch,
+                                          uint32_t width, uint32_t height,
+                                          aipl_raw_format_t raw);
+
+/**
+ * Unpack a MIPI CSI-2 packed raw image into 16-bit samples
+ * using default compiler optimizations
+ *
+ * @param input             input packed raw image pointer
+ * @param output            output 16-bit raw image pointer
+ * @param pitch             input raw image pitch in samples
+ * @param width             image width
+ * @param height            image height
+ * @param raw               input sample packing
+ * @return error code
+ */
+aipl_error_t aipl_raw_unpack_16bit_default(const void* input, void* output,
+                                           uint32_t pitch,
+                                           uint32_t width, uint32_t height,
+                                           aipl_raw_format_t raw);
+
+/**
+ * Apply white balance and digital gain to an 8-bit raw image buffer
+ * using default compiler optimizations
+ *
+ * @param input             input raw image pointer
+ * @param output            output raw image pointer
+ * @param pitch             input raw image pitch
+ * @param width             image width
+ * @param height            image height
+ * @param gains             gains of the 4 quad positions in raster order
+ * @param clip_highlights   clip the samples to the level where the
+ *                          channel with the smallest gain saturates
+ * @return error code
+ */
+aipl_error_t aipl_raw_white_balance_default(const void* input, void* output,
+                                            uint32_t pitch,
+                                            uint32_t width, uint32_t height,
+                                            const uint16_t* gains,
+                                            bool clip_highlights);
+
+/**
+ * Perform demosaicing directly on a MIPI CSI-2 packed raw image buffer
+ * using default compiler optimizations
+ *
+ * @param input             input packed raw image pointer
+ * @param output            output image pointer
+ * @param pitch             input raw image pitch in samples
+ * @param width             image width
+ * @param height            image height
+ * @param filter            bayer filter
+ * @param raw               input sample packing
+ * @param format            output image format
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_raw_default(const void* input, void* output,
+                                       uint32_t pitch,
+                                       uint32_t width, uint32_t height,
+                                       aipl_bayer_filter_t filter,
+                                       aipl_raw_format_t raw,
+                                       aipl_color_format_t format);
+
+/**
+ * Perform demosaicing on a high bit depth raw image buffer
+ * using default compiler optimizations
+ *
+ * @param input             input 16-bit raw image pointer
+ * @param output            output image pointer
+ * @param pitch             input raw image pitch in samples
+ * @param width             image width
+ * @param height            image height
+ * @param filter            bayer filter
+ * @param bits              sample bit depth (8 to 16)
+ * @param format            output image format
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_16bit_default(const void* input, void* output,
+                                         uint32_t pitch,
+                                         uint32_t width, uint32_t height,
+                                         aipl_bayer_filter_t filter,
+                                         uint8_t bits,
+                                         aipl_color_format_t format);
+
+/**
+ * Perform demosaicing on a high bit depth raw image buffer
+ * into interleaved 16-bit R, G and B samples
+ * using default compiler optimizations
+ *
+ * @param input             input 16-bit raw image pointer
+ * @param output            output 16-bit RGB image pointer
+ * @param pitch             input raw image pitch in samples
+ * @param width             image width
+ * @param height            image height
+ * @param filter            bayer filter
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_16bit_rgb16_default(const void* input, void* output,
+                                               uint32_t pitch,
+                                               uint32_t width, uint32_t height,
+                                               aipl_bayer_filter_t filter);
+
 
 /**********************
 *      MACROS
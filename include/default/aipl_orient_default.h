@@ -0,0 +1,98 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/******************************************************************************
+ * @file    aipl_orient_default.h
+ * @brief   Default orientation transform function definitions
+ *
+******************************************************************************/
+
+#ifndef AIPL_ORIENT_DEFAULT_H
+#define AIPL_ORIENT_DEFAULT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "aipl_color_formats.h"
+#include "aipl_error.h"
+#include "aipl_image.h"
+#include "aipl_orient.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Crop, rotate and mirror an image in a single pass
+ * using raw pointer interface
+ * using default implementation with compiler imposed optimization
+ *
+ * @param input             input image pointer
+ * @param output            output image pointer
+ * @param pitch             input image pitch
+ * @param width             input image width
+ * @param height            input image height
+ * @param format            input image format
+ * @param orientation       orientation transform
+ * @param left              source rectangle left border
+ * @param top               source rectangle top border
+ * @param right             source rectangle right border
+ * @param bottom            source rectangle bottom border
+ * @return error code
+ */
+aipl_error_t aipl_orient_default(const void* input, void* output,
+                                 uint32_t pitch,
+                                 uint32_t width, uint32_t height,
+                                 aipl_color_format_t format,
+                                 aipl_orientation_t orientation,
+                                 uint32_t left, uint32_t top,
+                                 uint32_t right, uint32_t bottom);
+
+/**
+ * Crop, rotate and mirror an image in a single pass
+ * using aipl_image_t interface
+ * using default implementation with compiler imposed optimization
+ *
+ * @param input             input image
+ * @param output            output image
+ * @param orientation       orientation transform
+ * @param left              source rectangle left border
+ * @param top               source rectangle top border
+ * @param right             source rectangle right border
+ * @param bottom            source rectangle bottom border
+ * @return error code
+ */
+aipl_error_t aipl_orient_img_default(const aipl_image_t* input,
+                                     aipl_image_t* output,
+                                     aipl_orientation_t orientation,
+                                     uint32_t left, uint32_t top,
+                                     uint32_t right, uint32_t bottom);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif  /* AIPL_ORIENT_DEFAULT_H */
@@ -0,0 +1,88 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/******************************************************************************
+ * @file    aipl_rotate_convert_default.h
+ * @brief   Default fused rotate and color conversion function definitions
+ *
+******************************************************************************/
+
+#ifndef AIPL_ROTATE_CONVERT_DEFAULT_H
+#define AIPL_ROTATE_CONVERT_DEFAULT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "aipl_color_formats.h"
+#include "aipl_error.h"
+#include "aipl_image.h"
+#include "aipl_rotate.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Rotate an image in 90-degree steps and convert its color format
+ * in a single pass using raw pointer interface
+ * using default implementation with compiler imposed optimization
+ *
+ * @param input             input image pointer
+ * @param output            output image pointer
+ * @param pitch             input image pitch
+ * @param width             input image width
+ * @param height            input image height
+ * @param input_format      input image format
+ * @param output_format     output image format
+ * @param rotation          rotation angle
+ * @return error code
+ */
+aipl_error_t aipl_rotate_convert_default(const void* input, void* output,
+                                         uint32_t pitch,
+                                         uint32_t width, uint32_t height,
+                                         aipl_color_format_t input_format,
+                                         aipl_color_format_t output_format,
+                                         aipl_rotation_t rotation);
+
+/**
+ * Rotate an image in 90-degree steps and convert its color format
+ * in a single pass using aipl_image_t interface
+ * using default implementation with compiler imposed optimization
+ *
+ * @param input             input image
+ * @param output            output image
+ * @param rotation          rotation angle
+ * @return error code
+ */
+aipl_error_t aipl_rotate_convert_img_default(const aipl_image_t* input,
+                                             aipl_image_t* output,
+                                             aipl_rotation_t rotation);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif  /* AIPL_ROTATE_CONVERT_DEFAULT_H */
@@ -0,0 +1,111 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/******************************************************************************
+ * @file    aipl_tensor_default.h
+ * @brief   Default neural network input tensor function definitions
+ *
+******************************************************************************/
+
+#ifndef AIPL_TENSOR_DEFAULT_H
+#define AIPL_TENSOR_DEFAULT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "aipl_tensor.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+#if AIPL_CONVERT_GENERIC
+/**
+ * Convert an image into a neural network input tensor
+ * using default implementation with compiler imposed optimization
+ *
+ * @param input             input image pointer
+ * @param output            output tensor pointer
+ * @param pitch             input image pitch
+ * @param width             image width
+ * @param height            image height
+ * @param format            input image format
+ * @param params            tensor output parameters
+ * @return error code
+ */
+aipl_error_t aipl_tensor_convert_default(const void* input, void* output,
+                                         uint32_t pitch,
+                                         uint32_t width, uint32_t height,
+                                         aipl_color_format_t format,
+                                         const aipl_tensor_params_t* params);
+#endif
+
+/**
+ * Demosaic an 8-bit raw image buffer into a neural network input tensor
+ * using default implementation with compiler imposed optimization
+ *
+ * @param input             input raw image pointer
+ * @param output            output tensor pointer
+ * @param pitch             input raw image pitch
+ * @param width             image width
+ * @param height            image height
+ * @param filter            bayer filter
+ * @param params            tensor output parameters
+ * @return error code
+ */
+aipl_error_t aipl_tensor_demosaic_default(const void* input, void* output,
+                                          uint32_t pitch,
+                                          uint32_t width, uint32_t height,
+                                          aipl_bayer_filter_t filter,
+                                          const aipl_tensor_params_t* params);
+
+/**
+ * Demosaic an 8-bit raw image buffer at half resolution
+ * into a neural network input tensor
+ * using default implementation with compiler imposed optimization
+ *
+ * @param input             input raw image pointer
+ * @param output            output tensor pointer
+ * @param pitch             input raw image pitch
+ * @param width             input raw image width
+ * @param height            input raw image height
+ * @param filter            bayer filter
+ * @param params            tensor output parameters
+ * @return error code
+ */
+aipl_error_t aipl_tensor_demosaic_bin2x2_default(const void* input,
+                                                 void* output,
+                                                 uint32_t pitch,
+                                                 uint32_t width,
+                                                 uint32_t height,
+                                                 aipl_bayer_filter_t filter,
+                                                 const aipl_tensor_params_t* params);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif  /* AIPL_TENSOR_DEFAULT_H */
@@ -0,0 +1,170 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/******************************************************************************
+ * @file    aipl_tiled_default.h
+ * @brief   Default tiled memory layout function definitions
+ *
+******************************************************************************/
+
+#ifndef AIPL_TILED_DEFAULT_H
+#define AIPL_TILED_DEFAULT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdbool.h>
+
+#include "aipl_color_formats.h"
+#include "aipl_error.h"
+#include "aipl_image.h"
+#include "aipl_rotate.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Convert a row-major image into the AIPL_COLOR_TILED layout
+ * using raw pointer interface
+ * using default implementation with compiler imposed optimization
+ *
+ * @param input             input image pointer
+ * @param output            output image pointer
+ * @param pitch             input image pitch
+ * @param width             input image width
+ * @param height            input image height
+ * @param format            image format without the tiled flag
+ * @return error code
+ */
+aipl_error_t aipl_tiled_from_linear_default(const void* input, void* output,
+                                            uint32_t pitch,
+                                            uint32_t width, uint32_t height,
+                                            aipl_color_format_t format);
+
+/**
+ * Convert a row-major image into the AIPL_COLOR_TILED layout
+ * using aipl_image_t interface
+ * using default implementation with compiler imposed optimization
+ *
+ * @param input             input image
+ * @param output            output image with the tiled input format
+ * @return error code
+ */
+aipl_error_t aipl_tiled_from_linear_img_default(const aipl_image_t* input,
+                                                aipl_image_t* output);
+
+/**
+ * Convert an AIPL_COLOR_TILED image into the row-major layout
+ * using raw pointer interface
+ * using default implementation with compiler imposed optimization
+ *
+ * @param input             input image pointer
+ * @param output            output image pointer
+ * @param pitch             output image pitch
+ * @param width             input image width
+ * @param height            input image height
+ * @param format            image format without the tiled flag
+ * @return error code
+ */
+aipl_error_t aipl_tiled_to_linear_default(const void* input, void* output,
+                                          uint32_t pitch,
+                                          uint32_t width, uint32_t height,
+                                          aipl_color_format_t format);
+
+/**
+ * Convert an AIPL_COLOR_TILED image into the row-major layout
+ * using aipl_image_t interface
+ * using default implementation with compiler imposed optimization
+ *
+ * @param input             input image
+ * @param output            output image with the untiled input format
+ * @return error code
+ */
+aipl_error_t aipl_tiled_to_linear_img_default(const aipl_image_t* input,
+                                              aipl_image_t* output);
+
+/**
+ * Rotate AIPL_COLOR_TILED image
+ * using default implementation with compiler imposed optimization
+ *
+ * @param input             input image pointer
+ * @param output            output image pointer
+ * @param width             input image width
+ * @param height            input image height
+ * @param format            tiled image format
+ * @param rotation          rotation angle
+ * @return error code
+ */
+aipl_error_t aipl_rotate_tiled_default(const void* input, void* output,
+                                       uint32_t width, uint32_t height,
+                                       aipl_color_format_t format,
+                                       aipl_rotation_t rotation);
+
+/**
+ * Flip AIPL_COLOR_TILED image
+ * using default implementation with compiler imposed optimization
+ *
+ * @param input             input image pointer
+ * @param output            output image pointer
+ * @param width             input image width
+ * @param height            input image height
+ * @param format            tiled image format
+ * @param flip_horizontal   flip horizontal
+ * @param flip_vertical     flip vertical
+ * @return error code
+ */
+aipl_error_t aipl_flip_tiled_default(const void* input, void* output,
+                                     uint32_t width, uint32_t height,
+                                     aipl_color_format_t format,
+                                     bool flip_horizontal, bool flip_vertical);
+
+/**
+ * Resize AIPL_COLOR_TILED image
+ * using default implementation with compiler imposed optimization
+ *
+ * @param input             input image pointer
+ * @param output            output image pointer
+ * @param width             input image width
+ * @param height            input image height
+ * @param format            tiled image format
+ * @param output_width      output image width
+ * @param output_height     output image height
+ * @param interpolate       apply bilinear interpolation
+ * @return error code
+ */
+aipl_error_t aipl_resize_tiled_default(const void* input, void* output,
+                                       uint32_t width, uint32_t height,
+                                       aipl_color_format_t format,
+                                       uint32_t output_width,
+                                       uint32_t output_height,
+                                       bool interpolate);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif  /* AIPL_TILED_DEFAULT_H */
@@ -5654,6 +5654,92 @@ aipl_error_t aipl_color_convert_rgb888p_to_rgb565_helium(const void* input,
 #endif
 #endif
 
+/**
+ * Convert Y16 image to I400 by shifting the samples right
+ * using Helium vector acceleration
+ *
+ * @param input         input image pointer
+ * @param output        output image pointer
+ * @param pitch         input image pitch
+ * @param width         image width
+ * @param height        image height
+ * @param shift         right shift of the samples, up to 15
+ * @return error code
+ */
+aipl_error_t aipl_color_convert_y16_to_i400_helium(const void* input,
+                                                   void* output,
+                                                   uint32_t pitch,
+                                                   uint32_t width,
+                                                   uint32_t height,
+                                                   uint8_t shift);
+
+/**
+ * Convert Y16 image to I400 through a lookup table
+ * using Helium vector acceleration
+ *
+ * @param input         input image pointer
+ * @param output        output image pointer
+ * @param pitch         input image pitch
+ * @param width         image width
+ * @param height        image height
+ * @param lut           lookup table of (0xffff >> shift) + 1 entries
+ * @param shift         right shift of the samples before the lookup
+ * @return error code
+ */
+aipl_error_t aipl_color_convert_y16_lut_helium(const void* input,
+                                               void* output,
+                                               uint32_t pitch,
+                                               uint32_t width,
+                                               uint32_t height,
+                                               const uint8_t* lut,
+                                               uint8_t shift);
+
+/**
+ * Convert I400 image to Y16 by shifting the samples left
+ * using Helium vector acceleration
+ *
+ * @param input         input image pointer
+ * @param output        output image pointer
+ * @param pitch         input image pitch
+ * @param width         image width
+ * @param height        image height
+ * @param shift         left shift of the samples, up to 8
+ * @return error code
+ */
+aipl_error_t aipl_color_convert_i400_to_y16_helium(const void* input,
+                                                   void* output,
+                                                   uint32_t pitch,
+                                                   uint32_t width,
+                                                   uint32_t height,
+                                                   uint8_t shift);
+
+/**
+ * Convert ARGB8888 image to a YUV format with the given colorimetry
+ * coefficients using Helium vector acceleration
+ *
+ * Subsampled chroma is the rounded average of each whole 2x2 (4:2:0)
+ * or 2x1 (4:2:2) block, in the plane layout of the dedicated converters.
+ * Other input or output formats return AIPL_ERR_NOT_SUPPORTED
+ *
+ * @param input         input image pointer
+ * @param output        output image pointer
+ * @param pitch         input image pitch
+ * @param width         image width
+ * @param height        image height
+ * @param input_format  input image format, only ARGB8888
+ * @param output_format output image format, YUV formats only
+ * @param coefs         colorimetry coefficients
+ * @return error code
+ */
+aipl_error_t aipl_color_convert_colorimetry_helium(const void* input,
+                                                   void* output,
+                                                   uint32_t pitch,
+                                                   uint32_t width,
+                                                   uint32_t height,
+                                                   aipl_color_format_t input_format,
+                                                   aipl_color_format_t output_format,
+                                                   const aipl_yuv_coefs_t* coefs);
+
 /**********************
  *      MACROS
  **********************/
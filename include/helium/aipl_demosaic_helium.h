@@ -246,6 +246,49 @@ aipl_error_t aipl_demosaic_bgr888_helium(const void* input,
                                          uint32_t height,
                                          aipl_bayer_filter_t filter);
 
+/**
+ * Perform demosaicing on an 8-bit raw image buffer
+ * into RGB888P (planar) image using Helium vector acceleration
+ *
+ * @param input             input raw image pointer
+ * @param output            output RGB888P image pointer
+ * @param pitch             input raw image pitch
+ * @param width             image width
+ * @param height            image height
+ * @param filter            bayer filter
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_rgb888p_helium(const void* input,
+                                          void* output,
+                                          uint32_t pitch,
+                                          uint32_t width,
+                                          uint32_t height,
+                                          aipl_bayer_filter_t filter);
+
+/**
+ * Perform demosaicing on an 8-bit raw image buffer
+ * into separate red, green and blue planes
+ * using Helium vector acceleration
+ *
+ * @param input             input raw image pointer
+ * @param red               output red plane pointer
+ * @param green             output green plane pointer
+ * @param blue              output blue plane pointer
+ * @param pitch             input raw image pitch
+ * @param plane_pitch       red, green and blue output plane pitches
+ *                          in bytes, or NULL for width
+ * @param width             image width
+ * @param height            image height
+ * @param filter            bayer filter
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_planar_helium(const void* input,
+                                         void* red, void* green, void* blue,
+                                         uint32_t pitch,
+                                         const uint32_t plane_pitch[3],
+                                         uint32_t width, uint32_t height,
+                                         aipl_bayer_filter_t filter);
+
 /**
  * Perform demosaicing on an 8-bit raw image buffer
  * into RGB565 image using Helium vector acceleration
@@ -418,6 +461,109 @@ aipl_error_t aipl_demosaic_uyvy_helium(const void* input, void* output,
                                        uint32_t width, uint32_t height,
                                        aipl_bayer_filter_t filter);
 
+/**
+ * Perform demosaicing on an 8-bit raw image buffer
+ * with selectable YUV colorimetry coefficients
+ * using Helium vector acceleration
+ *
+ * @param input             input raw image pointer
+ * @param output            output image pointer
+ * @param pitch             input raw image pitch
+ * @param width             image width
+ * @param height            image height
+ * @param filter            bayer filter
+ * @param format            output image format
+ * @param coefs             YUV colorimetry coefficients
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_colorimetry_helium(const void* input, void* output,
+                                              uint32_t pitch,
+                                              uint32_t width, uint32_t height,
+                                              aipl_bayer_filter_t filter,
+                                              aipl_color_format_t format,
+                                              const aipl_yuv_coefs_t* coefs);
+
+/**
+ * Perform demosaicing on a high bit depth raw image buffer
+ * using Helium vector acceleration
+ *
+ * @param input             input 16-bit raw image pointer
+ * @param output            output image pointer
+ * @param pitch             input raw image pitch in samples
+ * @param width             image width
+ * @param height            image height
+ * @param filter            bayer filter
+ * @param bits              sample bit depth (8 to 16)
+ * @param format            output image format
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_16bit_helium(const void* input, void* output,
+                                        uint32_t pitch,
+                                        uint32_t width, uint32_t height,
+                                        aipl_bayer_filter_t filter,
+                                        uint8_t bits,
+                                        aipl_color_format_t format);
+
+/**
+ * Perform demosaicing on a high bit depth raw image buffer
+ * into interleaved 16-bit R, G and B samples
+ * using Helium vector acceleration
+ *
+ * @param input             input 16-bit raw image pointer
+ * @param output            output 16-bit RGB image pointer
+ * @param pitch             input raw image pitch in samples
+ * @param width             image width
+ * @param height            image height
+ * @param filter            bayer filter
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_16bit_rgb16_helium(const void* input, void* output,
+                                              uint32_t pitch,
+                                              uint32_t width, uint32_t height,
+                                              aipl_bayer_filter_t filter);
+
+/**
+ * Perform demosaicing on an 8-bit raw image buffer with black level
+ * subtraction and lens shading correction
+ * using Helium vector acceleration
+ *
+ * @param input             input raw image pointer
+ * @param output            output image pointer
+ * @param pitch             input raw image pitch
+ * @param width             image width
+ * @param height            image height
+ * @param filter            bayer filter
+ * @param correction        raw sample correction
+ * @param format            output image format
+ * @return error code
+ */
+aipl_error_t aipl_demosaic_corrected_helium(const void* input, void* output,
+                                            uint32_t pitch,
+                                            uint32_t width, uint32_t height,
+                                            aipl_bayer_filter_t filter,
+                                            const aipl_raw_correction_t* correction,
+                                            aipl_color_format_t format);
+
+/**
+ * Apply white balance and digital gain to an 8-bit raw image buffer
+ * using Helium vector acceleration
+ *
+ * @param input             input raw image pointer
+ * @param output            output raw image pointer
+ * @param pitch             input raw image pitch
+ * @param width             image width
+ * @param height            image height
+ * @param gains             gains of the 4 quad positions in raster order
+ * @param clip_highlights   clip the samples to the level where the
+ *                          channel with the smallest gain saturates
+ * @return error code
+ */
+aipl_error_t aipl_raw_white_balance_helium(const void* input, void* output,
+                                           uint32_t pitch,
+                                           uint32_t width, uint32_t height,
+                                           const uint16_t* gains,
+                                           bool clip_highlights);
+
 #endif /* AIPL_HELIUM_ACCELERATION */
 
 /**********************
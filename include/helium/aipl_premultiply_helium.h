@@ -0,0 +1,145 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/******************************************************************************
+ * @file    aipl_premultiply_helium.h
+ * @brief   Helium accelerated premultiplied alpha function definitions
+ *
+******************************************************************************/
+
+#ifndef AIPL_PREMULTIPLY_HELIUM_H
+#define AIPL_PREMULTIPLY_HELIUM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "aipl_color_formats.h"
+#include "aipl_error.h"
+#include "aipl_image.h"
+#include "aipl_config.h"
+
+#ifdef AIPL_HELIUM_ACCELERATION
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+/**
+ * Convert straight alpha ARGB8888 image to PARGB8888
+ * using Helium vector acceleration
+ *
+ * @param input         input image pointer
+ * @param output        output image pointer
+ * @param pitch         input image pitch
+ * @param width         image width
+ * @param height        image height
+ * @return error code
+ */
+aipl_error_t aipl_premultiply_argb8888_helium(const void* input, void* output,
+                                              uint32_t pitch,
+                                              uint32_t width, uint32_t height);
+
+/**
+ * Convert straight alpha RGBA8888 image to PRGBA8888
+ * using Helium vector acceleration
+ *
+ * @param input         input image pointer
+ * @param output        output image pointer
+ * @param pitch         input image pitch
+ * @param width         image width
+ * @param height        image height
+ * @return error code
+ */
+aipl_error_t aipl_premultiply_rgba8888_helium(const void* input, void* output,
+                                              uint32_t pitch,
+                                              uint32_t width, uint32_t height);
+
+/**
+ * Convert straight alpha ARGB4444 image to PARGB4444
+ * using Helium vector acceleration
+ *
+ * @param input         input image pointer
+ * @param output        output image pointer
+ * @param pitch         input image pitch
+ * @param width         image width
+ * @param height        image height
+ * @return error code
+ */
+aipl_error_t aipl_premultiply_argb4444_helium(const void* input, void* output,
+                                              uint32_t pitch,
+                                              uint32_t width, uint32_t height);
+
+/**
+ * Convert premultiplied alpha PARGB8888 image to ARGB8888
+ * using Helium vector acceleration
+ *
+ * @param input         input image pointer
+ * @param output        output image pointer
+ * @param pitch         input image pitch
+ * @param width         image width
+ * @param height        image height
+ * @return error code
+ */
+aipl_error_t aipl_unpremultiply_pargb8888_helium(const void* input, void* output,
+                                                 uint32_t pitch,
+                                                 uint32_t width, uint32_t height);
+
+/**
+ * Convert premultiplied alpha PRGBA8888 image to RGBA8888
+ * using Helium vector acceleration
+ *
+ * @param input         input image pointer
+ * @param output        output image pointer
+ * @param pitch         input image pitch
+ * @param width         image width
+ * @param height        image height
+ * @return error code
+ */
+aipl_error_t aipl_unpremultiply_prgba8888_helium(const void* input, void* output,
+                                                 uint32_t pitch,
+                                                 uint32_t width, uint32_t height);
+
+/**
+ * Convert premultiplied alpha PARGB4444 image to ARGB4444
+ * using Helium vector acceleration
+ *
+ * @param input         input image pointer
+ * @param output        output image pointer
+ * @param pitch         input image pitch
+ * @param width         image width
+ * @param height        image height
+ * @return error code
+ */
+aipl_error_t aipl_unpremultiply_pargb4444_helium(const void* input, void* output,
+                                                 uint32_t pitch,
+                                                 uint32_t width, uint32_t height);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif  /* AIPL_PREMULTIPLY_HELIUM_H */
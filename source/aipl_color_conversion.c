@@ -30,6 +30,8 @@
 #include "aipl_color_conversion_helium.h"
 #endif
 #include "aipl_color_conversion_default.h"
+#include "aipl_color_conversion_generic_default.h"
+#include "aipl_premultiply.h"
 
 /*********************
  *      DEFINES
@@ -42,6 +44,11 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+#if AIPL_CONVERT_GENERIC
+static uint32_t aipl_color_convert_to_bit(aipl_color_format_t format);
+static bool aipl_color_convert_enabled(aipl_color_format_t input_format,
+                                       aipl_color_format_t output_format);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -60,6 +67,13 @@ aipl_error_t aipl_color_convert(const void* input, void* output,
                                 aipl_color_format_t input_format,
                                 aipl_color_format_t output_format)
 {
+    /* Same format is a plain copy, cheaper than a D/AVE2D blit */
+    if (input_format == output_format)
+    {
+        return aipl_color_copy(input, output, pitch,
+                               width, height, input_format);
+    }
+
 #ifdef AIPL_DAVE2D_ACCELERATION
     if (input == NULL || output == NULL)
         return AIPL_ERR_NULL_POINTER;
@@ -75,6 +89,43 @@ aipl_error_t aipl_color_convert(const void* input, void* output,
     }
 #endif
 
+    /* 16-bit luma is windowed to and from 8 bits directly */
+    if (input_format == AIPL_COLOR_Y16 && output_format == AIPL_COLOR_I400)
+    {
+        return aipl_color_convert_y16_to_i400(input, output, pitch,
+                                              width, height,
+                                              AIPL_Y16_BITS - 8);
+    }
+    if (input_format == AIPL_COLOR_I400 && output_format == AIPL_COLOR_Y16)
+    {
+        return aipl_color_convert_i400_to_y16(input, output, pitch,
+                                              width, height,
+                                              AIPL_Y16_BITS - 8);
+    }
+
+    /* Alpha premultiplication within the same layout */
+    if (aipl_color_format_premultiplied(input_format) == output_format
+        && output_format != AIPL_COLOR_UNKNOWN)
+    {
+        return aipl_premultiply(input, output, pitch,
+                                width, height, input_format);
+    }
+    if (aipl_color_format_premultiplied(output_format) == input_format
+        && input_format != AIPL_COLOR_UNKNOWN)
+    {
+        return aipl_unpremultiply(input, output, pitch,
+                                  width, height, input_format);
+    }
+
+#if AIPL_CONVERT_GENERIC
+    if (!aipl_color_convert_enabled(input_format, output_format))
+    {
+        return aipl_color_convert_generic(input, output, pitch,
+                                          width, height,
+                                          input_format, output_format);
+    }
+#endif
+
     switch (input_format)
     {
         /* Alpha color formats */
@@ -205,6 +256,240 @@ aipl_error_t aipl_color_convert_img(const aipl_image_t* input,
                               input->format, output->format);
 }
 
+#if AIPL_CONVERT_GENERIC
+aipl_error_t aipl_color_convert_generic(const void* input, void* output,
+                                        uint32_t pitch,
+                                        uint32_t width, uint32_t height,
+                                        aipl_color_format_t input_format,
+                                        aipl_color_format_t output_format)
+{
+    const aipl_yuv_coefs_t* coefs =
+        aipl_colorimetry_coefs(AIPL_COLORIMETRY_BT601_LIMITED);
+
+    return aipl_color_convert_generic_default(input, output, pitch,
+                                              width, height,
+                                              input_format, output_format,
+                                              coefs);
+}
+#endif
+
+aipl_error_t aipl_color_convert_colorimetry(const void* input, void* output,
+                                            uint32_t pitch,
+                                            uint32_t width, uint32_t height,
+                                            aipl_color_format_t input_format,
+                                            aipl_color_format_t output_format,
+                                            aipl_colorimetry_t colorimetry)
+{
+    const aipl_yuv_coefs_t* coefs = aipl_colorimetry_coefs(colorimetry);
+
+    if (coefs == NULL)
+        return AIPL_ERR_NOT_SUPPORTED;
+
+    /* The coefficients only matter when crossing between RGB and YUV */
+    if (colorimetry == AIPL_COLORIMETRY_BT601_LIMITED
+        || aipl_color_format_space(input_format)
+           == aipl_color_format_space(output_format))
+    {
+        return aipl_color_convert(input, output, pitch,
+                                  width, height,
+                                  input_format, output_format);
+    }
+
+#ifdef AIPL_HELIUM_ACCELERATION
+    /* The Helium kernel covers ARGB8888 to YUV,
+       the other pairs take the generic engine */
+    aipl_error_t ret = aipl_color_convert_colorimetry_helium(input, output,
+                                                             pitch,
+                                                             width, height,
+                                                             input_format,
+                                                             output_format,
+                                                             coefs);
+    if (ret != AIPL_ERR_NOT_SUPPORTED)
+        return ret;
+#endif
+
+#if AIPL_CONVERT_GENERIC
+    return aipl_color_convert_generic_default(input, output, pitch,
+                                              width, height,
+                                              input_format, output_format,
+                                              coefs);
+#else
+    return AIPL_ERR_NOT_SUPPORTED;
+#endif
+}
+
+aipl_error_t aipl_color_convert_colorimetry_img(const aipl_image_t* input,
+                                                aipl_image_t* output,
+                                                aipl_colorimetry_t colorimetry)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    if (input->width != output->width || input->height != output->height)
+    {
+        return AIPL_ERR_SIZE_MISMATCH;
+    }
+
+    return aipl_color_convert_colorimetry(input->data, output->data,
+                                          input->pitch,
+                                          input->width, input->height,
+                                          input->format, output->format,
+                                          colorimetry);
+}
+
+aipl_error_t aipl_color_convert_multi(const void* input,
+                                      uint32_t pitch,
+                                      uint32_t width, uint32_t height,
+                                      aipl_color_format_t input_format,
+                                      const aipl_color_output_t* outputs,
+                                      uint32_t output_num)
+{
+    if (input == NULL || outputs == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    if (output_num == 0 || output_num > AIPL_CONVERT_MULTI_MAX)
+        return AIPL_ERR_NOT_SUPPORTED;
+
+#if AIPL_CONVERT_GENERIC
+    /* A single pass only pays off when some output
+       would otherwise take the generic engine anyway */
+    for (uint32_t i = 0; i < output_num; ++i)
+    {
+        if (!aipl_color_convert_enabled(input_format, outputs[i].format))
+        {
+            const aipl_yuv_coefs_t* coefs =
+                aipl_colorimetry_coefs(AIPL_COLORIMETRY_BT601_LIMITED);
+
+            return aipl_color_convert_multi_generic_default(input, pitch,
+                                                            width, height,
+                                                            input_format,
+                                                            outputs,
+                                                            output_num,
+                                                            coefs);
+        }
+    }
+#endif
+
+    for (uint32_t i = 0; i < output_num; ++i)
+    {
+        aipl_error_t ret = aipl_color_convert(input, outputs[i].data, pitch,
+                                              width, height, input_format,
+                                              outputs[i].format);
+
+        if (ret != AIPL_ERR_OK)
+            return ret;
+    }
+
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_color_convert_multi_img(const aipl_image_t* input,
+                                          aipl_image_t* outputs,
+                                          uint32_t output_num)
+{
+    if (input == NULL || outputs == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    if (output_num > AIPL_CONVERT_MULTI_MAX)
+        return AIPL_ERR_NOT_SUPPORTED;
+
+    aipl_color_output_t outs[AIPL_CONVERT_MULTI_MAX];
+
+    for (uint32_t i = 0; i < output_num; ++i)
+    {
+        if (input->width != outputs[i].width
+            || input->height != outputs[i].height)
+        {
+            return AIPL_ERR_SIZE_MISMATCH;
+        }
+
+        outs[i].data = outputs[i].data;
+        outs[i].format = outputs[i].format;
+    }
+
+    return aipl_color_convert_multi(input->data, input->pitch,
+                                    input->width, input->height,
+                                    input->format, outs, output_num);
+}
+
+aipl_error_t aipl_color_copy(const void* input, void* output,
+                             uint32_t pitch,
+                             uint32_t width, uint32_t height,
+                             aipl_color_format_t format)
+{
+    return aipl_color_copy_default(input, output, pitch,
+                                   width, height, format);
+}
+
+aipl_error_t aipl_color_copy_img(const aipl_image_t* input,
+                                 aipl_image_t* output)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    if (input->width != output->width || input->height != output->height)
+    {
+        return AIPL_ERR_SIZE_MISMATCH;
+    }
+
+    if (input->format != output->format)
+    {
+        return AIPL_ERR_FORMAT_MISMATCH;
+    }
+
+    return aipl_color_copy(input->data, output->data, input->pitch,
+                           input->width, input->height, input->format);
+}
+
+aipl_error_t aipl_color_convert_y16_to_i400(const void* input,
+                                            void* output,
+                                            uint32_t pitch,
+                                            uint32_t width,
+                                            uint32_t height,
+                                            uint8_t shift)
+{
+#ifdef AIPL_HELIUM_ACCELERATION
+    return aipl_color_convert_y16_to_i400_helium(input, output, pitch,
+                                                 width, height, shift);
+#else
+    return aipl_color_convert_y16_to_i400_default(input, output, pitch,
+                                                  width, height, shift);
+#endif
+}
+
+aipl_error_t aipl_color_convert_y16_lut(const void* input,
+                                        void* output,
+                                        uint32_t pitch,
+                                        uint32_t width,
+                                        uint32_t height,
+                                        const uint8_t* lut,
+                                        uint8_t shift)
+{
+#ifdef AIPL_HELIUM_ACCELERATION
+    return aipl_color_convert_y16_lut_helium(input, output, pitch,
+                                             width, height, lut, shift);
+#else
+    return aipl_color_convert_y16_lut_default(input, output, pitch,
+                                              width, height, lut, shift);
+#endif
+}
+
+aipl_error_t aipl_color_convert_i400_to_y16(const void* input,
+                                            void* output,
+                                            uint32_t pitch,
+                                            uint32_t width,
+                                            uint32_t height,
+                                            uint8_t shift)
+{
+#ifdef AIPL_HELIUM_ACCELERATION
+    return aipl_color_convert_i400_to_y16_helium(input, output, pitch,
+                                                 width, height, shift);
+#else
+    return aipl_color_convert_i400_to_y16_default(input, output, pitch,
+                                                  width, height, shift);
+#endif
+}
+
 #if AIPL_CONVERT_ALPHA8_I400
 aipl_error_t aipl_color_convert_alpha8(const void* input, void* output,
                                        uint32_t pitch,
@@ -229,7 +514,8 @@ aipl_error_t aipl_color_convert_alpha8(const void* input, void* output,
     switch (format)
     {
         case AIPL_COLOR_ALPHA8:
-            return AIPL_ERR_FORMAT_MISMATCH;
+            return aipl_color_copy(input, output, pitch,
+                                   width, height, AIPL_COLOR_ALPHA8);
 
         case AIPL_COLOR_I400:
             return aipl_color_convert_alpha8_to_i400(input, output, pitch,
@@ -613,7 +899,8 @@ aipl_error_t aipl_color_convert_argb8888(const void* input, void* output,
 #endif
         /* RGB color formats */
         case AIPL_COLOR_ARGB8888:
-            return AIPL_ERR_FORMAT_MISMATCH;
+            return aipl_color_copy(input, output, pitch,
+                                   width, height, AIPL_COLOR_ARGB8888);
 #if (AIPL_CONVERT_ARGB8888 & TO_RGBA8888)
         case AIPL_COLOR_RGBA8888:
             return aipl_color_convert_argb8888_to_rgba8888(input, output,
@@ -718,7 +1005,13 @@ aipl_error_t aipl_color_convert_argb8888(const void* input, void* output,
 #endif
 
         default:
+#if AIPL_CONVERT_GENERIC
+            return aipl_color_convert_generic(input, output, pitch,
+                                              width, height,
+                                              AIPL_COLOR_ARGB8888, format);
+#else
             return AIPL_ERR_UNSUPPORTED_FORMAT;
+#endif
     }
 }
 
@@ -1151,7 +1444,8 @@ aipl_error_t aipl_color_convert_argb4444(const void* input, void* output,
                                                            width, height);
 #endif
         case AIPL_COLOR_ARGB4444:
-            return AIPL_ERR_FORMAT_MISMATCH;
+            return aipl_color_copy(input, output, pitch,
+                                   width, height, AIPL_COLOR_ARGB4444);
 #if (AIPL_CONVERT_ARGB4444 & TO_ARGB1555)
         case AIPL_COLOR_ARGB1555:
             return aipl_color_convert_argb4444_to_argb1555(input, output,
@@ -1245,7 +1539,13 @@ aipl_error_t aipl_color_convert_argb4444(const void* input, void* output,
 #endif
 
         default:
+#if AIPL_CONVERT_GENERIC
+            return aipl_color_convert_generic(input, output, pitch,
+                                              width, height,
+                                              AIPL_COLOR_ARGB4444, format);
+#else
             return AIPL_ERR_UNSUPPORTED_FORMAT;
+#endif
     }
 }
 
@@ -1666,7 +1966,8 @@ aipl_error_t aipl_color_convert_argb1555(const void* input, void* output,
                                                            width, height);
 #endif
         case AIPL_COLOR_ARGB1555:
-            return AIPL_ERR_FORMAT_MISMATCH;
+            return aipl_color_copy(input, output, pitch,
+                                   width, height, AIPL_COLOR_ARGB1555);
 #if (AIPL_CONVERT_ARGB1555 & TO_RGBA4444)
         case AIPL_COLOR_RGBA4444:
             return aipl_color_convert_argb1555_to_rgba4444(input, output,
@@ -1754,7 +2055,13 @@ aipl_error_t aipl_color_convert_argb1555(const void* input, void* output,
 #endif
 
         default:
+#if AIPL_CONVERT_GENERIC
+            return aipl_color_convert_generic(input, output, pitch,
+                                              width, height,
+                                              AIPL_COLOR_ARGB1555, format);
+#else
             return AIPL_ERR_UNSUPPORTED_FORMAT;
+#endif
     }
 }
 
@@ -2157,7 +2464,8 @@ aipl_error_t aipl_color_convert_rgba8888(const void* input, void* output,
                                                            width, height);
 #endif
         case AIPL_COLOR_RGBA8888:
-            return AIPL_ERR_FORMAT_MISMATCH;
+            return aipl_color_copy(input, output, pitch,
+                                   width, height, AIPL_COLOR_RGBA8888);
 #if (AIPL_CONVERT_RGBA8888 & TO_ARGB4444)
         case AIPL_COLOR_ARGB4444:
             return aipl_color_convert_rgba8888_to_argb4444(input, output,
@@ -2257,7 +2565,13 @@ aipl_error_t aipl_color_convert_rgba8888(const void* input, void* output,
 #endif
 
         default:
+#if AIPL_CONVERT_GENERIC
+            return aipl_color_convert_generic(input, output, pitch,
+                                              width, height,
+                                              AIPL_COLOR_RGBA8888, format);
+#else
             return AIPL_ERR_UNSUPPORTED_FORMAT;
+#endif
     }
 }
 
@@ -2702,7 +3016,8 @@ aipl_error_t aipl_color_convert_rgba4444(const void* input, void* output,
                                                            width, height);
 #endif
         case AIPL_COLOR_RGBA4444:
-            return AIPL_ERR_FORMAT_MISMATCH;
+            return aipl_color_copy(input, output, pitch,
+                                   width, height, AIPL_COLOR_RGBA4444);
 #if (AIPL_CONVERT_RGBA4444 & TO_RGBA5551)
         case AIPL_COLOR_RGBA5551:
             return aipl_color_convert_rgba4444_to_rgba5551(input, output,
@@ -2784,7 +3099,13 @@ aipl_error_t aipl_color_convert_rgba4444(const void* input, void* output,
 #endif
 
         default:
+#if AIPL_CONVERT_GENERIC
+            return aipl_color_convert_generic(input, output, pitch,
+                                              width, height,
+                                              AIPL_COLOR_RGBA4444, format);
+#else
             return AIPL_ERR_UNSUPPORTED_FORMAT;
+#endif
     }
 }
 
@@ -3217,7 +3538,8 @@ aipl_error_t aipl_color_convert_rgba5551(const void* input, void* output,
                                                            width, height);
 #endif
         case AIPL_COLOR_RGBA5551:
-            return AIPL_ERR_FORMAT_MISMATCH;
+            return aipl_color_copy(input, output, pitch,
+                                   width, height, AIPL_COLOR_RGBA5551);
 #if (AIPL_CONVERT_RGBA5551 & TO_RGB565)
         case AIPL_COLOR_RGB565:
             return aipl_color_convert_rgba5551_to_rgb565(input, output,
@@ -3293,7 +3615,13 @@ aipl_error_t aipl_color_convert_rgba5551(const void* input, void* output,
 #endif
 
         default:
+#if AIPL_CONVERT_GENERIC
+            return aipl_color_convert_generic(input, output, pitch,
+                                              width, height,
+                                              AIPL_COLOR_RGBA5551, format);
+#else
             return AIPL_ERR_UNSUPPORTED_FORMAT;
+#endif
     }
 }
 
@@ -3717,7 +4045,8 @@ aipl_error_t aipl_color_convert_bgr888(const void* input, void* output,
                                                        width, height);
 #endif
         case AIPL_COLOR_BGR888:
-            return AIPL_ERR_FORMAT_MISMATCH;
+            return aipl_color_copy(input, output, pitch,
+                                   width, height, AIPL_COLOR_BGR888);
 #if (AIPL_CONVERT_BGR888 & TO_RGB888)
         case AIPL_COLOR_RGB888:
             return aipl_color_convert_bgr888_to_rgb888(input, output,
@@ -3781,7 +4110,13 @@ aipl_error_t aipl_color_convert_bgr888(const void* input, void* output,
 #endif
 
         default:
+#if AIPL_CONVERT_GENERIC
+            return aipl_color_convert_generic(input, output, pitch,
+                                              width, height,
+                                              AIPL_COLOR_BGR888, format);
+#else
             return AIPL_ERR_UNSUPPORTED_FORMAT;
+#endif
     }
 }
 
@@ -4187,7 +4522,8 @@ aipl_error_t aipl_color_convert_rgb888(const void* input, void* output,
                                                        width, height);
 #endif
         case AIPL_COLOR_RGB888:
-            return AIPL_ERR_FORMAT_MISMATCH;
+            return aipl_color_copy(input, output, pitch,
+                                   width, height, AIPL_COLOR_RGB888);
 #if (AIPL_CONVERT_RGB888 & TO_BGR888)
         case AIPL_COLOR_BGR888:
             return aipl_color_convert_rgb888_to_bgr888(input, output,
@@ -4251,7 +4587,13 @@ aipl_error_t aipl_color_convert_rgb888(const void* input, void* output,
 #endif
 
         default:
+#if AIPL_CONVERT_GENERIC
+            return aipl_color_convert_generic(input, output, pitch,
+                                              width, height,
+                                              AIPL_COLOR_RGB888, format);
+#else
             return AIPL_ERR_UNSUPPORTED_FORMAT;
+#endif
     }
 }
 
@@ -4666,7 +5008,8 @@ aipl_error_t aipl_color_convert_rgb565(const void* input, void* output,
                                                          width, height);
 #endif
         case AIPL_COLOR_RGB565:
-            return AIPL_ERR_FORMAT_MISMATCH;
+            return aipl_color_copy(input, output, pitch,
+                                   width, height, AIPL_COLOR_RGB565);
 #if (AIPL_CONVERT_RGB565 & TO_BGR888)
         case AIPL_COLOR_BGR888:
             return aipl_color_convert_rgb565_to_bgr888(input, output,
@@ -4736,7 +5079,13 @@ aipl_error_t aipl_color_convert_rgb565(const void* input, void* output,
 #endif
 
         default:
+#if AIPL_CONVERT_GENERIC
+            return aipl_color_convert_generic(input, output, pitch,
+                                              width, height,
+                                              AIPL_COLOR_RGB565, format);
+#else
             return AIPL_ERR_UNSUPPORTED_FORMAT;
+#endif
     }
 }
 
@@ -5161,7 +5510,8 @@ aipl_error_t aipl_color_convert_yv12(const void* input, void* output,
 #endif
         /* YUV color formats */
         case AIPL_COLOR_YV12:
-            return AIPL_ERR_FORMAT_MISMATCH;
+            return aipl_color_copy(input, output, pitch,
+                                   width, height, AIPL_COLOR_YV12);
 #if (AIPL_CONVERT_YV12 & TO_I420)
         case AIPL_COLOR_I420:
             return aipl_color_convert_yv12_to_i420(input, output,
@@ -5212,7 +5562,13 @@ aipl_error_t aipl_color_convert_yv12(const void* input, void* output,
 #endif
 
         default:
+#if AIPL_CONVERT_GENERIC
+            return aipl_color_convert_generic(input, output, pitch,
+                                              width, height,
+                                              AIPL_COLOR_YV12, format);
+#else
             return AIPL_ERR_UNSUPPORTED_FORMAT;
+#endif
     }
 }
 
@@ -5601,7 +5957,8 @@ aipl_error_t aipl_color_convert_i420(const void* input, void* output,
                                                    width, height);
 #endif
         case AIPL_COLOR_I420:
-            return AIPL_ERR_FORMAT_MISMATCH;
+            return aipl_color_copy(input, output, pitch,
+                                   width, height, AIPL_COLOR_I420);
 #if (AIPL_CONVERT_I420 & TO_NV12)
         case AIPL_COLOR_NV12:
             return aipl_color_convert_i420_to_nv12(input, output,
@@ -5646,7 +6003,13 @@ aipl_error_t aipl_color_convert_i420(const void* input, void* output,
 #endif
 
         default:
+#if AIPL_CONVERT_GENERIC
+            return aipl_color_convert_generic(input, output, pitch,
+                                              width, height,
+                                              AIPL_COLOR_I420, format);
+#else
             return AIPL_ERR_UNSUPPORTED_FORMAT;
+#endif
     }
 }
 
@@ -6053,7 +6416,8 @@ aipl_error_t aipl_color_convert_i422(const void* input, void* output,
                                                    width, height);
 #endif
         case AIPL_COLOR_I422:
-            return AIPL_ERR_FORMAT_MISMATCH;
+            return aipl_color_copy(input, output, pitch,
+                                   width, height, AIPL_COLOR_I422);
 #if (AIPL_CONVERT_I422 & TO_YUY2)
         case AIPL_COLOR_YUY2:
             return aipl_color_convert_i422_to_yuy2(input, output,
@@ -6080,7 +6444,13 @@ aipl_error_t aipl_color_convert_i422(const void* input, void* output,
 #endif
 
         default:
+#if AIPL_CONVERT_GENERIC
+            return aipl_color_convert_generic(input, output, pitch,
+                                              width, height,
+                                              AIPL_COLOR_I422, format);
+#else
             return AIPL_ERR_UNSUPPORTED_FORMAT;
+#endif
     }
 }
 
@@ -6517,7 +6887,8 @@ aipl_error_t aipl_color_convert_i444(const void* input, void* output,
                                                    width, height);
 #endif
         case AIPL_COLOR_I444:
-            return AIPL_ERR_FORMAT_MISMATCH;
+            return aipl_color_copy(input, output, pitch,
+                                   width, height, AIPL_COLOR_I444);
 #if (AIPL_CONVERT_I444 & TO_ALPHA8_I400)
         case AIPL_COLOR_I400:
             return aipl_color_convert_i444_to_i400(input, output,
@@ -6526,7 +6897,13 @@ aipl_error_t aipl_color_convert_i444(const void* input, void* output,
 #endif
 
         default:
+#if AIPL_CONVERT_GENERIC
+            return aipl_color_convert_generic(input, output, pitch,
+                                              width, height,
+                                              AIPL_COLOR_I444, format);
+#else
             return AIPL_ERR_UNSUPPORTED_FORMAT;
+#endif
     }
 }
 
@@ -6933,7 +7310,8 @@ aipl_error_t aipl_color_convert_nv12(const void* input, void* output,
                                                    width, height);
 #endif
         case AIPL_COLOR_NV12:
-            return AIPL_ERR_FORMAT_MISMATCH;
+            return aipl_color_copy(input, output, pitch,
+                                   width, height, AIPL_COLOR_NV12);
 #if (AIPL_CONVERT_NV12 & TO_NV21)
         case AIPL_COLOR_NV21:
             return aipl_color_convert_nv12_to_nv21(input, output,
@@ -6972,7 +7350,13 @@ aipl_error_t aipl_color_convert_nv12(const void* input, void* output,
 #endif
 
         default:
+#if AIPL_CONVERT_GENERIC
+            return aipl_color_convert_generic(input, output, pitch,
+                                              width, height,
+                                              AIPL_COLOR_NV12, format);
+#else
             return AIPL_ERR_UNSUPPORTED_FORMAT;
+#endif
     }
 }
 
@@ -7367,7 +7751,8 @@ aipl_error_t aipl_color_convert_nv21(const void* input, void* output,
                                                    width, height);
 #endif
         case AIPL_COLOR_NV21:
-            return AIPL_ERR_FORMAT_MISMATCH;
+            return aipl_color_copy(input, output, pitch,
+                                   width, height, AIPL_COLOR_NV21);
 #if (AIPL_CONVERT_NV21 & TO_NV12)
         case AIPL_COLOR_NV12:
             return aipl_color_convert_nv21_to_nv12(input, output,
@@ -7406,7 +7791,13 @@ aipl_error_t aipl_color_convert_nv21(const void* input, void* output,
 #endif
 
         default:
+#if AIPL_CONVERT_GENERIC
+            return aipl_color_convert_generic(input, output, pitch,
+                                              width, height,
+                                              AIPL_COLOR_NV21, format);
+#else
             return AIPL_ERR_UNSUPPORTED_FORMAT;
+#endif
     }
 }
 
@@ -7819,7 +8210,8 @@ aipl_error_t aipl_color_convert_yuy2(const void* input, void* output,
                                                    width, height);
 #endif
         case AIPL_COLOR_YUY2:
-            return AIPL_ERR_FORMAT_MISMATCH;
+            return aipl_color_copy(input, output, pitch,
+                                   width, height, AIPL_COLOR_YUY2);
 #if (AIPL_CONVERT_YUY2 & TO_UYVY)
         case AIPL_COLOR_UYVY:
             return aipl_color_convert_yuy2_to_uyvy(input, output,
@@ -7840,7 +8232,13 @@ aipl_error_t aipl_color_convert_yuy2(const void* input, void* output,
 #endif
 
         default:
+#if AIPL_CONVERT_GENERIC
+            return aipl_color_convert_generic(input, output, pitch,
+                                              width, height,
+                                              AIPL_COLOR_YUY2, format);
+#else
             return AIPL_ERR_UNSUPPORTED_FORMAT;
+#endif
     }
 }
 
@@ -8283,7 +8681,8 @@ aipl_error_t aipl_color_convert_uyvy(const void* input, void* output,
                                                    width, height);
 #endif
         case AIPL_COLOR_UYVY:
-            return AIPL_ERR_FORMAT_MISMATCH;
+            return aipl_color_copy(input, output, pitch,
+                                   width, height, AIPL_COLOR_UYVY);
 #if (AIPL_CONVERT_UYVY & TO_YUY2)
         case AIPL_COLOR_YUY2:
             return aipl_color_convert_uyvy_to_yuy2(input, output,
@@ -8304,7 +8703,13 @@ aipl_error_t aipl_color_convert_uyvy(const void* input, void* output,
 #endif
 
         default:
+#if AIPL_CONVERT_GENERIC
+            return aipl_color_convert_generic(input, output, pitch,
+                                              width, height,
+                                              AIPL_COLOR_UYVY, format);
+#else
             return AIPL_ERR_UNSUPPORTED_FORMAT;
+#endif
     }
 }
 
@@ -8763,10 +9168,17 @@ aipl_error_t aipl_color_convert_i400(const void* input, void* output,
                                                    width, height);
 #endif
         case AIPL_COLOR_I400:
-            return AIPL_ERR_FORMAT_MISMATCH;
+            return aipl_color_copy(input, output, pitch,
+                                   width, height, AIPL_COLOR_I400);
 
         default:
+#if AIPL_CONVERT_GENERIC
+            return aipl_color_convert_generic(input, output, pitch,
+                                              width, height,
+                                              AIPL_COLOR_I400, format);
+#else
             return AIPL_ERR_UNSUPPORTED_FORMAT;
+#endif
     }
 }
 
@@ -9091,10 +9503,17 @@ aipl_error_t aipl_color_convert_rgb888p(const void* input, void* output,
                                                         width, height);
 #endif
         case AIPL_COLOR_RGB888P:
-            return AIPL_ERR_FORMAT_MISMATCH;
+            return aipl_color_copy(input, output, pitch,
+                                   width, height, AIPL_COLOR_RGB888P);
 
         default:
+#if AIPL_CONVERT_GENERIC
+            return aipl_color_convert_generic(input, output, pitch,
+                                              width, height,
+                                              AIPL_COLOR_RGB888P, format);
+#else
             return AIPL_ERR_UNSUPPORTED_FORMAT;
+#endif
     }
 }
 
@@ -9142,3 +9561,90 @@ aipl_error_t aipl_color_convert_rgb888p_to_rgb565(const void* input,
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+#if AIPL_CONVERT_GENERIC
+static uint32_t aipl_color_convert_to_bit(aipl_color_format_t format)
+{
+    switch (format)
+    {
+        case AIPL_COLOR_ALPHA8:
+        case AIPL_COLOR_I400:
+            return TO_ALPHA8_I400;
+        case AIPL_COLOR_ARGB8888:
+            return TO_ARGB8888;
+        case AIPL_COLOR_ARGB4444:
+            return TO_ARGB4444;
+        case AIPL_COLOR_ARGB1555:
+            return TO_ARGB1555;
+        case AIPL_COLOR_RGBA8888:
+            return TO_RGBA8888;
+        case AIPL_COLOR_RGBA4444:
+            return TO_RGBA4444;
+        case AIPL_COLOR_RGBA5551:
+            return TO_RGBA5551;
+        case AIPL_COLOR_BGR888:
+            return TO_BGR888;
+        case AIPL_COLOR_RGB888:
+            return TO_RGB888;
+        case AIPL_COLOR_RGB888P:
+            return TO_RGB888P;
+        case AIPL_COLOR_RGB565:
+            return TO_RGB565;
+        case AIPL_COLOR_YV12:
+            return TO_YV12;
+        case AIPL_COLOR_I420:
+            return TO_I420;
+        case AIPL_COLOR_I422:
+            return TO_I422;
+        case AIPL_COLOR_I444:
+            return TO_I444;
+        case AIPL_COLOR_NV21:
+            return TO_NV21;
+        case AIPL_COLOR_NV12:
+            return TO_NV12;
+        case AIPL_COLOR_YUY2:
+            return TO_YUY2;
+        case AIPL_COLOR_UYVY:
+            return TO_UYVY;
+        default:
+            return 0;
+    }
+}
+
+static bool aipl_color_convert_enabled(aipl_color_format_t input_format,
+                                       aipl_color_format_t output_format)
+{
+    /* Conversions enabled in the configuration, indexed by input format */
+    static const uint32_t enabled[AIPL_COLOR_NUM] = {
+        [AIPL_COLOR_ALPHA8] = AIPL_CONVERT_ALPHA8_I400,
+        [AIPL_COLOR_ARGB8888] = AIPL_CONVERT_ARGB8888,
+        [AIPL_COLOR_ARGB4444] = AIPL_CONVERT_ARGB4444,
+        [AIPL_COLOR_ARGB1555] = AIPL_CONVERT_ARGB1555,
+        [AIPL_COLOR_RGBA8888] = AIPL_CONVERT_RGBA8888,
+        [AIPL_COLOR_RGBA4444] = AIPL_CONVERT_RGBA4444,
+        [AIPL_COLOR_RGBA5551] = AIPL_CONVERT_RGBA5551,
+        [AIPL_COLOR_BGR888] = AIPL_CONVERT_BGR888,
+        [AIPL_COLOR_RGB888] = AIPL_CONVERT_RGB888,
+        [AIPL_COLOR_RGB888P] = AIPL_CONVERT_RGB888P,
+        [AIPL_COLOR_RGB565] = AIPL_CONVERT_RGB565,
+        [AIPL_COLOR_YV12] = AIPL_CONVERT_YV12,
+        [AIPL_COLOR_I420] = AIPL_CONVERT_I420,
+        [AIPL_COLOR_I422] = AIPL_CONVERT_I422,
+        [AIPL_COLOR_I444] = AIPL_CONVERT_I444,
+        [AIPL_COLOR_I400] = AIPL_CONVERT_ALPHA8_I400,
+        [AIPL_COLOR_NV21] = AIPL_CONVERT_NV21,
+        [AIPL_COLOR_NV12] = AIPL_CONVERT_NV12,
+        [AIPL_COLOR_YUY2] = AIPL_CONVERT_YUY2,
+        [AIPL_COLOR_UYVY] = AIPL_CONVERT_UYVY,
+    };
+
+    /* Unknown formats and the pairs handled without
+       a converter keep their dedicated paths */
+    if (input_format >= AIPL_COLOR_NUM || input_format == output_format)
+        return true;
+
+    if (input_format == AIPL_COLOR_ALPHA8 && output_format == AIPL_COLOR_I400)
+        return true;
+
+    return (enabled[input_format] & aipl_color_convert_to_bit(output_format)) != 0;
+}
+#endif
@@ -19,6 +19,8 @@
  *********************/
 #include "aipl_color_formats.h"
 
+#include <stddef.h>
+
 /*********************
  *      DEFINES
  *********************/
@@ -34,6 +36,48 @@
 /**********************
  *  STATIC VARIABLES
  **********************/
+/* Full range chroma rows are scaled by 127/128 to keep U and V within
+   8 bits, the chroma terms of the inverse are scaled by 128/127 back */
+static const aipl_yuv_coefs_t aipl_yuv_coefs[AIPL_COLORIMETRY_NUM] = {
+    [AIPL_COLORIMETRY_BT601_LIMITED] = {
+        .y_red = AIPL_YUV_Y_8BIT_RED_MULTIPLIER,
+        .y_green = AIPL_YUV_Y_8BIT_GREEN_MULTIPLIER,
+        .y_blue = AIPL_YUV_Y_8BIT_BLUE_MULTIPLIER,
+        .u_red = AIPL_YUV_U_8BIT_RED_MULTIPLIER,
+        .u_green = AIPL_YUV_U_8BIT_GREEN_MULTIPLIER,
+        .u_blue = AIPL_YUV_U_8BIT_BLUE_MULTIPLIER,
+        .v_red = AIPL_YUV_V_8BIT_RED_MULTIPLIER,
+        .v_green = AIPL_YUV_V_8BIT_GREEN_MULTIPLIER,
+        .v_blue = AIPL_YUV_V_8BIT_BLUE_MULTIPLIER,
+        .y_offset = 16,
+        .c = AIPL_YUV_C_MULTIPLIER,
+        .red_e = AIPL_YUV_RED_E_MULTIPLIER,
+        .green_d = AIPL_YUV_GREEN_D_MULTIPLIER,
+        .green_e = AIPL_YUV_GREEN_E_MULTIPLIER,
+        .blue_d = AIPL_YUV_BLUE_D_MULTIPLIER
+    },
+    [AIPL_COLORIMETRY_BT601_FULL] = {
+        .y_red = 77, .y_green = 150, .y_blue = 29,
+        .u_red = -43, .u_green = -84, .u_blue = 127,
+        .v_red = 127, .v_green = -106, .v_blue = -21,
+        .y_offset = 0,
+        .c = 256, .red_e = 362, .green_d = -89, .green_e = -184, .blue_d = 457
+    },
+    [AIPL_COLORIMETRY_BT709_LIMITED] = {
+        .y_red = 47, .y_green = 157, .y_blue = 16,
+        .u_red = -26, .u_green = -86, .u_blue = 112,
+        .v_red = 112, .v_green = -102, .v_blue = -10,
+        .y_offset = 16,
+        .c = 298, .red_e = 459, .green_d = -55, .green_e = -136, .blue_d = 541
+    },
+    [AIPL_COLORIMETRY_BT709_FULL] = {
+        .y_red = 54, .y_green = 183, .y_blue = 19,
+        .u_red = -29, .u_green = -98, .u_blue = 127,
+        .v_red = 127, .v_green = -115, .v_blue = -12,
+        .y_offset = 0,
+        .c = 256, .red_e = 406, .green_d = -48, .green_e = -121, .blue_d = 479
+    },
+};
 
 /**********************
  *      MACROS
@@ -55,6 +99,12 @@ aipl_color_space_t aipl_color_format_space(aipl_color_format_t format)
         case AIPL_COLOR_ARGB1555:
         case AIPL_COLOR_RGBA4444:
         case AIPL_COLOR_RGBA5551:
+        case AIPL_COLOR_BGRA8888:
+        case AIPL_COLOR_ABGR8888:
+        case AIPL_COLOR_XRGB8888:
+        case AIPL_COLOR_PARGB8888:
+        case AIPL_COLOR_PRGBA8888:
+        case AIPL_COLOR_PARGB4444:
         case AIPL_COLOR_RGB565:
         case AIPL_COLOR_RGB888:
         case AIPL_COLOR_RGB888P:
@@ -71,6 +121,9 @@ aipl_color_space_t aipl_color_format_space(aipl_color_format_t format)
         case AIPL_COLOR_UYVY:
         case AIPL_COLOR_I444:
         case AIPL_COLOR_I400:
+        case AIPL_COLOR_Y16:
+        case AIPL_COLOR_NV16:
+        case AIPL_COLOR_NV61:
             return AIPL_SPACE_YUV;
 
         default:
@@ -89,8 +142,14 @@ uint8_t aipl_color_format_depth(aipl_color_format_t format)
         /* RGB color formats */
         case AIPL_COLOR_ARGB8888:
         case AIPL_COLOR_RGBA8888:
+        case AIPL_COLOR_BGRA8888:
+        case AIPL_COLOR_ABGR8888:
+        case AIPL_COLOR_XRGB8888:
+        case AIPL_COLOR_PARGB8888:
+        case AIPL_COLOR_PRGBA8888:
             return 32;
         case AIPL_COLOR_ARGB4444:
+        case AIPL_COLOR_PARGB4444:
         case AIPL_COLOR_ARGB1555:
         case AIPL_COLOR_RGBA4444:
         case AIPL_COLOR_RGBA5551:
@@ -108,8 +167,11 @@ uint8_t aipl_color_format_depth(aipl_color_format_t format)
         case AIPL_COLOR_NV21:
             return 12;
         case AIPL_COLOR_I422:
+        case AIPL_COLOR_NV16:
+        case AIPL_COLOR_NV61:
         case AIPL_COLOR_YUY2:
         case AIPL_COLOR_UYVY:
+        case AIPL_COLOR_Y16:
             return 16;
         case AIPL_COLOR_I444:
             return 24;
@@ -141,6 +203,18 @@ const char* aipl_color_format_str(aipl_color_format_t format)
             return "RGBA4444";
         case AIPL_COLOR_RGBA5551:
             return "RGBA5551";
+        case AIPL_COLOR_BGRA8888:
+            return "BGRA8888";
+        case AIPL_COLOR_ABGR8888:
+            return "ABGR8888";
+        case AIPL_COLOR_XRGB8888:
+            return "XRGB8888";
+        case AIPL_COLOR_PARGB8888:
+            return "PARGB8888";
+        case AIPL_COLOR_PRGBA8888:
+            return "PRGBA8888";
+        case AIPL_COLOR_PARGB4444:
+            return "PARGB4444";
         case AIPL_COLOR_RGB888:
             return "RGB888";
         case AIPL_COLOR_RGB888P:
@@ -159,6 +233,10 @@ const char* aipl_color_format_str(aipl_color_format_t format)
             return "NV12";
         case AIPL_COLOR_NV21:
             return "NV21";
+        case AIPL_COLOR_NV16:
+            return "NV16";
+        case AIPL_COLOR_NV61:
+            return "NV61";
         case AIPL_COLOR_I422:
             return "I422";
         case AIPL_COLOR_YUY2:
@@ -169,12 +247,38 @@ const char* aipl_color_format_str(aipl_color_format_t format)
             return "I444";
         case AIPL_COLOR_I400:
             return "I400";
+        case AIPL_COLOR_Y16:
+            return "Y16";
 
         default:
             return "COLOR_UNKNOWN";
     }
 }
 
+aipl_color_format_t aipl_color_format_premultiplied(aipl_color_format_t format)
+{
+    switch (format)
+    {
+        case AIPL_COLOR_ARGB8888:
+            return AIPL_COLOR_PARGB8888;
+        case AIPL_COLOR_RGBA8888:
+            return AIPL_COLOR_PRGBA8888;
+        case AIPL_COLOR_ARGB4444:
+            return AIPL_COLOR_PARGB4444;
+
+        default:
+            return AIPL_COLOR_UNKNOWN;
+    }
+}
+
+const aipl_yuv_coefs_t* aipl_colorimetry_coefs(aipl_colorimetry_t colorimetry)
+{
+    if (colorimetry >= AIPL_COLORIMETRY_NUM)
+        return NULL;
+
+    return &aipl_yuv_coefs[colorimetry];
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
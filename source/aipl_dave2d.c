@@ -401,17 +401,19 @@ d2_u32 aipl_dave2d_texturing(const void* input, void* output,
        dyv = (dyv * height) / new_height;
     }
 
-    /* Apply flipping */
+    /* Apply flipping in texture space so it precedes the rotation */
     d2_s32 u0 = 0; d2_s32 v0 = 0;
     if(flip_u)
     {
         dxu = -dxu;
-        u0 = D2_FIX16(output_width);
+        dxv = -dxv;
+        u0 = D2_FIX16(width);
     }
     if(flip_v)
     {
+        dyu = -dyu;
         dyv = -dyv;
-        v0 = D2_FIX16(output_height);
+        v0 = D2_FIX16(height);
     }
 
     D2_CHECK_ERR(d2_setblendmode(handle, d2_bm_alpha, d2_bm_one_minus_alpha));
@@ -457,6 +459,126 @@ d2_u32 aipl_dave2d_texturing(const void* input, void* output,
     return D2_OK;
 }
 
+d2_u32 aipl_dave2d_affine_texturing(const void* input, void* output,
+                                    uint32_t pitch,
+                                    uint32_t width, uint32_t height,
+                                    d2_u32 format,
+                                    uint32_t output_width,
+                                    uint32_t output_height,
+                                    const float matrix[6],
+                                    bool interpolate)
+{
+    /* Check arguments*/
+    if (input == NULL || output == NULL || matrix == NULL)
+        return D2_NULLPOINTER;
+
+    /* The quad covering the input image is found with the inverse map */
+    float det = matrix[0] * matrix[4] - matrix[1] * matrix[3];
+    if (det == 0.0f)
+        return D2_INVALIDENUM;
+
+    aipl_cpu_cache_clean(input, pitch * height
+                                * aipl_dave2d_mode_px_size(format));
+
+    d2_device* handle = aipl_dave2d_handle();
+    d2_u32 ret;
+
+    /* Start rendering current buffer */
+    D2_CHECK_ERR(d2_startframe(handle));
+
+    /* Get current framebuffer info */
+    void* frmbf_ptr;
+    d2_s32 frmbf_pitch;
+    d2_u32 frmbf_width;
+    d2_u32 frmbf_height;
+    d2_s32 frmbf_format;
+    D2_CHECK_ERR(d2_getframebuffer(handle, &frmbf_ptr, &frmbf_pitch,
+                                   &frmbf_width, &frmbf_height, &frmbf_format));
+
+    /* Set output as framebuffer and clear the area outside of the quad */
+    D2_CHECK_ERR(d2_framebuffer(handle, output,
+                                output_width, output_width, output_height,
+                                format));
+    D2_CHECK_ERR(d2_clear(handle, 0));
+
+    /* Prepare input image as texture*/
+    d2_u8 alpha_mode = aipl_dave2d_mode_has_alpha(format) ? d2_to_copy : d2_to_one;
+    D2_CHECK_ERR(d2_settextureoperation(handle, alpha_mode, d2_to_copy, d2_to_copy, d2_to_copy));
+
+    D2_CHECK_ERR(d2_settexture(handle, (void*)input,
+                               pitch, width, height,
+                               format));
+
+    D2_CHECK_ERR(d2_settexturemode(handle, interpolate ? d2_tm_filter : 0));
+    D2_CHECK_ERR(d2_setfillmode(handle, d2_fm_texture));
+
+    /* Matrix maps pixel centers while D/AVE2D maps pixel corners */
+    float u0 = matrix[2] + 0.5f - 0.5f * (matrix[0] + matrix[1]);
+    float v0 = matrix[5] + 0.5f - 0.5f * (matrix[3] + matrix[4]);
+
+    /* Input image corners in output coordinates in clockwise order */
+    float corners[4][2] = {
+        { 0.0f, 0.0f },
+        { (float)width, 0.0f },
+        { (float)width, (float)height },
+        { 0.0f, (float)height }
+    };
+    d2_point p[4][2];
+    for (int i = 0; i < 4; ++i)
+    {
+        float du = corners[i][0] - u0;
+        float dv = corners[i][1] - v0;
+        float x = (matrix[4] * du - matrix[1] * dv) / det;
+        float y = (matrix[0] * dv - matrix[3] * du) / det;
+
+        /* Mirroring transforms reverse the order of the corners */
+        int j = det < 0.0f ? (4 - i) % 4 : i;
+        p[j][0] = (d2_point)(x * 16.0f);
+        p[j][1] = (d2_point)(y * 16.0f);
+    }
+
+    D2_CHECK_ERR(d2_setblendmode(handle, d2_bm_alpha, d2_bm_one_minus_alpha));
+    D2_CHECK_ERR(d2_setalphablendmode(handle, d2_bm_one, d2_bm_one_minus_alpha));
+
+    D2_CHECK_ERR(d2_settexturemapping(handle,
+                                      0, 0,
+                                      (d2_s32)(u0 * 65536.0f),
+                                      (d2_s32)(v0 * 65536.0f),
+                                      (d2_s32)(matrix[0] * 65536.0f),
+                                      (d2_s32)(matrix[1] * 65536.0f),
+                                      (d2_s32)(matrix[3] * 65536.0f),
+                                      (d2_s32)(matrix[4] * 65536.0f)));
+
+    D2_CHECK_ERR(d2_renderquad(handle,
+                               p[0][0], p[0][1],
+                               p[1][0], p[1][1],
+                               p[2][0], p[2][1],
+                               p[3][0], p[3][1],
+                               0));
+
+    /* Wait until the prevous render finishes */
+    D2_CHECK_ERR(d2_endframe(handle));
+
+    /* Start the convertion */
+    D2_CHECK_ERR(d2_startframe(handle));
+
+    /* Restore old framebuffer */
+    if (frmbf_ptr != NULL)
+    {
+        D2_CHECK_ERR(d2_framebuffer(handle, frmbf_ptr, frmbf_pitch,
+                     frmbf_width, frmbf_height, frmbf_format));
+    }
+
+    /* Invalidate CPU cache of the output */
+    aipl_cpu_cache_invalidate(output, output_width * output_height
+                                      * aipl_dave2d_mode_px_size(format));
+
+    /* Wait until convertion finishes */
+    D2_CHECK_ERR(d2_endframe(handle));
+
+    return D2_OK;
+}
+
 aipl_error_t aipl_dave2d_error_convert(d2_s32 error)
 {
     last_converted_error = error;
@@ -19,6 +19,8 @@
  *********************/
 #include "aipl_demosaic.h"
 
+#include <stddef.h>
+
 #include "aipl_demosaic_default.h"
 #include "aipl_demosaic_helium.h"
 
@@ -107,6 +109,50 @@ aipl_bayer_filter_t aipl_bayer_filter_swap_rb(aipl_bayer_filter_t filter)
     }
 }
 
+aipl_bayer_filter_t aipl_bayer_filter_offset(aipl_bayer_filter_t filter,
+                                             uint32_t x, uint32_t y)
+{
+    if (x & 1)
+    {
+        switch (filter)
+        {
+            case AIPL_BAYER_RGGB:
+                filter = AIPL_BAYER_GRBG;
+                break;
+            case AIPL_BAYER_GBRG:
+                filter = AIPL_BAYER_BGGR;
+                break;
+            case AIPL_BAYER_GRBG:
+                filter = AIPL_BAYER_RGGB;
+                break;
+            default:
+                filter = AIPL_BAYER_GBRG;
+                break;
+        }
+    }
+
+    if (y & 1)
+    {
+        switch (filter)
+        {
+            case AIPL_BAYER_RGGB:
+                filter = AIPL_BAYER_GBRG;
+                break;
+            case AIPL_BAYER_GBRG:
+                filter = AIPL_BAYER_RGGB;
+                break;
+            case AIPL_BAYER_GRBG:
+                filter = AIPL_BAYER_BGGR;
+                break;
+            default:
+                filter = AIPL_BAYER_GRBG;
+                break;
+        }
+    }
+
+    return filter;
+}
+
 aipl_error_t aipl_demosaic(const void *input, void *output,
                            uint32_t pitch,
                            uint32_t width, uint32_t height,
@@ -262,6 +308,38 @@ aipl_error_t aipl_demosaic_bgr888(const void* input, void* output,
 #endif
 }
 
+aipl_error_t aipl_demosaic_rgb888p(const void* input, void* output,
+                                   uint32_t pitch,
+                                   uint32_t width, uint32_t height,
+                                   aipl_bayer_filter_t filter)
+{
+#ifdef AIPL_HELIUM_ACCELERATION
+    return aipl_demosaic_rgb888p_helium(input, output, pitch,
+                                        width, height, filter);
+#else
+    return aipl_demosaic_rgb888p_default(input, output, pitch,
+                                         width, height, filter);
+#endif
+}
+
+aipl_error_t aipl_demosaic_planar(const void* input,
+                                  void* red, void* green, void* blue,
+                                  uint32_t pitch,
+                                  const uint32_t plane_pitch[3],
+                                  uint32_t width, uint32_t height,
+                                  aipl_bayer_filter_t filter)
+{
+#ifdef AIPL_HELIUM_ACCELERATION
+    return aipl_demosaic_planar_helium(input, red, green, blue,
+                                       pitch, plane_pitch,
+                                       width, height, filter);
+#else
+    return aipl_demosaic_planar_default(input, red, green, blue,
+                                        pitch, plane_pitch,
+                                        width, height, filter);
+#endif
+}
+
 aipl_error_t aipl_demosaic_rgb565(const void* input, void* output,
                                   uint32_t pitch,
                                   uint32_t width, uint32_t height,
@@ -402,6 +480,259 @@ aipl_error_t aipl_demosaic_uyvy(const void* input, void* output,
 #endif
 }
 
+aipl_error_t aipl_demosaic_colorimetry(const void* input, void* output,
+                                       uint32_t pitch,
+                                       uint32_t width, uint32_t height,
+                                       aipl_bayer_filter_t filter,
+                                       aipl_color_format_t format,
+                                       aipl_colorimetry_t colorimetry)
+{
+    const aipl_yuv_coefs_t* coefs = aipl_colorimetry_coefs(colorimetry);
+
+    if (coefs == NULL)
+        return AIPL_ERR_NOT_SUPPORTED;
+
+#ifdef AIPL_HELIUM_ACCELERATION
+    return aipl_demosaic_colorimetry_helium(input, output, pitch,
+                                            width, height, filter,
+                                            format, coefs);
+#else
+    return aipl_demosaic_colorimetry_default(input, output, pitch,
+                                             width, height, filter,
+                                             format, coefs);
+#endif
+}
+
+aipl_error_t aipl_demosaic_interpolate(const void* input, void* output,
+                                       uint32_t pitch,
+                                       uint32_t width, uint32_t height,
+                                       aipl_bayer_filter_t filter,
+                                       aipl_demosaic_mode_t mode,
+                                       aipl_color_format_t format)
+{
+    if (mode == AIPL_DEMOSAIC_QUAD)
+    {
+        return aipl_demosaic(input, output, pitch,
+                             width, height, filter, format);
+    }
+
+    return aipl_demosaic_interpolate_default(input, output, pitch,
+                                             width, height, filter,
+                                             mode, format);
+}
+
+aipl_error_t aipl_demosaic_dpc(const void* input, void* output,
+                               uint32_t pitch,
+                               uint32_t width, uint32_t height,
+                               aipl_bayer_filter_t filter,
+                               aipl_demosaic_mode_t mode,
+                               uint8_t threshold,
+                               aipl_color_format_t format)
+{
+    return aipl_demosaic_dpc_default(input, output, pitch,
+                                     width, height, filter,
+                                     mode, threshold, format);
+}
+
+aipl_error_t aipl_demosaic_bin2x2(const void* input, void* output,
+                                  uint32_t pitch,
+                                  uint32_t width, uint32_t height,
+                                  aipl_bayer_filter_t filter,
+                                  aipl_color_format_t format)
+{
+    return aipl_demosaic_bin2x2_default(input, output, pitch,
+                                        width, height, filter, format);
+}
+
+aipl_error_t aipl_demosaic_resize(const void* input, void* output,
+                                  uint32_t pitch,
+                                  uint32_t width, uint32_t height,
+                                  aipl_bayer_filter_t filter,
+                                  aipl_color_format_t format,
+                                  uint32_t output_width,
+                                  uint32_t output_height,
+                                  aipl_demosaic_scale_t scale)
+{
+    return aipl_demosaic_resize_default(input, output, pitch,
+                                        width, height, filter, format,
+                                        output_width, output_height, scale);
+}
+
+aipl_error_t aipl_demosaic_roi(const void* input, void* output,
+                               uint32_t pitch,
+                               uint32_t width, uint32_t height,
+                               aipl_bayer_filter_t filter,
+                               aipl_color_format_t format,
+                               uint32_t left, uint32_t top,
+                               uint32_t right, uint32_t bottom)
+{
+    return aipl_demosaic_roi_default(input, output, pitch,
+                                     width, height, filter, format,
+                                     left, top, right, bottom);
+}
+
+aipl_error_t aipl_demosaic_corrected(const void* input, void* output,
+                                     uint32_t pitch,
+                                     uint32_t width, uint32_t height,
+                                     aipl_bayer_filter_t filter,
+                                     const aipl_raw_correction_t* correction,
+                                     aipl_color_format_t format)
+{
+#ifdef AIPL_HELIUM_ACCELERATION
+    return aipl_demosaic_corrected_helium(input, output, pitch,
+                                          width, height, filter,
+                                          correction, format);
+#else
+    return aipl_demosaic_corrected_default(input, output, pitch,
+                                           width, height, filter,
+                                           correction, format);
+#endif
+}
+
+aipl_error_t aipl_demosaic_stats(const void* input, void* output,
+                                 uint32_t pitch,
+                                 uint32_t width, uint32_t height,
+                                 aipl_bayer_filter_t filter,
+                                 aipl_color_format_t format,
+                                 aipl_demosaic_stats_t* stats)
+{
+    return aipl_demosaic_stats_default(input, output, pitch,
+                                       width, height, filter,
+                                       format, stats);
+}
+
+uint32_t aipl_raw_stride(uint32_t pitch, aipl_raw_format_t raw)
+{
+    switch (raw)
+    {
+        case AIPL_RAW8:
+            return pitch;
+
+        case AIPL_RAW10:
+            return pitch * 5 / 4;
+
+        case AIPL_RAW12:
+            return pitch * 3 / 2;
+
+        default:
+            return 0;
+    }
+}
+
+aipl_error_t aipl_raw_unpack_8bit(const void* input, void* output,
+                                  uint32_t pitch,
+                                  uint32_t width, uint32_t height,
+                                  aipl_raw_format_t raw)
+{
+    return aipl_raw_unpack_8bit_default(input, output, pitch,
+                                        width, height, raw);
+}
+
+aipl_error_t aipl_raw_unpack_16bit(const void* input, void* output,
+                                   uint32_t pitch,
+                                   uint32_t width, uint32_t height,
+                                   aipl_raw_format_t raw)
+{
+    return aipl_raw_unpack_16bit_default(input, output, pitch,
+                                         width, height, raw);
+}
+
+void aipl_bayer_channel_gains(aipl_bayer_filter_t filter,
+                              uint16_t red, uint16_t green, uint16_t blue,
+                              uint16_t* gains)
+{
+    gains[0] = green;
+    gains[1] = green;
+    gains[2] = green;
+    gains[3] = green;
+
+    switch (filter)
+    {
+        case AIPL_BAYER_RGGB:
+            gains[0] = red;
+            gains[3] = blue;
+            break;
+        case AIPL_BAYER_GBRG:
+            gains[2] = red;
+            gains[1] = blue;
+            break;
+        case AIPL_BAYER_GRBG:
+            gains[1] = red;
+            gains[2] = blue;
+            break;
+        default:
+            gains[3] = red;
+            gains[0] = blue;
+            break;
+    }
+}
+
+aipl_error_t aipl_raw_white_balance(const void* input, void* output,
+                                    uint32_t pitch,
+                                    uint32_t width, uint32_t height,
+                                    const uint16_t* gains,
+                                    bool clip_highlights)
+{
+#ifdef AIPL_HELIUM_ACCELERATION
+    return aipl_raw_white_balance_helium(input, output, pitch,
+                                         width, height,
+                                         gains, clip_highlights);
+#else
+    return aipl_raw_white_balance_default(input, output, pitch,
+                                          width, height,
+                                          gains, clip_highlights);
+#endif
+}
+
+aipl_error_t aipl_demosaic_raw(const void* input, void* output,
+                               uint32_t pitch,
+                               uint32_t width, uint32_t height,
+                               aipl_bayer_filter_t filter,
+                               aipl_raw_format_t raw,
+                               aipl_color_format_t format)
+{
+    if (raw == AIPL_RAW8)
+    {
+        return aipl_demosaic(input, output, pitch,
+                             width, height, filter, format);
+    }
+
+    return aipl_demosaic_raw_default(input, output, pitch,
+                                     width, height, filter, raw, format);
+}
+
+aipl_error_t aipl_demosaic_16bit(const void* input, void* output,
+                                 uint32_t pitch,
+                                 uint32_t width, uint32_t height,
+                                 aipl_bayer_filter_t filter,
+                                 uint8_t bits,
+                                 aipl_color_format_t format)
+{
+#ifdef AIPL_HELIUM_ACCELERATION
+    return aipl_demosaic_16bit_helium(input, output, pitch,
+                                      width, height, filter,
+                                      bits, format);
+#else
+    return aipl_demosaic_16bit_default(input, output, pitch,
+                                       width, height, filter,
+                                       bits, format);
+#endif
+}
+
+aipl_error_t aipl_demosaic_16bit_rgb16(const void* input, void* output,
+                                       uint32_t pitch,
+                                       uint32_t width, uint32_t height,
+                                       aipl_bayer_filter_t filter)
+{
+#ifdef AIPL_HELIUM_ACCELERATION
+    return aipl_demosaic_16bit_rgb16_helium(input, output, pitch,
+                                            width, height, filter);
+#else
+    return aipl_demosaic_16bit_rgb16_default(input, output, pitch,
+                                             width, height, filter);
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -31,6 +31,7 @@
 #else
 #include "aipl_flip_default.h"
 #endif
+#include "aipl_tiled_default.h"
 
 /*********************
  *      DEFINES
@@ -61,6 +62,12 @@ aipl_error_t aipl_flip(const void* input, void* output,
                        aipl_color_format_t format,
                        bool flip_horizontal, bool flip_vertical)
 {
+    if (format & AIPL_COLOR_TILED)
+    {
+        return aipl_flip_tiled_default(input, output, width, height,
+                                       format, flip_horizontal, flip_vertical);
+    }
+
 #ifdef AIPL_DAVE2D_ACCELERATION
     if (aipl_dave2d_check_output_format(format))
     {
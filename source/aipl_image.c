@@ -88,5 +88,13 @@ static void* aipl_image_allocate(uint32_t pitch, uint32_t height,
         height = height & 0x1 ? height + 1 : height;
     }
 
+    /* Tiled images store whole tiles */
+    if (format & AIPL_COLOR_TILED)
+    {
+        pitch = (pitch + AIPL_TILE_SIZE - 1) / AIPL_TILE_SIZE * AIPL_TILE_SIZE;
+        height = (height + AIPL_TILE_SIZE - 1) / AIPL_TILE_SIZE * AIPL_TILE_SIZE;
+        format &= ~AIPL_COLOR_TILED;
+    }
+
     return aipl_video_alloc(pitch * height * aipl_color_format_depth(format) / 8);
 }
@@ -0,0 +1,258 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/******************************************************************************
+ * @file    aipl_premultiply.c
+ * @brief   Premultiplied alpha function implementations
+ *
+******************************************************************************/
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "aipl_premultiply.h"
+
+#include <stddef.h>
+
+#include "aipl_config.h"
+#include "aipl_utils.h"
+#ifdef AIPL_HELIUM_ACCELERATION
+#include "aipl_premultiply_helium.h"
+#else
+#include "aipl_premultiply_default.h"
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+/* round(255 * 2^16 / a), transparent pixels map to 0 */
+const uint32_t aipl_unpremultiply_lut[256] = {
+    0, 16711680, 8355840, 5570560, 4177920, 3342336,
+    2785280, 2387383, 2088960, 1856853, 1671168, 1519244,
+    1392640, 1285514, 1193691, 1114112, 1044480, 983040,
+    928427, 879562, 835584, 795794, 759622, 726595,
+    696320, 668467, 642757, 618951, 596846, 576265,
+    557056, 539086, 522240, 506415, 491520, 477477,
+    464213, 451667, 439781, 428505, 417792, 407602,
+    397897, 388644, 379811, 371371, 363297, 355568,
+    348160, 341055, 334234, 327680, 321378, 315315,
+    309476, 303849, 298423, 293187, 288132, 283249,
+    278528, 273962, 269543, 265265, 261120, 257103,
+    253207, 249428, 245760, 242198, 238738, 235376,
+    232107, 228927, 225834, 222822, 219891, 217035,
+    214252, 211540, 208896, 206317, 203801, 201346,
+    198949, 196608, 194322, 192088, 189905, 187772,
+    185685, 183645, 181649, 179695, 177784, 175912,
+    174080, 172285, 170527, 168805, 167117, 165462,
+    163840, 162249, 160689, 159159, 157657, 156184,
+    154738, 153318, 151924, 150556, 149211, 147891,
+    146594, 145319, 144066, 142835, 141624, 140434,
+    139264, 138113, 136981, 135867, 134772, 133693,
+    132632, 131588, 130560, 129548, 128551, 127570,
+    126604, 125652, 124714, 123790, 122880, 121983,
+    121099, 120228, 119369, 118523, 117688, 116865,
+    116053, 115253, 114464, 113685, 112917, 112159,
+    111411, 110673, 109945, 109227, 108517, 107817,
+    107126, 106444, 105770, 105105, 104448, 103799,
+    103159, 102526, 101900, 101283, 100673, 100070,
+    99474, 98886, 98304, 97729, 97161, 96599,
+    96044, 95495, 94953, 94416, 93886, 93361,
+    92843, 92330, 91822, 91321, 90824, 90333,
+    89848, 89367, 88892, 88422, 87956, 87496,
+    87040, 86589, 86143, 85701, 85264, 84831,
+    84402, 83978, 83558, 83143, 82731, 82324,
+    81920, 81520, 81125, 80733, 80345, 79960,
+    79579, 79202, 78829, 78459, 78092, 77729,
+    77369, 77012, 76659, 76309, 75962, 75618,
+    75278, 74940, 74606, 74274, 73945, 73620,
+    73297, 72977, 72659, 72345, 72033, 71724,
+    71417, 71114, 70812, 70513, 70217, 69923,
+    69632, 69343, 69057, 68772, 68490, 68211,
+    67934, 67659, 67386, 67115, 66847, 66580,
+    66316, 66054, 65794, 65536,
+};
+
+aipl_error_t aipl_premultiply(const void* input, void* output,
+                              uint32_t pitch,
+                              uint32_t width, uint32_t height,
+                              aipl_color_format_t format)
+{
+    switch (format)
+    {
+        case AIPL_COLOR_ARGB8888:
+            return aipl_premultiply_argb8888(input, output, pitch,
+                                             width, height);
+        case AIPL_COLOR_RGBA8888:
+            return aipl_premultiply_rgba8888(input, output, pitch,
+                                             width, height);
+        case AIPL_COLOR_ARGB4444:
+            return aipl_premultiply_argb4444(input, output, pitch,
+                                             width, height);
+
+        default:
+            return AIPL_ERR_UNSUPPORTED_FORMAT;
+    }
+}
+
+aipl_error_t aipl_premultiply_img(const aipl_image_t* input,
+                                  aipl_image_t* output)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    if (input->width != output->width || input->height != output->height)
+        return AIPL_ERR_SIZE_MISMATCH;
+
+    if (aipl_color_format_premultiplied(input->format) != output->format)
+        return AIPL_ERR_FORMAT_MISMATCH;
+
+    return aipl_premultiply(input->data, output->data, input->pitch,
+                            input->width, input->height, input->format);
+}
+
+aipl_error_t aipl_unpremultiply(const void* input, void* output,
+                                uint32_t pitch,
+                                uint32_t width, uint32_t height,
+                                aipl_color_format_t format)
+{
+    switch (format)
+    {
+        case AIPL_COLOR_PARGB8888:
+            return aipl_unpremultiply_pargb8888(input, output, pitch,
+                                                width, height);
+        case AIPL_COLOR_PRGBA8888:
+            return aipl_unpremultiply_prgba8888(input, output, pitch,
+                                                width, height);
+        case AIPL_COLOR_PARGB4444:
+            return aipl_unpremultiply_pargb4444(input, output, pitch,
+                                                width, height);
+
+        default:
+            return AIPL_ERR_UNSUPPORTED_FORMAT;
+    }
+}
+
+aipl_error_t aipl_unpremultiply_img(const aipl_image_t* input,
+                                    aipl_image_t* output)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    if (input->width != output->width || input->height != output->height)
+        return AIPL_ERR_SIZE_MISMATCH;
+
+    if (aipl_color_format_premultiplied(output->format) != input->format)
+        return AIPL_ERR_FORMAT_MISMATCH;
+
+    return aipl_unpremultiply(input->data, output->data, input->pitch,
+                              input->width, input->height, input->format);
+}
+
+aipl_error_t aipl_premultiply_argb8888(const void* input, void* output,
+                                       uint32_t pitch,
+                                       uint32_t width, uint32_t height)
+{
+#ifdef AIPL_HELIUM_ACCELERATION
+    return aipl_premultiply_argb8888_helium(input, output, pitch,
+                                            width, height);
+#else
+    return aipl_premultiply_argb8888_default(input, output, pitch,
+                                             width, height);
+#endif
+}
+
+aipl_error_t aipl_premultiply_rgba8888(const void* input, void* output,
+                                       uint32_t pitch,
+                                       uint32_t width, uint32_t height)
+{
+#ifdef AIPL_HELIUM_ACCELERATION
+    return aipl_premultiply_rgba8888_helium(input, output, pitch,
+                                            width, height);
+#else
+    return aipl_premultiply_rgba8888_default(input, output, pitch,
+                                             width, height);
+#endif
+}
+
+aipl_error_t aipl_premultiply_argb4444(const void* input, void* output,
+                                       uint32_t pitch,
+                                       uint32_t width, uint32_t height)
+{
+#ifdef AIPL_HELIUM_ACCELERATION
+    return aipl_premultiply_argb4444_helium(input, output, pitch,
+                                            width, height);
+#else
+    return aipl_premultiply_argb4444_default(input, output, pitch,
+                                             width, height);
+#endif
+}
+
+aipl_error_t aipl_unpremultiply_pargb8888(const void* input, void* output,
+                                          uint32_t pitch,
+                                          uint32_t width, uint32_t height)
+{
+#ifdef AIPL_HELIUM_ACCELERATION
+    return aipl_unpremultiply_pargb8888_helium(input, output, pitch,
+                                               width, height);
+#else
+    return aipl_unpremultiply_pargb8888_default(input, output, pitch,
+                                                width, height);
+#endif
+}
+
+aipl_error_t aipl_unpremultiply_prgba8888(const void* input, void* output,
+                                          uint32_t pitch,
+                                          uint32_t width, uint32_t height)
+{
+#ifdef AIPL_HELIUM_ACCELERATION
+    return aipl_unpremultiply_prgba8888_helium(input, output, pitch,
+                                               width, height);
+#else
+    return aipl_unpremultiply_prgba8888_default(input, output, pitch,
+                                                width, height);
+#endif
+}
+
+aipl_error_t aipl_unpremultiply_pargb4444(const void* input, void* output,
+                                          uint32_t pitch,
+                                          uint32_t width, uint32_t height)
+{
+#ifdef AIPL_HELIUM_ACCELERATION
+    return aipl_unpremultiply_pargb4444_helium(input, output, pitch,
+                                               width, height);
+#else
+    return aipl_unpremultiply_pargb4444_default(input, output, pitch,
+                                                width, height);
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
@@ -0,0 +1,102 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/******************************************************************************
+ * @file    aipl_remap.c
+ * @brief   Coordinate map based image remapping function implementations
+ *
+******************************************************************************/
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "aipl_remap.h"
+
+#include <stddef.h>
+#include <math.h>
+
+#include "aipl_config.h"
+#include "aipl_remap_default.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+aipl_error_t aipl_remap(const void* input, void* output,
+                        uint32_t pitch,
+                        uint32_t width, uint32_t height,
+                        aipl_color_format_t format,
+                        uint32_t output_width, uint32_t output_height,
+                        const aipl_remap_t* map,
+                        bool interpolate)
+{
+    return aipl_remap_default(input, output, pitch, width, height, format,
+                              output_width, output_height,
+                              map, interpolate);
+}
+
+aipl_error_t aipl_remap_img(const aipl_image_t* input,
+                            aipl_image_t* output,
+                            const aipl_remap_t* map,
+                            bool interpolate)
+{
+    return aipl_remap_img_default(input, output, map, interpolate);
+}
+
+aipl_remap_point_t aipl_remap_point(float x, float y)
+{
+    float x_int = floorf(x);
+    float y_int = floorf(y);
+
+    aipl_remap_point_t point;
+    point.x = (int16_t)x_int;
+    point.y = (int16_t)y_int;
+
+    /* Round the fraction and carry into the integer part */
+    int32_t fx = (int32_t)((x - x_int) * 256.0f + 0.5f);
+    int32_t fy = (int32_t)((y - y_int) * 256.0f + 0.5f);
+    if (fx > 255)
+    {
+        point.x += 1;
+        fx = 0;
+    }
+    if (fy > 255)
+    {
+        point.y += 1;
+        fy = 0;
+    }
+    point.fx = fx;
+    point.fy = fy;
+
+    return point;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
@@ -31,6 +31,7 @@
 #else
 #include "aipl_resize_default.h"
 #endif
+#include "aipl_tiled_default.h"
 
 /*********************
  *      DEFINES
@@ -65,6 +66,13 @@ aipl_error_t aipl_resize(const void* input, void* output,
     if (input == NULL || output == NULL)
         return AIPL_ERR_NULL_POINTER;
 
+    if (format & AIPL_COLOR_TILED)
+    {
+        return aipl_resize_tiled_default(input, output, width, height,
+                                         format, output_width, output_height,
+                                         interpolate);
+    }
+
 #ifdef AIPL_DAVE2D_ACCELERATION
     if (aipl_dave2d_check_output_format(format))
     {
@@ -31,6 +31,7 @@
 #else
 #include "aipl_rotate_default.h"
 #endif
+#include "aipl_tiled_default.h"
 
 /*********************
  *      DEFINES
@@ -64,6 +65,12 @@
     if (input == NULL || output == NULL)
         return AIPL_ERR_NULL_POINTER;
 
+    if (format & AIPL_COLOR_TILED)
+    {
+        return aipl_rotate_tiled_default(input, output, width, height,
+                                         format, rotation);
+    }
+
 #if (defined(AIPL_DAVE2D_ACCELERATION) && defined(AIPL_OPTIMIZE_CPU_LOAD))
     if (aipl_dave2d_check_output_format(format))
     {
@@ -0,0 +1,89 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/******************************************************************************
+ * @file    aipl_rotate_convert.c
+ * @brief   Fused rotate and color conversion function implementations
+ *
+******************************************************************************/
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "aipl_rotate_convert.h"
+
+#include <stddef.h>
+
+#include "aipl_config.h"
+#include "aipl_rotate_convert_default.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+aipl_error_t aipl_rotate_convert(const void* input, void* output,
+                                 uint32_t pitch,
+                                 uint32_t width, uint32_t height,
+                                 aipl_color_format_t input_format,
+                                 aipl_color_format_t output_format,
+                                 aipl_rotation_t rotation)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    return aipl_rotate_convert_default(input, output, pitch, width, height,
+                                       input_format, output_format,
+                                       rotation);
+}
+
+aipl_error_t aipl_rotate_convert_img(const aipl_image_t* input,
+                                     aipl_image_t* output,
+                                     aipl_rotation_t rotation)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    if ((rotation == AIPL_ROTATE_0 || rotation == AIPL_ROTATE_180) &&
+        (input->width != output->width || input->height != output->height))
+        return AIPL_ERR_SIZE_MISMATCH;
+
+    if ((rotation == AIPL_ROTATE_90 || rotation == AIPL_ROTATE_270) &&
+        (input->width != output->height || input->height != output->width))
+        return AIPL_ERR_SIZE_MISMATCH;
+
+    return aipl_rotate_convert(input->data, output->data,
+                               input->pitch,
+                               input->width, input->height,
+                               input->format, output->format,
+                               rotation);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
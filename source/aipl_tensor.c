@@ -0,0 +1,115 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/******************************************************************************
+ * @file    aipl_tensor.c
+ * @brief   Neural network input tensor function implementations
+ *
+******************************************************************************/
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "aipl_tensor.h"
+
+#include <stddef.h>
+
+#include "aipl_tensor_default.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+#if AIPL_CONVERT_GENERIC
+aipl_error_t aipl_tensor_convert(const void* input, void* output,
+                                 uint32_t pitch,
+                                 uint32_t width, uint32_t height,
+                                 aipl_color_format_t format,
+                                 const aipl_tensor_params_t* params)
+{
+    return aipl_tensor_convert_default(input, output, pitch,
+                                       width, height, format, params);
+}
+
+aipl_error_t aipl_tensor_convert_img(const aipl_image_t* input,
+                                     void* output,
+                                     const aipl_tensor_params_t* params)
+{
+    if (input == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    return aipl_tensor_convert(input->data, output, input->pitch,
+                               input->width, input->height,
+                               input->format, params);
+}
+#endif
+
+aipl_error_t aipl_tensor_demosaic(const void* input, void* output,
+                                  uint32_t pitch,
+                                  uint32_t width, uint32_t height,
+                                  aipl_bayer_filter_t filter,
+                                  const aipl_tensor_params_t* params)
+{
+    return aipl_tensor_demosaic_default(input, output, pitch,
+                                        width, height, filter, params);
+}
+
+aipl_error_t aipl_tensor_demosaic_bin2x2(const void* input, void* output,
+                                         uint32_t pitch,
+                                         uint32_t width, uint32_t height,
+                                         aipl_bayer_filter_t filter,
+                                         const aipl_tensor_params_t* params)
+{
+    return aipl_tensor_demosaic_bin2x2_default(input, output, pitch,
+                                               width, height, filter, params);
+}
+
+uint32_t aipl_tensor_size(uint32_t width, uint32_t height,
+                          aipl_tensor_type_t type)
+{
+    switch (type)
+    {
+        case AIPL_TENSOR_INT8:
+        case AIPL_TENSOR_UINT8:
+            return width * height * 3;
+
+        case AIPL_TENSOR_FLOAT32:
+            return width * height * 3 * sizeof(float);
+
+        case AIPL_TENSOR_FLOAT16:
+            return width * height * 3 * sizeof(uint16_t);
+
+        default:
+            return 0;
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
@@ -0,0 +1,82 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/******************************************************************************
+ * @file    aipl_tiled.c
+ * @brief   Tiled memory layout conversion function implementations
+ *
+******************************************************************************/
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "aipl_tiled.h"
+
+#include <stddef.h>
+
+#include "aipl_config.h"
+#include "aipl_tiled_default.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+aipl_error_t aipl_tiled_from_linear(const void* input, void* output,
+                                    uint32_t pitch,
+                                    uint32_t width, uint32_t height,
+                                    aipl_color_format_t format)
+{
+    return aipl_tiled_from_linear_default(input, output, pitch,
+                                          width, height, format);
+}
+
+aipl_error_t aipl_tiled_from_linear_img(const aipl_image_t* input,
+                                        aipl_image_t* output)
+{
+    return aipl_tiled_from_linear_img_default(input, output);
+}
+
+aipl_error_t aipl_tiled_to_linear(const void* input, void* output,
+                                  uint32_t pitch,
+                                  uint32_t width, uint32_t height,
+                                  aipl_color_format_t format)
+{
+    return aipl_tiled_to_linear_default(input, output, pitch,
+                                        width, height, format);
+}
+
+aipl_error_t aipl_tiled_to_linear_img(const aipl_image_t* input,
+                                      aipl_image_t* output)
+{
+    return aipl_tiled_to_linear_img_default(input, output);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
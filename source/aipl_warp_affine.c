@@ -0,0 +1,126 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/******************************************************************************
+ * @file    aipl_warp_affine.c
+ * @brief   Affine warp function implementations
+ *
+******************************************************************************/
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "aipl_warp_affine.h"
+
+#include <stddef.h>
+#include <math.h>
+
+#include "aipl_config.h"
+#ifdef AIPL_DAVE2D_ACCELERATION
+#include "aipl_warp_affine_dave2d.h"
+#include "aipl_dave2d.h"
+#endif
+#include "aipl_warp_affine_default.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define AIPL_PI 3.14159265358979f
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+aipl_error_t aipl_warp_affine(const void* input, void* output,
+                              uint32_t pitch,
+                              uint32_t width, uint32_t height,
+                              aipl_color_format_t format,
+                              uint32_t output_width, uint32_t output_height,
+                              const float matrix[6],
+                              bool interpolate)
+{
+    if (input == NULL || output == NULL || matrix == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+#if (defined(AIPL_DAVE2D_ACCELERATION) && defined(AIPL_OPTIMIZE_CPU_LOAD))
+    if (aipl_dave2d_check_output_format(format))
+    {
+        return aipl_warp_affine_dave2d(input, output, pitch, width, height,
+                                       format, output_width, output_height,
+                                       matrix, interpolate);
+    }
+#endif
+
+    return aipl_warp_affine_default(input, output, pitch, width, height,
+                                    format, output_width, output_height,
+                                    matrix, interpolate);
+}
+
+aipl_error_t aipl_warp_affine_img(const aipl_image_t* input,
+                                  aipl_image_t* output,
+                                  const float matrix[6],
+                                  bool interpolate)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    if (output->format != input->format)
+        return AIPL_ERR_FORMAT_MISMATCH;
+
+    return aipl_warp_affine(input->data, output->data,
+                            input->pitch,
+                            input->width, input->height,
+                            input->format,
+                            output->width, output->height,
+                            matrix, interpolate);
+}
+
+void aipl_warp_affine_rotation_matrix(float matrix[6],
+                                      float angle, float scale,
+                                      uint32_t width, uint32_t height,
+                                      uint32_t output_width,
+                                      uint32_t output_height)
+{
+    float rad = angle * AIPL_PI / 180.0f;
+    float c = cosf(rad) / scale;
+    float s = sinf(rad) / scale;
+
+    float in_x = (width - 1) * 0.5f;
+    float in_y = (height - 1) * 0.5f;
+    float out_x = (output_width - 1) * 0.5f;
+    float out_y = (output_height - 1) * 0.5f;
+
+    /* Inverse rotation around the output center moved to the input center */
+    matrix[0] = c;
+    matrix[1] = s;
+    matrix[2] = in_x - c * out_x - s * out_y;
+    matrix[3] = -s;
+    matrix[4] = c;
+    matrix[5] = in_y + s * out_x - c * out_y;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
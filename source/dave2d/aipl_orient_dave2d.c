@@ -0,0 +1,160 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/******************************************************************************
+ * @file    aipl_orient_dave2d.c
+ * @brief   D/AVE2D accelerated orientation transform function implementations
+ *
+******************************************************************************/
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "aipl_orient_dave2d.h"
+
+#include <stddef.h>
+
+#include "aipl_config.h"
+#include "aipl_dave2d.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+aipl_error_t aipl_orient_dave2d(const void* input, void* output,
+                                uint32_t pitch,
+                                uint32_t width, uint32_t height,
+                                aipl_color_format_t format,
+                                aipl_orientation_t orientation,
+                                uint32_t left, uint32_t top,
+                                uint32_t right, uint32_t bottom)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    if ((left > right) || (right > width) || (top > bottom) || (bottom > height))
+        return AIPL_ERR_FRAME_OUT_OF_RANGE;
+
+    if (!aipl_dave2d_check_output_format(format))
+        return AIPL_ERR_UNSUPPORTED_FORMAT;
+
+    /* Every orientation is a texture flip followed by a rotation */
+    int32_t rotation;
+    bool flip_u = false;
+    bool flip_v = false;
+    switch (orientation)
+    {
+        case AIPL_ORIENT_NORMAL:
+            rotation = 0;
+            break;
+        case AIPL_ORIENT_FLIP_H:
+            rotation = 0;
+            flip_u = true;
+            break;
+        case AIPL_ORIENT_ROTATE_180:
+            rotation = 180;
+            break;
+        case AIPL_ORIENT_FLIP_V:
+            rotation = 0;
+            flip_v = true;
+            break;
+        case AIPL_ORIENT_TRANSPOSE:
+            rotation = 90;
+            flip_v = true;
+            break;
+        case AIPL_ORIENT_ROTATE_90:
+            rotation = 90;
+            break;
+        case AIPL_ORIENT_TRANSVERSE:
+            rotation = 270;
+            flip_v = true;
+            break;
+        case AIPL_ORIENT_ROTATE_270:
+            rotation = 270;
+            break;
+        default:
+            return AIPL_ERR_NOT_SUPPORTED;
+    }
+
+    /* Source rectangle is used as the texture so that
+       flipping mirrors it rather than the whole input */
+    uint32_t new_width = right - left;
+    uint32_t new_height = bottom - top;
+    const uint8_t* src = (const uint8_t*)input
+                         + (top * pitch + left)
+                           * (aipl_color_format_depth(format) / 8);
+
+    d2_u32 ret = aipl_dave2d_texturing(src, output,
+                                       pitch,
+                                       new_width, new_height,
+                                       aipl_dave2d_format_to_mode(format),
+                                       new_width, new_height,
+                                       0, 0,
+                                       rotation,
+                                       flip_u, flip_v,
+                                       false, false);
+
+    return aipl_dave2d_error_convert(ret);
+}
+
+aipl_error_t aipl_orient_img_dave2d(const aipl_image_t* input,
+                                    aipl_image_t* output,
+                                    aipl_orientation_t orientation,
+                                    uint32_t left, uint32_t top,
+                                    uint32_t right, uint32_t bottom)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    if (output->format != input->format)
+        return AIPL_ERR_FORMAT_MISMATCH;
+
+    uint32_t new_width = right - left;
+    uint32_t new_height = bottom - top;
+    if (aipl_orientation_is_transposed(orientation))
+    {
+        new_width = bottom - top;
+        new_height = right - left;
+    }
+
+    if (new_width != output->width || new_height != output->height)
+        return AIPL_ERR_SIZE_MISMATCH;
+
+    return aipl_orient_dave2d(input->data, output->data,
+                              input->pitch,
+                              input->width, input->height,
+                              input->format,
+                              orientation,
+                              left, top,
+                              right, bottom);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
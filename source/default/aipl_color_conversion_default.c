@@ -21,6 +21,7 @@
 
 #include <string.h>
 
+#include "aipl_cache.h"
 #include "aipl_config.h"
 #include "aipl_utils.h"
 
@@ -35,6 +36,9 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static uint32_t aipl_color_copy_plane(const uint8_t* input, uint8_t* output,
+                                      uint32_t pitch,
+                                      uint32_t width, uint32_t height);
 #if (AIPL_CONVERT_ALPHA8_I400 & TO_BGR888 | AIPL_CONVERT_ALPHA8_I400 & TO_RGB888)\
      && (!defined(AIPL_HELIUM_ACCELERATION) || defined(AIPL_INCLUDE_ALL_DEFAULT))
 static aipl_error_t aipl_color_convert_alpha8_to_24bit_default(const void* input,
@@ -1731,10 +1735,10 @@ aipl_error_t aipl_color_convert_argb8888_to_i422_default(const void* input,
         const aipl_argb8888_px_t* src = src_ptr + i * pitch;
 
         uint8_t* y_dst = y_ptr + i * width;
-        uint8_t* v_dst = v_ptr + i * width / 2;
-        uint8_t* u_dst = u_ptr + i * width / 2;
+        uint8_t* v_dst = v_ptr + i * (width / 2);
+        uint8_t* u_dst = u_ptr + i * (width / 2);
 
-        for (uint32_t j = 0; j < width; j += 2)
+        for (uint32_t j = 0; j + 1 < width; j += 2)
         {
             aipl_cnvt_px_argb8888_to_yuv(y_dst, u_dst, v_dst, src);
 
@@ -1748,6 +1752,9 @@ aipl_error_t aipl_color_convert_argb8888_to_i422_default(const void* input,
             ++src;
             ++y_dst;
        }
+
+        if (width & 1)
+            aipl_cnvt_px_argb8888_to_yuv_y(y_dst, src);
     }
 
     return AIPL_ERR_OK;
@@ -2346,8 +2353,8 @@ aipl_error_t aipl_color_convert_argb4444_to_i422_default(const void* input,
         }
 
         src = src_ptr + i * pitch;
-        uint8_t* u_dst = u_ptr + i * width / 2;
-        uint8_t* v_dst = v_ptr + i * width / 2;
+        uint8_t* u_dst = u_ptr + i * (width / 2);
+        uint8_t* v_dst = v_ptr + i * (width / 2);
 
         for (uint32_t j = 0; j < width / 2; ++j)
         {
@@ -2957,8 +2964,8 @@ aipl_error_t aipl_color_convert_argb1555_to_i422_default(const void* input,
         }
 
         src = src_ptr + i * pitch;
-        uint8_t* u_dst = u_ptr + i * width / 2;
-        uint8_t* v_dst = v_ptr + i * width / 2;
+        uint8_t* u_dst = u_ptr + i * (width / 2);
+        uint8_t* v_dst = v_ptr + i * (width / 2);
 
         for (uint32_t j = 0; j < width / 2; ++j)
         {
@@ -3557,10 +3564,10 @@ aipl_error_t aipl_color_convert_rgba8888_to_i422_default(const void* input,
         const aipl_rgba8888_px_t* src = src_ptr + i * pitch;
 
         uint8_t* y_dst = y_ptr + i * width;
-        uint8_t* v_dst = v_ptr + i * width / 2;
-        uint8_t* u_dst = u_ptr + i * width / 2;
+        uint8_t* v_dst = v_ptr + i * (width / 2);
+        uint8_t* u_dst = u_ptr + i * (width / 2);
 
-        for (uint32_t j = 0; j < width; j += 2)
+        for (uint32_t j = 0; j + 1 < width; j += 2)
         {
             aipl_cnvt_px_rgba8888_to_yuv(y_dst, u_dst, v_dst, src);
 
@@ -3574,6 +3581,9 @@ aipl_error_t aipl_color_convert_rgba8888_to_i422_default(const void* input,
             ++src;
             ++y_dst;
        }
+
+        if (width & 1)
+            aipl_cnvt_px_rgba8888_to_yuv_y(y_dst, src);
     }
 
     return AIPL_ERR_OK;
@@ -4172,8 +4182,8 @@ aipl_error_t aipl_color_convert_rgba4444_to_i422_default(const void* input,
         }
 
         src = src_ptr + i * pitch;
-        uint8_t* u_dst = u_ptr + i * width / 2;
-        uint8_t* v_dst = v_ptr + i * width / 2;
+        uint8_t* u_dst = u_ptr + i * (width / 2);
+        uint8_t* v_dst = v_ptr + i * (width / 2);
 
         for (uint32_t j = 0; j < width / 2; ++j)
         {
@@ -4783,8 +4793,8 @@ aipl_error_t aipl_color_convert_rgba5551_to_i422_default(const void* input,
         }
 
         src = src_ptr + i * pitch;
-        uint8_t* u_dst = u_ptr + i * width / 2;
-        uint8_t* v_dst = v_ptr + i * width / 2;
+        uint8_t* u_dst = u_ptr + i * (width / 2);
+        uint8_t* v_dst = v_ptr + i * (width / 2);
 
         for (uint32_t j = 0; j < width / 2; ++j)
         {
@@ -5263,10 +5273,10 @@ aipl_error_t aipl_color_convert_bgr888_to_i422_default(const void* input,
         const uint8_t* src = src_ptr + i * pitch * 3;
 
         uint8_t* y_dst = y_ptr + i * width;
-        uint8_t* v_dst = v_ptr + i * width / 2;
-        uint8_t* u_dst = u_ptr + i * width / 2;
+        uint8_t* v_dst = v_ptr + i * (width / 2);
+        uint8_t* u_dst = u_ptr + i * (width / 2);
 
-        for (uint32_t j = 0; j < width; j += 2)
+        for (uint32_t j = 0; j + 1 < width; j += 2)
         {
             aipl_cnvt_px_24bit_to_yuv(y_dst, u_dst, v_dst, src, 2, 1, 0);
 
@@ -5280,6 +5290,9 @@ aipl_error_t aipl_color_convert_bgr888_to_i422_default(const void* input,
             src += 3;
             ++y_dst;
        }
+
+        if (width & 1)
+            aipl_cnvt_px_24bit_to_yuv_y(y_dst, src, 2, 1, 0);
     }
 
     return AIPL_ERR_OK;
@@ -5751,10 +5764,10 @@ aipl_error_t aipl_color_convert_rgb888_to_i422_default(const void* input,
         const uint8_t* src = src_ptr + i * pitch * 3;
 
         uint8_t* y_dst = y_ptr + i * width;
-        uint8_t* v_dst = v_ptr + i * width / 2;
-        uint8_t* u_dst = u_ptr + i * width / 2;
+        uint8_t* v_dst = v_ptr + i * (width / 2);
+        uint8_t* u_dst = u_ptr + i * (width / 2);
 
-        for (uint32_t j = 0; j < width; j += 2)
+        for (uint32_t j = 0; j + 1 < width; j += 2)
         {
             aipl_cnvt_px_24bit_to_yuv(y_dst, u_dst, v_dst, src, 0, 1, 2);
 
@@ -5768,6 +5781,9 @@ aipl_error_t aipl_color_convert_rgb888_to_i422_default(const void* input,
             src += 3;
             ++y_dst;
        }
+
+        if (width & 1)
+            aipl_cnvt_px_24bit_to_yuv_y(y_dst, src, 0, 1, 2);
     }
 
     return AIPL_ERR_OK;
@@ -6368,8 +6384,8 @@ aipl_error_t aipl_color_convert_rgb565_to_i422_default(const void* input,
         }
 
         src = src_ptr + i * pitch;
-        uint8_t* u_dst = u_ptr + i * width / 2;
-        uint8_t* v_dst = v_ptr + i * width / 2;
+        uint8_t* u_dst = u_ptr + i * (width / 2);
+        uint8_t* v_dst = v_ptr + i * (width / 2);
 
         for (uint32_t j = 0; j < width / 2; ++j)
         {
@@ -6885,10 +6901,10 @@ aipl_error_t aipl_color_convert_yv12_to_i422_default(const void* input,
     {
         const uint8_t* y_src = y_src_ptr + i * pitch;
         uint8_t* y_dst = y_dst_ptr + i * width;
-        const uint8_t* u_src = u_src_ptr + i / 2 * pitch / 2;
-        uint8_t* u_dst = u_dst_ptr + i * width / 2;
-        const uint8_t* v_src = v_src_ptr + i / 2 * pitch / 2;
-        uint8_t* v_dst = v_dst_ptr + i * width / 2;
+        const uint8_t* u_src = u_src_ptr + i / 2 * (pitch / 2);
+        uint8_t* u_dst = u_dst_ptr + i * (width / 2);
+        const uint8_t* v_src = v_src_ptr + i / 2 * (pitch / 2);
+        uint8_t* v_dst = v_dst_ptr + i * (width / 2);
 
         memcpy(y_dst, y_src, width);
         memcpy(u_dst, u_src, width / 2);
@@ -6924,9 +6940,9 @@ aipl_error_t aipl_color_convert_yv12_to_i444_default(const void* input,
     {
         const uint8_t* y_src = y_src_ptr + i * pitch;
         uint8_t* y_dst = y_dst_ptr + i * width;
-        const uint8_t* u_src = u_src_ptr + i / 2 * pitch / 2;
+        const uint8_t* u_src = u_src_ptr + i / 2 * (pitch / 2);
         uint8_t* u_dst = u_dst_ptr + i * width;
-        const uint8_t* v_src = v_src_ptr + i / 2 * pitch / 2;
+        const uint8_t* v_src = v_src_ptr + i / 2 * (pitch / 2);
         uint8_t* v_dst = v_dst_ptr + i * width;
 
         memcpy(y_dst, y_src, width);
@@ -7426,10 +7442,10 @@ aipl_error_t aipl_color_convert_i420_to_i422_default(const void* input,
     {
         const uint8_t* y_src = y_src_ptr + i * pitch;
         uint8_t* y_dst = y_dst_ptr + i * width;
-        const uint8_t* u_src = u_src_ptr + i / 2 * pitch / 2;
-        uint8_t* u_dst = u_dst_ptr + i * width / 2;
-        const uint8_t* v_src = v_src_ptr + i / 2 * pitch / 2;
-        uint8_t* v_dst = v_dst_ptr + i * width / 2;
+        const uint8_t* u_src = u_src_ptr + i / 2 * (pitch / 2);
+        uint8_t* u_dst = u_dst_ptr + i * (width / 2);
+        const uint8_t* v_src = v_src_ptr + i / 2 * (pitch / 2);
+        uint8_t* v_dst = v_dst_ptr + i * (width / 2);
 
         memcpy(y_dst, y_src, width);
         memcpy(u_dst, u_src, width / 2);
@@ -7465,9 +7481,9 @@ aipl_error_t aipl_color_convert_i420_to_i444_default(const void* input,
     {
         const uint8_t* y_src = y_src_ptr + i * pitch;
         uint8_t* y_dst = y_dst_ptr + i * width;
-        const uint8_t* u_src = u_src_ptr + i / 2 * pitch / 2;
+        const uint8_t* u_src = u_src_ptr + i / 2 * (pitch / 2);
         uint8_t* u_dst = u_dst_ptr + i * width;
-        const uint8_t* v_src = v_src_ptr + i / 2 * pitch / 2;
+        const uint8_t* v_src = v_src_ptr + i / 2 * (pitch / 2);
         uint8_t* v_dst = v_dst_ptr + i * width;
 
         memcpy(y_dst, y_src, width);
@@ -7770,8 +7786,8 @@ aipl_error_t aipl_color_convert_i422_to_argb8888_default(const void* input,
     for (uint32_t i = 0; i < height; ++i)
     {
         const uint8_t* y_src = y_ptr + i * pitch;
-        const uint8_t* u_src = u_ptr + i * pitch / 2;
-        const uint8_t* v_src = v_ptr + i * pitch / 2;
+        const uint8_t* u_src = u_ptr + i * (pitch / 2);
+        const uint8_t* v_src = v_ptr + i * (pitch / 2);
         aipl_argb8888_px_t* dst = dst_ptr + i * width;
 
         for (uint32_t j = 0; j < width; j += 2)
@@ -7815,8 +7831,8 @@ aipl_error_t aipl_color_convert_i422_to_argb4444_default(const void* input,
     for (uint32_t i = 0; i < height; ++i)
     {
         const uint8_t* y_src = y_ptr + i * pitch;
-        const uint8_t* u_src = u_ptr + i * pitch / 2;
-        const uint8_t* v_src = v_ptr + i * pitch / 2;
+        const uint8_t* u_src = u_ptr + i * (pitch / 2);
+        const uint8_t* v_src = v_ptr + i * (pitch / 2);
         aipl_argb4444_px_t* dst = dst_ptr + i * width;
 
         for (uint32_t j = 0; j < width; j += 2)
@@ -7860,8 +7876,8 @@ aipl_error_t aipl_color_convert_i422_to_argb1555_default(const void* input,
     for (uint32_t i = 0; i < height; ++i)
     {
         const uint8_t* y_src = y_ptr + i * pitch;
-        const uint8_t* u_src = u_ptr + i * pitch / 2;
-        const uint8_t* v_src = v_ptr + i * pitch / 2;
+        const uint8_t* u_src = u_ptr + i * (pitch / 2);
+        const uint8_t* v_src = v_ptr + i * (pitch / 2);
         aipl_argb1555_px_t* dst = dst_ptr + i * width;
 
         for (uint32_t j = 0; j < width; j += 2)
@@ -7905,8 +7921,8 @@ aipl_error_t aipl_color_convert_i422_to_rgba8888_default(const void* input,
     for (uint32_t i = 0; i < height; ++i)
     {
         const uint8_t* y_src = y_ptr + i * pitch;
-        const uint8_t* u_src = u_ptr + i * pitch / 2;
-        const uint8_t* v_src = v_ptr + i * pitch / 2;
+        const uint8_t* u_src = u_ptr + i * (pitch / 2);
+        const uint8_t* v_src = v_ptr + i * (pitch / 2);
         aipl_rgba8888_px_t* dst = dst_ptr + i * width;
 
         for (uint32_t j = 0; j < width; j += 2)
@@ -7950,8 +7966,8 @@ aipl_error_t aipl_color_convert_i422_to_rgba4444_default(const void* input,
     for (uint32_t i = 0; i < height; ++i)
     {
         const uint8_t* y_src = y_ptr + i * pitch;
-        const uint8_t* u_src = u_ptr + i * pitch / 2;
-        const uint8_t* v_src = v_ptr + i * pitch / 2;
+        const uint8_t* u_src = u_ptr + i * (pitch / 2);
+        const uint8_t* v_src = v_ptr + i * (pitch / 2);
         aipl_rgba4444_px_t* dst = dst_ptr + i * width;
 
         for (uint32_t j = 0; j < width; j += 2)
@@ -7995,8 +8011,8 @@ aipl_error_t aipl_color_convert_i422_to_rgba5551_default(const void* input,
     for (uint32_t i = 0; i < height; ++i)
     {
         const uint8_t* y_src = y_ptr + i * pitch;
-        const uint8_t* u_src = u_ptr + i * pitch / 2;
-        const uint8_t* v_src = v_ptr + i * pitch / 2;
+        const uint8_t* u_src = u_ptr + i * (pitch / 2);
+        const uint8_t* v_src = v_ptr + i * (pitch / 2);
         aipl_rgba5551_px_t* dst = dst_ptr + i * width;
 
         for (uint32_t j = 0; j < width; j += 2)
@@ -8068,8 +8084,8 @@ aipl_error_t aipl_color_convert_i422_to_rgb565_default(const void* input,
     for (uint32_t i = 0; i < height; ++i)
     {
         const uint8_t* y_src = y_ptr + i * pitch;
-        const uint8_t* u_src = u_ptr + i * pitch / 2;
-        const uint8_t* v_src = v_ptr + i * pitch / 2;
+        const uint8_t* u_src = u_ptr + i * (pitch / 2);
+        const uint8_t* v_src = v_ptr + i * (pitch / 2);
         aipl_rgb565_px_t* dst = dst_ptr + i * width;
 
         for (uint32_t j = 0; j < width; j += 2)
@@ -8120,12 +8136,12 @@ aipl_error_t aipl_color_convert_i422_to_yv12_default(const void* input,
 
         memcpy(y_dst, y_src, width);
 
-        if (!(i & 1))
+        if (!(i & 1) && i + 1 < height)
         {
-            const uint8_t* u_src = u_src_ptr + i * pitch / 2;
-            uint8_t* u_dst = u_dst_ptr + i * width / 4;
-            const uint8_t* v_src = v_src_ptr + i * pitch / 2;
-            uint8_t* v_dst = v_dst_ptr + i * width / 4;
+            const uint8_t* u_src = u_src_ptr + i * (pitch / 2);
+            uint8_t* u_dst = u_dst_ptr + i / 2 * (width / 2);
+            const uint8_t* v_src = v_src_ptr + i * (pitch / 2);
+            uint8_t* v_dst = v_dst_ptr + i / 2 * (width / 2);
 
             memcpy(u_dst, u_src, width / 2);
             memcpy(v_dst, v_src, width / 2);
@@ -8164,12 +8180,12 @@ aipl_error_t aipl_color_convert_i422_to_i420_default(const void* input,
 
         memcpy(y_dst, y_src, width);
 
-        if (!(i & 1))
+        if (!(i & 1) && i + 1 < height)
         {
-            const uint8_t* u_src = u_src_ptr + i * pitch / 2;
-            uint8_t* u_dst = u_dst_ptr + i * width / 4;
-            const uint8_t* v_src = v_src_ptr + i * pitch / 2;
-            uint8_t* v_dst = v_dst_ptr + i * width / 4;
+            const uint8_t* u_src = u_src_ptr + i * (pitch / 2);
+            uint8_t* u_dst = u_dst_ptr + i / 2 * (width / 2);
+            const uint8_t* v_src = v_src_ptr + i * (pitch / 2);
+            uint8_t* v_dst = v_dst_ptr + i / 2 * (width / 2);
 
             memcpy(u_dst, u_src, width / 2);
             memcpy(v_dst, v_src, width / 2);
@@ -8205,9 +8221,9 @@ aipl_error_t aipl_color_convert_i422_to_i444_default(const void* input,
     {
         const uint8_t* y_src = y_src_ptr + i * pitch;
         uint8_t* y_dst = y_dst_ptr + i * width;
-        const uint8_t* u_src = u_src_ptr + i * pitch / 2;
+        const uint8_t* u_src = u_src_ptr + i * (pitch / 2);
         uint8_t* u_dst = u_dst_ptr + i * width;
-        const uint8_t* v_src = v_src_ptr + i * pitch / 2;
+        const uint8_t* v_src = v_src_ptr + i * (pitch / 2);
         uint8_t* v_dst = v_dst_ptr + i * width;
 
         memcpy(y_dst, y_src, width);
@@ -8263,11 +8279,11 @@ aipl_error_t aipl_color_convert_i422_to_nv21_default(const void* input,
 
         memcpy(y_dst, y_src, width);
 
-        if (!(i & 1))
+        if (!(i & 1) && i + 1 < height)
         {
-            const uint8_t* u_src = u_src_ptr + i * pitch / 2;
+            const uint8_t* u_src = u_src_ptr + i * (pitch / 2);
             uint8_t* u_dst = u_dst_ptr + i / 2 * width;
-            const uint8_t* v_src = v_src_ptr + i * pitch / 2;
+            const uint8_t* v_src = v_src_ptr + i * (pitch / 2);
             uint8_t* v_dst = v_dst_ptr + i / 2 * width;
             for (uint32_t j = 0; j < width; j += 2)
             {
@@ -8309,11 +8325,11 @@ aipl_error_t aipl_color_convert_i422_to_nv12_default(const void* input,
 
         memcpy(y_dst, y_src, width);
 
-        if (!(i & 1))
+        if (!(i & 1) && i + 1 < height)
         {
-            const uint8_t* u_src = u_src_ptr + i * pitch / 2;
+            const uint8_t* u_src = u_src_ptr + i * (pitch / 2);
             uint8_t* u_dst = u_dst_ptr + i / 2 * width;
-            const uint8_t* v_src = v_src_ptr + i * pitch / 2;
+            const uint8_t* v_src = v_src_ptr + i * (pitch / 2);
             uint8_t* v_dst = v_dst_ptr + i / 2 * width;
             for (uint32_t j = 0; j < width; j += 2)
             {
@@ -8350,9 +8366,9 @@ aipl_error_t aipl_color_convert_i422_to_yuy2_default(const void* input,
     {
         const uint8_t* y_src = y_src_ptr + i * pitch;
         uint8_t* y_dst = y_dst_ptr + i * width * 2;
-        const uint8_t* u_src = u_src_ptr + i * pitch / 2;
+        const uint8_t* u_src = u_src_ptr + i * (pitch / 2);
         uint8_t* u_dst = u_dst_ptr + i * width * 2;
-        const uint8_t* v_src = v_src_ptr + i * pitch / 2;
+        const uint8_t* v_src = v_src_ptr + i * (pitch / 2);
         uint8_t* v_dst = v_dst_ptr + i * width * 2;
 
         for (uint32_t j = 0; j < width / 2; ++j)
@@ -8391,9 +8407,9 @@ aipl_error_t aipl_color_convert_i422_to_uyvy_default(const void* input,
     {
         const uint8_t* y_src = y_src_ptr + i * pitch;
         uint8_t* y_dst = y_dst_ptr + i * width * 2;
-        const uint8_t* u_src = u_src_ptr + i * pitch / 2;
+        const uint8_t* u_src = u_src_ptr + i * (pitch / 2);
         uint8_t* u_dst = u_dst_ptr + i * width * 2;
-        const uint8_t* v_src = v_src_ptr + i * pitch / 2;
+        const uint8_t* v_src = v_src_ptr + i * (pitch / 2);
         uint8_t* v_dst = v_dst_ptr + i * width * 2;
 
         for (uint32_t j = 0; j < width / 2; ++j)
@@ -8913,12 +8929,12 @@ aipl_error_t aipl_color_convert_i444_to_yv12_default(const void* input,
 
         memcpy(y_dst, y_src, width);
 
-        if (!(i & 1))
+        if (!(i & 1) && i + 1 < height)
         {
             const uint8_t* u_src = u_src_ptr + i * pitch;
-            uint8_t* u_dst = u_dst_ptr + i * width / 4;
+            uint8_t* u_dst = u_dst_ptr + i / 2 * (width / 2);
             const uint8_t* v_src = v_src_ptr + i * pitch;
-            uint8_t* v_dst = v_dst_ptr + i * width / 4;
+            uint8_t* v_dst = v_dst_ptr + i / 2 * (width / 2);
 
             for (uint32_t j = 0; j < width; j += 2)
             {
@@ -8960,12 +8976,12 @@ aipl_error_t aipl_color_convert_i444_to_i420_default(const void* input,
 
         memcpy(y_dst, y_src, width);
 
-        if (!(i & 1))
+        if (!(i & 1) && i + 1 < height)
         {
             const uint8_t* u_src = u_src_ptr + i * pitch;
-            uint8_t* u_dst = u_dst_ptr + i * width / 4;
+            uint8_t* u_dst = u_dst_ptr + i / 2 * (width / 2);
             const uint8_t* v_src = v_src_ptr + i * pitch;
-            uint8_t* v_dst = v_dst_ptr + i * width / 4;
+            uint8_t* v_dst = v_dst_ptr + i / 2 * (width / 2);
 
             for (uint32_t j = 0; j < width; j += 2)
             {
@@ -9005,9 +9021,9 @@ aipl_error_t aipl_color_convert_i444_to_i422_default(const void* input,
         const uint8_t* y_src = y_src_ptr + i * pitch;
         uint8_t* y_dst = y_dst_ptr + i * width;
         const uint8_t* u_src = u_src_ptr + i * pitch;
-        uint8_t* u_dst = u_dst_ptr + i * width / 2;
+        uint8_t* u_dst = u_dst_ptr + i * (width / 2);
         const uint8_t* v_src = v_src_ptr + i * pitch;
-        uint8_t* v_dst = v_dst_ptr + i * width / 2;
+        uint8_t* v_dst = v_dst_ptr + i * (width / 2);
 
         memcpy(y_dst, y_src, width);
 
@@ -9062,7 +9078,7 @@ aipl_error_t aipl_color_convert_i444_to_nv21_default(const void* input,
 
         memcpy(y_dst, y_src, width);
 
-        if (!(i & 1))
+        if (!(i & 1) && i + 1 < height)
         {
             const uint8_t* u_src = u_src_ptr + i * pitch;
             uint8_t* u_dst = u_dst_ptr + i / 2 * width;
@@ -9109,7 +9125,7 @@ aipl_error_t aipl_color_convert_i444_to_nv12_default(const void* input,
 
         memcpy(y_dst, y_src, width);
 
-        if (!(i & 1))
+        if (!(i & 1) && i + 1 < height)
         {
             const uint8_t* u_src = u_src_ptr + i * pitch;
             uint8_t* u_dst = u_dst_ptr + i / 2 * width;
@@ -9609,9 +9625,9 @@ aipl_error_t aipl_color_convert_nv12_to_i422_default(const void* input,
         const uint8_t* y_src = y_src_ptr + i * pitch;
         uint8_t* y_dst = y_dst_ptr + i * width;
         const uint8_t* u_src = u_src_ptr + i / 2 * pitch;
-        uint8_t* u_dst = u_dst_ptr + i * width / 2;
+        uint8_t* u_dst = u_dst_ptr + i * (width / 2);
         const uint8_t* v_src = v_src_ptr + i / 2 * pitch;
-        uint8_t* v_dst = v_dst_ptr + i * width / 2;
+        uint8_t* v_dst = v_dst_ptr + i * (width / 2);
 
         memcpy(y_dst, y_src, width);
 
@@ -10147,9 +10163,9 @@ aipl_error_t aipl_color_convert_nv21_to_i422_default(const void* input,
         const uint8_t* y_src = y_src_ptr + i * pitch;
         uint8_t* y_dst = y_dst_ptr + i * width;
         const uint8_t* u_src = u_src_ptr + i / 2 * pitch;
-        uint8_t* u_dst = u_dst_ptr + i * width / 2;
+        uint8_t* u_dst = u_dst_ptr + i * (width / 2);
         const uint8_t* v_src = v_src_ptr + i / 2 * pitch;
-        uint8_t* v_dst = v_dst_ptr + i * width / 2;
+        uint8_t* v_dst = v_dst_ptr + i * (width / 2);
 
         memcpy(y_dst, y_src, width);
 
@@ -10685,9 +10701,9 @@ aipl_error_t aipl_color_convert_yuy2_to_i422_default(const void* input,
         }
 
         const uint8_t* u_src = u_src_ptr + i * pitch * 2;
-        uint8_t* u_dst = u_dst_ptr + i * width / 2;
+        uint8_t* u_dst = u_dst_ptr + i * (width / 2);
         const uint8_t* v_src = v_src_ptr + i * pitch * 2;
-        uint8_t* v_dst = v_dst_ptr + i * width / 2;
+        uint8_t* v_dst = v_dst_ptr + i * (width / 2);
 
         for (uint32_t j = 0; j < width * 2; j += 4)
         {
@@ -11227,9 +11243,9 @@ aipl_error_t aipl_color_convert_uyvy_to_i422_default(const void* input,
         }
 
         const uint8_t* u_src = u_src_ptr + i * pitch * 2;
-        uint8_t* u_dst = u_dst_ptr + i * width / 2;
+        uint8_t* u_dst = u_dst_ptr + i * (width / 2);
         const uint8_t* v_src = v_src_ptr + i * pitch * 2;
-        uint8_t* v_dst = v_dst_ptr + i * width / 2;
+        uint8_t* v_dst = v_dst_ptr + i * (width / 2);
 
         for (uint32_t j = 0; j < width * 2; j += 4)
         {
@@ -11843,8 +11859,8 @@ aipl_error_t aipl_color_convert_i400_to_i422_default(const void* input,
 
         memcpy(y_dst, y_src, width);
 
-        uint8_t* v_dst = v_dst_ptr + i * width / 2;
-        uint8_t* u_dst = u_dst_ptr + i * width / 2;
+        uint8_t* v_dst = v_dst_ptr + i * (width / 2);
+        uint8_t* u_dst = u_dst_ptr + i * (width / 2);
 
         memset(u_dst, 0x80, width / 2);
         memset(v_dst, 0x80, width / 2);
@@ -12601,11 +12617,11 @@ static aipl_error_t aipl_color_convert_argb8888_to_yuv_planar_default(const void
         }
     }
 
-    for (uint32_t i = 0; i < height; i += 2)
+    for (uint32_t i = 0; i + 1 < height; i += 2)
     {
         const aipl_argb8888_px_t* src = src_ptr + i * pitch;
-        uint8_t* u_dst = u_ptr + i / 2 * width / 2;
-        uint8_t* v_dst = v_ptr + i / 2 * width / 2;
+        uint8_t* u_dst = u_ptr + i / 2 * (width / 2);
+        uint8_t* v_dst = v_ptr + i / 2 * (width / 2);
 
         for (uint32_t j = 0; j < width / 2; ++j)
         {
@@ -12650,7 +12666,7 @@ static aipl_error_t aipl_color_convert_argb8888_to_yuv_semi_planar_default(const
         }
     }
 
-    for (uint32_t i = 0; i < height; i += 2)
+    for (uint32_t i = 0; i + 1 < height; i += 2)
     {
         const aipl_argb8888_px_t* src = src_ptr + i * pitch;
         uint8_t* u_dst = u_ptr + i * width / 2;
@@ -12741,11 +12757,11 @@ static aipl_error_t aipl_color_convert_argb4444_to_yuv_planar_default(const void
         }
     }
 
-    for (uint32_t i = 0; i < height; i += 2)
+    for (uint32_t i = 0; i + 1 < height; i += 2)
     {
         const aipl_argb4444_px_t* src = src_ptr + i * pitch;
-        uint8_t* u_dst = u_ptr + i / 2 * width / 2;
-        uint8_t* v_dst = v_ptr + i / 2 * width / 2;
+        uint8_t* u_dst = u_ptr + i / 2 * (width / 2);
+        uint8_t* v_dst = v_ptr + i / 2 * (width / 2);
 
         for (uint32_t j = 0; j < width / 2; ++j)
         {
@@ -12790,7 +12806,7 @@ static aipl_error_t aipl_color_convert_argb4444_to_yuv_semi_planar_default(const
         }
     }
 
-    for (uint32_t i = 0; i < height; i += 2)
+    for (uint32_t i = 0; i + 1 < height; i += 2)
     {
         const aipl_argb4444_px_t* src = src_ptr + i * pitch;
         uint8_t* u_dst = u_ptr + i * width / 2;
@@ -12882,11 +12898,11 @@ static aipl_error_t aipl_color_convert_argb1555_to_yuv_planar_default(const void
         }
     }
 
-    for (uint32_t i = 0; i < height; i += 2)
+    for (uint32_t i = 0; i + 1 < height; i += 2)
     {
         const aipl_argb1555_px_t* src = src_ptr + i * pitch;
-        uint8_t* u_dst = u_ptr + i / 2 * width / 2;
-        uint8_t* v_dst = v_ptr + i / 2 * width / 2;
+        uint8_t* u_dst = u_ptr + i / 2 * (width / 2);
+        uint8_t* v_dst = v_ptr + i / 2 * (width / 2);
 
         for (uint32_t j = 0; j < width / 2; ++j)
         {
@@ -12931,7 +12947,7 @@ static aipl_error_t aipl_color_convert_argb1555_to_yuv_semi_planar_default(const
         }
     }
 
-    for (uint32_t i = 0; i < height; i += 2)
+    for (uint32_t i = 0; i + 1 < height; i += 2)
     {
         const aipl_argb1555_px_t* src = src_ptr + i * pitch;
         uint8_t* u_dst = u_ptr + i * width / 2;
@@ -13023,11 +13039,11 @@ static aipl_error_t aipl_color_convert_rgba8888_to_yuv_planar_default(const void
         }
     }
 
-    for (uint32_t i = 0; i < height; i += 2)
+    for (uint32_t i = 0; i + 1 < height; i += 2)
     {
         const aipl_rgba8888_px_t* src = src_ptr + i * pitch;
-        uint8_t* u_dst = u_ptr + i / 2 * width / 2;
-        uint8_t* v_dst = v_ptr + i / 2 * width / 2;
+        uint8_t* u_dst = u_ptr + i / 2 * (width / 2);
+        uint8_t* v_dst = v_ptr + i / 2 * (width / 2);
 
         for (uint32_t j = 0; j < width / 2; ++j)
         {
@@ -13072,7 +13088,7 @@ static aipl_error_t aipl_color_convert_rgba8888_to_yuv_semi_planar_default(const
         }
     }
 
-    for (uint32_t i = 0; i < height; i += 2)
+    for (uint32_t i = 0; i + 1 < height; i += 2)
     {
         const aipl_rgba8888_px_t* src = src_ptr + i * pitch;
         uint8_t* u_dst = u_ptr + i * width / 2;
@@ -13164,11 +13180,11 @@ static aipl_error_t aipl_color_convert_rgba4444_to_yuv_planar_default(const void
         }
     }
 
-    for (uint32_t i = 0; i < height; i += 2)
+    for (uint32_t i = 0; i + 1 < height; i += 2)
     {
         const aipl_rgba4444_px_t* src = src_ptr + i * pitch;
-        uint8_t* u_dst = u_ptr + i / 2 * width / 2;
-        uint8_t* v_dst = v_ptr + i / 2 * width / 2;
+        uint8_t* u_dst = u_ptr + i / 2 * (width / 2);
+        uint8_t* v_dst = v_ptr + i / 2 * (width / 2);
 
         for (uint32_t j = 0; j < width / 2; ++j)
         {
@@ -13213,7 +13229,7 @@ static aipl_error_t aipl_color_convert_rgba4444_to_yuv_semi_planar_default(const
         }
     }
 
-    for (uint32_t i = 0; i < height; i += 2)
+    for (uint32_t i = 0; i + 1 < height; i += 2)
     {
         const aipl_rgba4444_px_t* src = src_ptr + i * pitch;
         uint8_t* u_dst = u_ptr + i * width / 2;
@@ -13305,11 +13321,11 @@ static aipl_error_t aipl_color_convert_rgba5551_to_yuv_planar_default(const void
         }
     }
 
-    for (uint32_t i = 0; i < height; i += 2)
+    for (uint32_t i = 0; i + 1 < height; i += 2)
     {
         const aipl_rgba5551_px_t* src = src_ptr + i * pitch;
-        uint8_t* u_dst = u_ptr + i / 2 * width / 2;
-        uint8_t* v_dst = v_ptr + i / 2 * width / 2;
+        uint8_t* u_dst = u_ptr + i / 2 * (width / 2);
+        uint8_t* v_dst = v_ptr + i / 2 * (width / 2);
 
         for (uint32_t j = 0; j < width / 2; ++j)
         {
@@ -13354,7 +13370,7 @@ static aipl_error_t aipl_color_convert_rgba5551_to_yuv_semi_planar_default(const
         }
     }
 
-    for (uint32_t i = 0; i < height; i += 2)
+    for (uint32_t i = 0; i + 1 < height; i += 2)
     {
         const aipl_rgba5551_px_t* src = src_ptr + i * pitch;
         uint8_t* u_dst = u_ptr + i * width / 2;
@@ -13453,8 +13469,8 @@ static aipl_error_t aipl_color_convert_24bit_to_yuv_planar_default(const void* i
     for (uint32_t i = 0; i < height; i += 2)
     {
         const uint8_t* src = src_ptr + i * pitch * 3;
-        uint8_t* u_dst = u_ptr + i / 2 * width / 2;
-        uint8_t* v_dst = v_ptr + i / 2 * width / 2;
+        uint8_t* u_dst = u_ptr + i / 2 * (width / 2);
+        uint8_t* v_dst = v_ptr + i / 2 * (width / 2);
 
         for (uint32_t j = 0; j < width / 2; ++j)
         {
@@ -13633,8 +13649,8 @@ static aipl_error_t aipl_color_convert_i422_to_24bit_default(const void* input,
     for (uint32_t i = 0; i < height; ++i)
     {
         const uint8_t* y_src = y_ptr + i * pitch;
-        const uint8_t* u_src = u_ptr + i * pitch / 2;
-        const uint8_t* v_src = v_ptr + i * pitch / 2;
+        const uint8_t* u_src = u_ptr + i * (pitch / 2);
+        const uint8_t* v_src = v_ptr + i * (pitch / 2);
         uint8_t* dst = dst_ptr + i * width * 3;
 
         for (uint32_t j = 0; j < width; j += 2)
@@ -13734,11 +13750,11 @@ static aipl_error_t aipl_color_convert_rgb565_to_yuv_planar_default(const void*
         }
     }
 
-    for (uint32_t i = 0; i < height; i += 2)
+    for (uint32_t i = 0; i + 1 < height; i += 2)
     {
         const aipl_rgb565_px_t* src = src_ptr + i * pitch;
-        uint8_t* u_dst = u_ptr + i / 2 * width / 2;
-        uint8_t* v_dst = v_ptr + i / 2 * width / 2;
+        uint8_t* u_dst = u_ptr + i / 2 * (width / 2);
+        uint8_t* v_dst = v_ptr + i / 2 * (width / 2);
 
         for (uint32_t j = 0; j < width / 2; ++j)
         {
@@ -13783,7 +13799,7 @@ static aipl_error_t aipl_color_convert_rgb565_to_yuv_semi_planar_default(const v
         }
     }
 
-    for (uint32_t i = 0; i < height; i += 2)
+    for (uint32_t i = 0; i + 1 < height; i += 2)
     {
         const aipl_rgb565_px_t* src = src_ptr + i * pitch;
         uint8_t* u_dst = u_ptr + i * width / 2;
@@ -13908,8 +13924,8 @@ static aipl_error_t aipl_color_convert_yuv_planar_to_argb8888_default(const uint
     {
         const uint8_t* y_src0 = y_ptr + i * pitch;
         const uint8_t* y_src1 = y_src0 + pitch;
-        const uint8_t* u_src = u_ptr + i / 2 * pitch / 2;
-        const uint8_t* v_src = v_ptr + i / 2 * pitch / 2;
+        const uint8_t* u_src = u_ptr + i / 2 * (pitch / 2);
+        const uint8_t* v_src = v_ptr + i / 2 * (pitch / 2);
         aipl_argb8888_px_t* dst0 = dst_ptr + i * width;
         aipl_argb8888_px_t* dst1 = dst0 + width;
 
@@ -14043,8 +14059,8 @@ static aipl_error_t aipl_color_convert_yuv_planar_to_argb4444_default(const uint
     {
         const uint8_t* y_src0 = y_ptr + i * pitch;
         const uint8_t* y_src1 = y_src0 + pitch;
-        const uint8_t* u_src = u_ptr + i / 2 * pitch / 2;
-        const uint8_t* v_src = v_ptr + i / 2 * pitch / 2;
+        const uint8_t* u_src = u_ptr + i / 2 * (pitch / 2);
+        const uint8_t* v_src = v_ptr + i / 2 * (pitch / 2);
         aipl_argb4444_px_t* dst0 = dst_ptr + i * width;
         aipl_argb4444_px_t* dst1 = dst0 + width;
 
@@ -14178,8 +14194,8 @@ static aipl_error_t aipl_color_convert_yuv_planar_to_argb1555_default(const uint
     {
         const uint8_t* y_src0 = y_ptr + i * pitch;
         const uint8_t* y_src1 = y_src0 + pitch;
-        const uint8_t* u_src = u_ptr + i / 2 * pitch / 2;
-        const uint8_t* v_src = v_ptr + i / 2 * pitch / 2;
+        const uint8_t* u_src = u_ptr + i / 2 * (pitch / 2);
+        const uint8_t* v_src = v_ptr + i / 2 * (pitch / 2);
         aipl_argb1555_px_t* dst0 = dst_ptr + i * width;
         aipl_argb1555_px_t* dst1 = dst0 + width;
 
@@ -14313,8 +14329,8 @@ static aipl_error_t aipl_color_convert_yuv_planar_to_rgba8888_default(const uint
     {
         const uint8_t* y_src0 = y_ptr + i * pitch;
         const uint8_t* y_src1 = y_src0 + pitch;
-        const uint8_t* u_src = u_ptr + i / 2 * pitch / 2;
-        const uint8_t* v_src = v_ptr + i / 2 * pitch / 2;
+        const uint8_t* u_src = u_ptr + i / 2 * (pitch / 2);
+        const uint8_t* v_src = v_ptr + i / 2 * (pitch / 2);
         aipl_rgba8888_px_t* dst0 = dst_ptr + i * width;
         aipl_rgba8888_px_t* dst1 = dst0 + width;
 
@@ -14448,8 +14464,8 @@ static aipl_error_t aipl_color_convert_yuv_planar_to_rgba4444_default(const uint
     {
         const uint8_t* y_src0 = y_ptr + i * pitch;
         const uint8_t* y_src1 = y_src0 + pitch;
-        const uint8_t* u_src = u_ptr + i / 2 * pitch / 2;
-        const uint8_t* v_src = v_ptr + i / 2 * pitch / 2;
+        const uint8_t* u_src = u_ptr + i / 2 * (pitch / 2);
+        const uint8_t* v_src = v_ptr + i / 2 * (pitch / 2);
         aipl_rgba4444_px_t* dst0 = dst_ptr + i * width;
         aipl_rgba4444_px_t* dst1 = dst0 + width;
 
@@ -14583,8 +14599,8 @@ static aipl_error_t aipl_color_convert_yuv_planar_to_rgba5551_default(const uint
     {
         const uint8_t* y_src0 = y_ptr + i * pitch;
         const uint8_t* y_src1 = y_src0 + pitch;
-        const uint8_t* u_src = u_ptr + i / 2 * pitch / 2;
-        const uint8_t* v_src = v_ptr + i / 2 * pitch / 2;
+        const uint8_t* u_src = u_ptr + i / 2 * (pitch / 2);
+        const uint8_t* v_src = v_ptr + i / 2 * (pitch / 2);
         aipl_rgba5551_px_t* dst0 = dst_ptr + i * width;
         aipl_rgba5551_px_t* dst1 = dst0 + width;
 
@@ -14721,8 +14737,8 @@ static aipl_error_t aipl_color_convert_yuv_planar_to_24bit_default(const uint8_t
     {
         const uint8_t* y_src0 = y_ptr + i * pitch;
         const uint8_t* y_src1 = y_src0 + pitch;
-        const uint8_t* u_src = u_ptr + i / 2 * pitch / 2;
-        const uint8_t* v_src = v_ptr + i / 2 * pitch / 2;
+        const uint8_t* u_src = u_ptr + i / 2 * (pitch / 2);
+        const uint8_t* v_src = v_ptr + i / 2 * (pitch / 2);
         uint8_t* dst0 = dst_ptr + i * width * 3;
         uint8_t* dst1 = dst0 + width * 3;
 
@@ -14872,8 +14888,8 @@ static aipl_error_t aipl_color_convert_yuv_planar_to_rgb565_default(const uint8_
     {
         const uint8_t* y_src0 = y_ptr + i * pitch;
         const uint8_t* y_src1 = y_src0 + pitch;
-        const uint8_t* u_src = u_ptr + i / 2 * pitch / 2;
-        const uint8_t* v_src = v_ptr + i / 2 * pitch / 2;
+        const uint8_t* u_src = u_ptr + i / 2 * (pitch / 2);
+        const uint8_t* v_src = v_ptr + i / 2 * (pitch / 2);
         aipl_rgb565_px_t* dst0 = dst_ptr + i * width;
         aipl_rgb565_px_t* dst1 = dst0 + width;
 
@@ -15010,12 +15026,12 @@ static aipl_error_t aipl_color_convert_yuv_planar_to_planar_default(const uint8_
 
         memcpy(y_d, y_s, width);
 
-        if (!(i & 1))
+        if (!(i & 1) && i + 1 < height)
         {
-            const uint8_t* u_s = u_src + i * pitch / 4;
-            uint8_t* u_d = u_dst + i * width / 4;
-            const uint8_t* v_s = v_src + i * pitch / 4;
-            uint8_t* v_d = v_dst + i * width / 4;
+            const uint8_t* u_s = u_src + i / 2 * (pitch / 2);
+            uint8_t* u_d = u_dst + i / 2 * (width / 2);
+            const uint8_t* v_s = v_src + i / 2 * (pitch / 2);
+            uint8_t* v_d = v_dst + i / 2 * (width / 2);
 
             memcpy(u_d, u_s, width / 2);
             memcpy(v_d, v_s, width / 2);
@@ -15049,11 +15065,11 @@ static aipl_error_t aipl_color_convert_yuv_planar_to_semi_default(const uint8_t*
 
         memcpy(y_d, y_s, width);
 
-        if (!(i & 1))
+        if (!(i & 1) && i + 1 < height)
         {
-            const uint8_t* u_s = u_src + i / 2 * pitch / 2;
+            const uint8_t* u_s = u_src + i / 2 * (pitch / 2);
             uint8_t* u_d = u_dst + i / 2 * width;
-            const uint8_t* v_s = v_src + i / 2 * pitch / 2;
+            const uint8_t* v_s = v_src + i / 2 * (pitch / 2);
             uint8_t* v_d = v_dst + i / 2 * width;
             for (uint32_t j = 0; j < width; j += 2)
             {
@@ -15086,7 +15102,7 @@ static aipl_error_t aipl_color_convert_yuv_planar_to_packed_default(const uint8_
     {
         const uint8_t* y_s = y_src + i * pitch;
         uint8_t* y_d = y_dst + i * width * 2;
-        const uint8_t* u_s = u_src + i / 2 * pitch / 2;
+        const uint8_t* u_s = u_src + i / 2 * (pitch / 2);
         uint8_t* u_d = u_dst + i * width * 2;
         const uint8_t* v_s = v_src + i / 2* pitch / 2;
         uint8_t* v_d = v_dst + i * width * 2;
@@ -15127,12 +15143,12 @@ static aipl_error_t aipl_color_convert_yuv_semi_to_planar_default(const uint8_t*
 
         memcpy(y_d, y_s, width);
 
-        if (!(i & 1))
+        if (!(i & 1) && i + 1 < height)
         {
             const uint8_t* u_s = u_src + i / 2 * pitch;
-            uint8_t* u_d = u_dst + i / 2 * width / 2;
+            uint8_t* u_d = u_dst + i / 2 * (width / 2);
             const uint8_t* v_s = v_src + i / 2 * pitch;
-            uint8_t* v_d = v_dst + i / 2 * width / 2;
+            uint8_t* v_d = v_dst + i / 2 * (width / 2);
 
             for (uint32_t j = 0; j < width; j += 2)
             {
@@ -15168,7 +15184,7 @@ static aipl_error_t aipl_color_convert_yuv_semi_to_semi_planar_default(const uin
 
         memcpy(y_d, y_s, width);
 
-        if (!(i & 1))
+        if (!(i & 1) && i + 1 < height)
         {
             const uint8_t* u_s = u_src + i / 2 * pitch;
             uint8_t* u_d = u_dst + i / 2 * width;
@@ -15250,12 +15266,12 @@ static aipl_error_t aipl_color_convert_yuv_packed_to_planar_default(const uint8_
             y_d[j / 2] = y_s[j];
         }
 
-        if (!(i & 1))
+        if (!(i & 1) && i + 1 < height)
         {
             const uint8_t* u_s = u_src + i * pitch * 2;
-            uint8_t* u_d = u_dst + i / 2 * width / 2;
+            uint8_t* u_d = u_dst + i / 2 * (width / 2);
             const uint8_t* v_s = v_src + i * pitch * 2;
-            uint8_t* v_d = v_dst + i / 2 * width / 2;
+            uint8_t* v_d = v_dst + i / 2 * (width / 2);
 
             for (uint32_t j = 0; j < width * 2; j += 4)
             {
@@ -15295,7 +15311,7 @@ static aipl_error_t aipl_color_convert_yuv_packed_to_semi_default(const uint8_t*
             y_d[j / 2] = y_s[j];
         }
 
-        if (!(i & 1))
+        if (!(i & 1) && i + 1 < height)
         {
             const uint8_t* u_s = u_src + i * pitch * 2;
             uint8_t* u_d = u_dst + i / 2 * width;
@@ -15372,10 +15388,10 @@ static aipl_error_t aipl_color_convert_alpha8_to_yuv_planar_default(const uint8_
 
         memcpy(y_d, y_s, width);
 
-        if (!(i & 1))
+        if (!(i & 1) && i + 1 < height)
         {
-            uint8_t* uv_d0 = uv_dst0 + i / 2 * width / 2;
-            uint8_t* uv_d1 = uv_dst1 + i / 2 * width / 2;
+            uint8_t* uv_d0 = uv_dst0 + i / 2 * (width / 2);
+            uint8_t* uv_d1 = uv_dst1 + i / 2 * (width / 2);
 
             memset(uv_d0, 0x80, width / 2);
             memset(uv_d1, 0x80, width / 2);
@@ -15405,7 +15421,7 @@ static aipl_error_t aipl_color_convert_alpha8_to_yuv_semi_planar_default(const u
 
         memcpy(y_d, y_s, width);
 
-        if (!(i & 1))
+        if (!(i & 1) && i + 1 < height)
         {
             uint8_t* uv_d = uv_dst + i / 2 * width;
 
@@ -15559,3 +15575,198 @@ aipl_error_t aipl_color_convert_rgb888p_to_rgb565_default(const void* input,
 #endif
 #endif
 
+
+#if !defined(AIPL_HELIUM_ACCELERATION) || defined(AIPL_INCLUDE_ALL_DEFAULT)
+aipl_error_t aipl_color_convert_y16_to_i400_default(const void* input,
+                                                    void* output,
+                                                    uint32_t pitch,
+                                                    uint32_t width,
+                                                    uint32_t height,
+                                                    uint8_t shift)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    if (shift > 15)
+        return AIPL_ERR_NOT_SUPPORTED;
+
+    const uint16_t* src_ptr = input;
+    uint8_t* dst_ptr = output;
+
+    for (uint32_t i = 0; i < height; ++i)
+    {
+        const uint16_t* src = src_ptr + i * pitch;
+        uint8_t* dst = dst_ptr + i * width;
+
+        for (uint32_t j = 0; j < width; ++j)
+        {
+            uint16_t val = src[j] >> shift;
+
+            dst[j] = val > 0xff ? 0xff : val;
+        }
+    }
+
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_color_convert_y16_lut_default(const void* input,
+                                                void* output,
+                                                uint32_t pitch,
+                                                uint32_t width,
+                                                uint32_t height,
+                                                const uint8_t* lut,
+                                                uint8_t shift)
+{
+    if (input == NULL || output == NULL || lut == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    if (shift > 15)
+        return AIPL_ERR_NOT_SUPPORTED;
+
+    const uint16_t* src_ptr = input;
+    uint8_t* dst_ptr = output;
+
+    for (uint32_t i = 0; i < height; ++i)
+    {
+        const uint16_t* src = src_ptr + i * pitch;
+        uint8_t* dst = dst_ptr + i * width;
+
+        for (uint32_t j = 0; j < width; ++j)
+        {
+            dst[j] = lut[src[j] >> shift];
+        }
+    }
+
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_color_convert_i400_to_y16_default(const void* input,
+                                                    void* output,
+                                                    uint32_t pitch,
+                                                    uint32_t width,
+                                                    uint32_t height,
+                                                    uint8_t shift)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    if (shift > 8)
+        return AIPL_ERR_NOT_SUPPORTED;
+
+    const uint8_t* src_ptr = input;
+    uint16_t* dst_ptr = output;
+
+    for (uint32_t i = 0; i < height; ++i)
+    {
+        const uint8_t* src = src_ptr + i * pitch;
+        uint16_t* dst = dst_ptr + i * width;
+
+        /* The vacated low bits repeat the top bits so that
+           white maps to the largest value of the target depth */
+        for (uint32_t j = 0; j < width; ++j)
+        {
+            dst[j] = (src[j] << shift) | (src[j] >> (8 - shift));
+        }
+    }
+
+    return AIPL_ERR_OK;
+}
+#endif
+
+aipl_error_t aipl_color_copy_default(const void* input, void* output,
+                                     uint32_t pitch,
+                                     uint32_t width, uint32_t height,
+                                     aipl_color_format_t format)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    const uint8_t* src = input;
+    uint8_t* dst = output;
+    uint32_t size = pitch * height;
+    uint32_t copied = 0;
+
+    switch (format)
+    {
+        case AIPL_COLOR_RGB888P:
+        case AIPL_COLOR_I444:
+            for (uint32_t i = 0; i < 3; ++i)
+            {
+                copied += aipl_color_copy_plane(src + size * i, dst + copied,
+                                                pitch, width, height);
+            }
+            break;
+
+        case AIPL_COLOR_YV12:
+        case AIPL_COLOR_I420:
+            copied = aipl_color_copy_plane(src, dst, pitch, width, height);
+            copied += aipl_color_copy_plane(src + size, dst + copied,
+                                            pitch / 2, width / 2, height / 2);
+            copied += aipl_color_copy_plane(src + size + size / 4,
+                                            dst + copied,
+                                            pitch / 2, width / 2, height / 2);
+            break;
+
+        case AIPL_COLOR_I422:
+            copied = aipl_color_copy_plane(src, dst, pitch, width, height);
+            copied += aipl_color_copy_plane(src + size, dst + copied,
+                                            pitch / 2, width / 2, height);
+            copied += aipl_color_copy_plane(src + size + size / 2,
+                                            dst + copied,
+                                            pitch / 2, width / 2, height);
+            break;
+
+        case AIPL_COLOR_NV12:
+        case AIPL_COLOR_NV21:
+            copied = aipl_color_copy_plane(src, dst, pitch, width, height);
+            copied += aipl_color_copy_plane(src + size, dst + copied,
+                                            pitch, width, height / 2);
+            break;
+
+        case AIPL_COLOR_NV16:
+        case AIPL_COLOR_NV61:
+            copied = aipl_color_copy_plane(src, dst, pitch, width, height);
+            copied += aipl_color_copy_plane(src + size, dst + copied,
+                                            pitch, width, height);
+            break;
+
+        default:
+        {
+            /* Packed formats are a single plane of whole bytes per pixel */
+            uint32_t bytes = aipl_color_format_depth(format) / 8;
+
+            if (bytes == 0 || (format & (AIPL_COLOR_RLE | AIPL_COLOR_TILED)))
+                return AIPL_ERR_UNSUPPORTED_FORMAT;
+
+            copied = aipl_color_copy_plane(src, dst, pitch * bytes,
+                                           width * bytes, height);
+            break;
+        }
+    }
+
+    aipl_cpu_cache_clean(output, copied);
+
+    return AIPL_ERR_OK;
+}
+
+static uint32_t aipl_color_copy_plane(const uint8_t* input, uint8_t* output,
+                                      uint32_t pitch,
+                                      uint32_t width, uint32_t height)
+{
+    /* Output planes never start after the input ones,
+       so moving rows forward is also safe in place */
+    if (pitch == width)
+    {
+        if (input != output)
+            memmove(output, input, width * height);
+    }
+    else
+    {
+        for (uint32_t i = 0; i < height; ++i)
+        {
+            memmove(output + i * width, input + i * pitch, width);
+        }
+    }
+
+    return width * height;
+}
@@ -0,0 +1,1270 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/******************************************************************************
+ * @file    aipl_color_conversion_generic_default.c
+ * @brief   Default generic color conversion engine implementation
+ *
+******************************************************************************/
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "aipl_color_conversion_generic_default.h"
+
+#if AIPL_CONVERT_GENERIC
+
+#include <string.h>
+#include <stddef.h>
+
+#include "aipl_cache.h"
+#include "aipl_utils.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/* Number of pixels of a row converted at once. Must be even
+   so that chroma subsampled pairs never straddle two chunks */
+#define AIPL_CNVT_CHUNK 32
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/* Channels of the intermediate block a format is unpacked into
+   or packed from */
+typedef enum {
+    AIPL_CNVT_SPACE_RGB,    /* ARGB8888 pixels */
+    AIPL_CNVT_SPACE_YUV,    /* Y, U and V channels at full resolution */
+    AIPL_CNVT_SPACE_GRAY    /* Y channel only */
+} aipl_cnvt_space_t;
+
+/* Plane layout of an image */
+typedef struct {
+    uint8_t* plane[3];      /* RGB888P: R, G, B; YUV: Y, U, V */
+    uint32_t stride[3];     /* Row size of each plane in bytes */
+    uint32_t uv_width;      /* Number of chroma samples in a row */
+    uint32_t uv_height;     /* Number of chroma rows */
+} aipl_cnvt_frame_t;
+
+/* Canonical intermediate of two rows of a chunk */
+typedef struct {
+    aipl_argb8888_px_t rgb[2][AIPL_CNVT_CHUNK];
+    uint8_t y[2][AIPL_CNVT_CHUNK];
+    uint8_t u[2][AIPL_CNVT_CHUNK];
+    uint8_t v[2][AIPL_CNVT_CHUNK];
+} aipl_cnvt_block_t;
+
+typedef void (*aipl_cnvt_unpack_t)(const aipl_cnvt_frame_t* frame,
+                                   uint32_t x, uint32_t y,
+                                   uint32_t count, uint32_t rows,
+                                   aipl_cnvt_block_t* block);
+
+typedef void (*aipl_cnvt_pack_t)(const aipl_cnvt_frame_t* frame,
+                                 uint32_t x, uint32_t y,
+                                 uint32_t count, uint32_t rows,
+                                 const aipl_cnvt_block_t* block);
+
+typedef struct {
+    aipl_cnvt_unpack_t unpack;
+    aipl_cnvt_pack_t pack;
+    aipl_cnvt_space_t space;
+} aipl_cnvt_kernel_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void aipl_cnvt_frame_init(aipl_cnvt_frame_t* frame, uint8_t* data,
+                                 uint32_t pitch,
+                                 uint32_t width, uint32_t height,
+                                 aipl_color_format_t format);
+
+static void aipl_cnvt_space(aipl_cnvt_block_t* block,
+                            uint32_t count, uint32_t rows,
+                            aipl_cnvt_space_t src_space,
+                            aipl_cnvt_space_t dst_space,
+                            const aipl_yuv_coefs_t* coefs);
+
+static void aipl_cnvt_unpack_argb8888(const aipl_cnvt_frame_t* frame,
+                                      uint32_t x, uint32_t y,
+                                      uint32_t count, uint32_t rows,
+                                      aipl_cnvt_block_t* block);
+static void aipl_cnvt_pack_argb8888(const aipl_cnvt_frame_t* frame,
+                                    uint32_t x, uint32_t y,
+                                    uint32_t count, uint32_t rows,
+                                    const aipl_cnvt_block_t* block);
+static void aipl_cnvt_unpack_argb4444(const aipl_cnvt_frame_t* frame,
+                                      uint32_t x, uint32_t y,
+                                      uint32_t count, uint32_t rows,
+                                      aipl_cnvt_block_t* block);
+static void aipl_cnvt_pack_argb4444(const aipl_cnvt_frame_t* frame,
+                                    uint32_t x, uint32_t y,
+                                    uint32_t count, uint32_t rows,
+                                    const aipl_cnvt_block_t* block);
+static void aipl_cnvt_unpack_argb1555(const aipl_cnvt_frame_t* frame,
+                                      uint32_t x, uint32_t y,
+                                      uint32_t count, uint32_t rows,
+                                      aipl_cnvt_block_t* block);
+static void aipl_cnvt_pack_argb1555(const aipl_cnvt_frame_t* frame,
+                                    uint32_t x, uint32_t y,
+                                    uint32_t count, uint32_t rows,
+                                    const aipl_cnvt_block_t* block);
+static void aipl_cnvt_unpack_rgba8888(const aipl_cnvt_frame_t* frame,
+                                      uint32_t x, uint32_t y,
+                                      uint32_t count, uint32_t rows,
+                                      aipl_cnvt_block_t* block);
+static void aipl_cnvt_pack_rgba8888(const aipl_cnvt_frame_t* frame,
+                                    uint32_t x, uint32_t y,
+                                    uint32_t count, uint32_t rows,
+                                    const aipl_cnvt_block_t* block);
+static void aipl_cnvt_unpack_rgba4444(const aipl_cnvt_frame_t* frame,
+                                      uint32_t x, uint32_t y,
+                                      uint32_t count, uint32_t rows,
+                                      aipl_cnvt_block_t* block);
+static void aipl_cnvt_pack_rgba4444(const aipl_cnvt_frame_t* frame,
+                                    uint32_t x, uint32_t y,
+                                    uint32_t count, uint32_t rows,
+                                    const aipl_cnvt_block_t* block);
+static void aipl_cnvt_unpack_rgba5551(const aipl_cnvt_frame_t* frame,
+                                      uint32_t x, uint32_t y,
+                                      uint32_t count, uint32_t rows,
+                                      aipl_cnvt_block_t* block);
+static void aipl_cnvt_pack_rgba5551(const aipl_cnvt_frame_t* frame,
+                                    uint32_t x, uint32_t y,
+                                    uint32_t count, uint32_t rows,
+                                    const aipl_cnvt_block_t* block);
+static void aipl_cnvt_unpack_bgra8888(const aipl_cnvt_frame_t* frame,
+                                      uint32_t x, uint32_t y,
+                                      uint32_t count, uint32_t rows,
+                                      aipl_cnvt_block_t* block);
+static void aipl_cnvt_pack_bgra8888(const aipl_cnvt_frame_t* frame,
+                                    uint32_t x, uint32_t y,
+                                    uint32_t count, uint32_t rows,
+                                    const aipl_cnvt_block_t* block);
+static void aipl_cnvt_unpack_abgr8888(const aipl_cnvt_frame_t* frame,
+                                      uint32_t x, uint32_t y,
+                                      uint32_t count, uint32_t rows,
+                                      aipl_cnvt_block_t* block);
+static void aipl_cnvt_pack_abgr8888(const aipl_cnvt_frame_t* frame,
+                                    uint32_t x, uint32_t y,
+                                    uint32_t count, uint32_t rows,
+                                    const aipl_cnvt_block_t* block);
+static void aipl_cnvt_unpack_xrgb8888(const aipl_cnvt_frame_t* frame,
+                                      uint32_t x, uint32_t y,
+                                      uint32_t count, uint32_t rows,
+                                      aipl_cnvt_block_t* block);
+static void aipl_cnvt_pack_xrgb8888(const aipl_cnvt_frame_t* frame,
+                                    uint32_t x, uint32_t y,
+                                    uint32_t count, uint32_t rows,
+                                    const aipl_cnvt_block_t* block);
+static void aipl_cnvt_unpack_pargb8888(const aipl_cnvt_frame_t* frame,
+                                       uint32_t x, uint32_t y,
+                                       uint32_t count, uint32_t rows,
+                                       aipl_cnvt_block_t* block);
+static void aipl_cnvt_pack_pargb8888(const aipl_cnvt_frame_t* frame,
+                                     uint32_t x, uint32_t y,
+                                     uint32_t count, uint32_t rows,
+                                     const aipl_cnvt_block_t* block);
+static void aipl_cnvt_unpack_prgba8888(const aipl_cnvt_frame_t* frame,
+                                       uint32_t x, uint32_t y,
+                                       uint32_t count, uint32_t rows,
+                                       aipl_cnvt_block_t* block);
+static void aipl_cnvt_pack_prgba8888(const aipl_cnvt_frame_t* frame,
+                                     uint32_t x, uint32_t y,
+                                     uint32_t count, uint32_t rows,
+                                     const aipl_cnvt_block_t* block);
+static void aipl_cnvt_unpack_pargb4444(const aipl_cnvt_frame_t* frame,
+                                       uint32_t x, uint32_t y,
+                                       uint32_t count, uint32_t rows,
+                                       aipl_cnvt_block_t* block);
+static void aipl_cnvt_pack_pargb4444(const aipl_cnvt_frame_t* frame,
+                                     uint32_t x, uint32_t y,
+                                     uint32_t count, uint32_t rows,
+                                     const aipl_cnvt_block_t* block);
+static void aipl_cnvt_unpack_bgr888(const aipl_cnvt_frame_t* frame,
+                                    uint32_t x, uint32_t y,
+                                    uint32_t count, uint32_t rows,
+                                    aipl_cnvt_block_t* block);
+static void aipl_cnvt_pack_bgr888(const aipl_cnvt_frame_t* frame,
+                                  uint32_t x, uint32_t y,
+                                  uint32_t count, uint32_t rows,
+                                  const aipl_cnvt_block_t* block);
+static void aipl_cnvt_unpack_rgb888(const aipl_cnvt_frame_t* frame,
+                                    uint32_t x, uint32_t y,
+                                    uint32_t count, uint32_t rows,
+                                    aipl_cnvt_block_t* block);
+static void aipl_cnvt_pack_rgb888(const aipl_cnvt_frame_t* frame,
+                                  uint32_t x, uint32_t y,
+                                  uint32_t count, uint32_t rows,
+                                  const aipl_cnvt_block_t* block);
+static void aipl_cnvt_unpack_rgb888p(const aipl_cnvt_frame_t* frame,
+                                     uint32_t x, uint32_t y,
+                                     uint32_t count, uint32_t rows,
+                                     aipl_cnvt_block_t* block);
+static void aipl_cnvt_pack_rgb888p(const aipl_cnvt_frame_t* frame,
+                                   uint32_t x, uint32_t y,
+                                   uint32_t count, uint32_t rows,
+                                   const aipl_cnvt_block_t* block);
+static void aipl_cnvt_unpack_rgb565(const aipl_cnvt_frame_t* frame,
+                                    uint32_t x, uint32_t y,
+                                    uint32_t count, uint32_t rows,
+                                    aipl_cnvt_block_t* block);
+static void aipl_cnvt_pack_rgb565(const aipl_cnvt_frame_t* frame,
+                                  uint32_t x, uint32_t y,
+                                  uint32_t count, uint32_t rows,
+                                  const aipl_cnvt_block_t* block);
+
+static void aipl_cnvt_unpack_i400(const aipl_cnvt_frame_t* frame,
+                                  uint32_t x, uint32_t y,
+                                  uint32_t count, uint32_t rows,
+                                  aipl_cnvt_block_t* block);
+static void aipl_cnvt_pack_i400(const aipl_cnvt_frame_t* frame,
+                                uint32_t x, uint32_t y,
+                                uint32_t count, uint32_t rows,
+                                const aipl_cnvt_block_t* block);
+static void aipl_cnvt_unpack_y16(const aipl_cnvt_frame_t* frame,
+                                 uint32_t x, uint32_t y,
+                                 uint32_t count, uint32_t rows,
+                                 aipl_cnvt_block_t* block);
+static void aipl_cnvt_pack_y16(const aipl_cnvt_frame_t* frame,
+                               uint32_t x, uint32_t y,
+                               uint32_t count, uint32_t rows,
+                               const aipl_cnvt_block_t* block);
+static void aipl_cnvt_unpack_yuv_420(const aipl_cnvt_frame_t* frame,
+                                     uint32_t x, uint32_t y,
+                                     uint32_t count, uint32_t rows,
+                                     aipl_cnvt_block_t* block);
+static void aipl_cnvt_pack_yuv_420(const aipl_cnvt_frame_t* frame,
+                                   uint32_t x, uint32_t y,
+                                   uint32_t count, uint32_t rows,
+                                   const aipl_cnvt_block_t* block);
+static void aipl_cnvt_unpack_yuv_422(const aipl_cnvt_frame_t* frame,
+                                     uint32_t x, uint32_t y,
+                                     uint32_t count, uint32_t rows,
+                                     aipl_cnvt_block_t* block);
+static void aipl_cnvt_pack_yuv_422(const aipl_cnvt_frame_t* frame,
+                                   uint32_t x, uint32_t y,
+                                   uint32_t count, uint32_t rows,
+                                   const aipl_cnvt_block_t* block);
+static void aipl_cnvt_unpack_yuv_444(const aipl_cnvt_frame_t* frame,
+                                     uint32_t x, uint32_t y,
+                                     uint32_t count, uint32_t rows,
+                                     aipl_cnvt_block_t* block);
+static void aipl_cnvt_pack_yuv_444(const aipl_cnvt_frame_t* frame,
+                                   uint32_t x, uint32_t y,
+                                   uint32_t count, uint32_t rows,
+                                   const aipl_cnvt_block_t* block);
+static void aipl_cnvt_unpack_yuv_semi_planar(const aipl_cnvt_frame_t* frame,
+                                             uint32_t x, uint32_t y,
+                                             uint32_t count, uint32_t rows,
+                                             aipl_cnvt_block_t* block);
+static void aipl_cnvt_pack_yuv_semi_planar(const aipl_cnvt_frame_t* frame,
+                                           uint32_t x, uint32_t y,
+                                           uint32_t count, uint32_t rows,
+                                           const aipl_cnvt_block_t* block);
+static void aipl_cnvt_unpack_yuv_semi_planar_422(const aipl_cnvt_frame_t* frame,
+                                                 uint32_t x, uint32_t y,
+                                                 uint32_t count, uint32_t rows,
+                                                 aipl_cnvt_block_t* block);
+static void aipl_cnvt_pack_yuv_semi_planar_422(const aipl_cnvt_frame_t* frame,
+                                               uint32_t x, uint32_t y,
+                                               uint32_t count, uint32_t rows,
+                                               const aipl_cnvt_block_t* block);
+static void aipl_cnvt_unpack_yuv_packed(const aipl_cnvt_frame_t* frame,
+                                        uint32_t x, uint32_t y,
+                                        uint32_t count, uint32_t rows,
+                                        aipl_cnvt_block_t* block);
+static void aipl_cnvt_pack_yuv_packed(const aipl_cnvt_frame_t* frame,
+                                      uint32_t x, uint32_t y,
+                                      uint32_t count, uint32_t rows,
+                                      const aipl_cnvt_block_t* block);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/* One unpack and one pack kernel per format instead of one
+   converter per pair of formats */
+static const aipl_cnvt_kernel_t aipl_cnvt_kernels[AIPL_COLOR_NUM] = {
+    [AIPL_COLOR_ALPHA8]   = { aipl_cnvt_unpack_i400, aipl_cnvt_pack_i400,
+                              AIPL_CNVT_SPACE_GRAY },
+    [AIPL_COLOR_ARGB8888] = { aipl_cnvt_unpack_argb8888, aipl_cnvt_pack_argb8888,
+                              AIPL_CNVT_SPACE_RGB },
+    [AIPL_COLOR_ARGB4444] = { aipl_cnvt_unpack_argb4444, aipl_cnvt_pack_argb4444,
+                              AIPL_CNVT_SPACE_RGB },
+    [AIPL_COLOR_ARGB1555] = { aipl_cnvt_unpack_argb1555, aipl_cnvt_pack_argb1555,
+                              AIPL_CNVT_SPACE_RGB },
+    [AIPL_COLOR_RGBA8888] = { aipl_cnvt_unpack_rgba8888, aipl_cnvt_pack_rgba8888,
+                              AIPL_CNVT_SPACE_RGB },
+    [AIPL_COLOR_RGBA4444] = { aipl_cnvt_unpack_rgba4444, aipl_cnvt_pack_rgba4444,
+                              AIPL_CNVT_SPACE_RGB },
+    [AIPL_COLOR_RGBA5551] = { aipl_cnvt_unpack_rgba5551, aipl_cnvt_pack_rgba5551,
+                              AIPL_CNVT_SPACE_RGB },
+    [AIPL_COLOR_BGRA8888] = { aipl_cnvt_unpack_bgra8888, aipl_cnvt_pack_bgra8888,
+                              AIPL_CNVT_SPACE_RGB },
+    [AIPL_COLOR_ABGR8888] = { aipl_cnvt_unpack_abgr8888, aipl_cnvt_pack_abgr8888,
+                              AIPL_CNVT_SPACE_RGB },
+    [AIPL_COLOR_XRGB8888] = { aipl_cnvt_unpack_xrgb8888, aipl_cnvt_pack_xrgb8888,
+                              AIPL_CNVT_SPACE_RGB },
+    [AIPL_COLOR_PARGB8888] = { aipl_cnvt_unpack_pargb8888,
+                               aipl_cnvt_pack_pargb8888,
+                               AIPL_CNVT_SPACE_RGB },
+    [AIPL_COLOR_PRGBA8888] = { aipl_cnvt_unpack_prgba8888,
+                               aipl_cnvt_pack_prgba8888,
+                               AIPL_CNVT_SPACE_RGB },
+    [AIPL_COLOR_PARGB4444] = { aipl_cnvt_unpack_pargb4444,
+                               aipl_cnvt_pack_pargb4444,
+                               AIPL_CNVT_SPACE_RGB },
+    [AIPL_COLOR_BGR888]   = { aipl_cnvt_unpack_bgr888, aipl_cnvt_pack_bgr888,
+                              AIPL_CNVT_SPACE_RGB },
+    [AIPL_COLOR_RGB888]   = { aipl_cnvt_unpack_rgb888, aipl_cnvt_pack_rgb888,
+                              AIPL_CNVT_SPACE_RGB },
+    [AIPL_COLOR_RGB888P]  = { aipl_cnvt_unpack_rgb888p, aipl_cnvt_pack_rgb888p,
+                              AIPL_CNVT_SPACE_RGB },
+    [AIPL_COLOR_RGB565]   = { aipl_cnvt_unpack_rgb565, aipl_cnvt_pack_rgb565,
+                              AIPL_CNVT_SPACE_RGB },
+    [AIPL_COLOR_YV12]     = { aipl_cnvt_unpack_yuv_420, aipl_cnvt_pack_yuv_420,
+                              AIPL_CNVT_SPACE_YUV },
+    [AIPL_COLOR_I420]     = { aipl_cnvt_unpack_yuv_420, aipl_cnvt_pack_yuv_420,
+                              AIPL_CNVT_SPACE_YUV },
+    [AIPL_COLOR_I422]     = { aipl_cnvt_unpack_yuv_422, aipl_cnvt_pack_yuv_422,
+                              AIPL_CNVT_SPACE_YUV },
+    [AIPL_COLOR_I444]     = { aipl_cnvt_unpack_yuv_444, aipl_cnvt_pack_yuv_444,
+                              AIPL_CNVT_SPACE_YUV },
+    [AIPL_COLOR_I400]     = { aipl_cnvt_unpack_i400, aipl_cnvt_pack_i400,
+                              AIPL_CNVT_SPACE_GRAY },
+    [AIPL_COLOR_Y16]      = { aipl_cnvt_unpack_y16, aipl_cnvt_pack_y16,
+                              AIPL_CNVT_SPACE_GRAY },
+    [AIPL_COLOR_NV21]     = { aipl_cnvt_unpack_yuv_semi_planar,
+                              aipl_cnvt_pack_yuv_semi_planar,
+                              AIPL_CNVT_SPACE_YUV },
+    [AIPL_COLOR_NV12]     = { aipl_cnvt_unpack_yuv_semi_planar,
+                              aipl_cnvt_pack_yuv_semi_planar,
+                              AIPL_CNVT_SPACE_YUV },
+    [AIPL_COLOR_NV16]     = { aipl_cnvt_unpack_yuv_semi_planar_422,
+                              aipl_cnvt_pack_yuv_semi_planar_422,
+                              AIPL_CNVT_SPACE_YUV },
+    [AIPL_COLOR_NV61]     = { aipl_cnvt_unpack_yuv_semi_planar_422,
+                              aipl_cnvt_pack_yuv_semi_planar_422,
+                              AIPL_CNVT_SPACE_YUV },
+    [AIPL_COLOR_YUY2]     = { aipl_cnvt_unpack_yuv_packed,
+                              aipl_cnvt_pack_yuv_packed,
+                              AIPL_CNVT_SPACE_YUV },
+    [AIPL_COLOR_UYVY]     = { aipl_cnvt_unpack_yuv_packed,
+                              aipl_cnvt_pack_yuv_packed,
+                              AIPL_CNVT_SPACE_YUV },
+};
+
+/**********************
+ *      MACROS
+ **********************/
+/* Specialize the RGB kernels for a constant color format */
+#define AIPL_CNVT_RGB_KERNELS(name, format) \
+    static void aipl_cnvt_unpack_##name(const aipl_cnvt_frame_t* frame, \
+                                        uint32_t x, uint32_t y, \
+                                        uint32_t count, uint32_t rows, \
+                                        aipl_cnvt_block_t* block) \
+    { \
+        aipl_cnvt_unpack_rgb(frame, x, y, count, rows, block, format); \
+    } \
+    static void aipl_cnvt_pack_##name(const aipl_cnvt_frame_t* frame, \
+                                      uint32_t x, uint32_t y, \
+                                      uint32_t count, uint32_t rows, \
+                                      const aipl_cnvt_block_t* block) \
+    { \
+        aipl_cnvt_pack_rgb(frame, x, y, count, rows, block, format); \
+    }
+
+/* Specialize the RGB kernels for a premultiplied alpha variant
+   of a constant straight alpha color format */
+#define AIPL_CNVT_PREMULTIPLIED_KERNELS(name, format) \
+    static void aipl_cnvt_unpack_##name(const aipl_cnvt_frame_t* frame, \
+                                        uint32_t x, uint32_t y, \
+                                        uint32_t count, uint32_t rows, \
+                                        aipl_cnvt_block_t* block) \
+    { \
+        aipl_cnvt_unpack_premultiplied(frame, x, y, count, rows, block, \
+                                       format); \
+    } \
+    static void aipl_cnvt_pack_##name(const aipl_cnvt_frame_t* frame, \
+                                      uint32_t x, uint32_t y, \
+                                      uint32_t count, uint32_t rows, \
+                                      const aipl_cnvt_block_t* block) \
+    { \
+        aipl_cnvt_pack_premultiplied(frame, x, y, count, rows, block, \
+                                     format); \
+    }
+
+/* Specialize the YUV kernels for a constant layout: distance between
+   Y samples, distance between chroma samples and chroma subsampling */
+#define AIPL_CNVT_YUV_KERNELS(name, y_step, uv_step, x_shift, y_shift) \
+    static void aipl_cnvt_unpack_##name(const aipl_cnvt_frame_t* frame, \
+                                        uint32_t x, uint32_t y, \
+                                        uint32_t count, uint32_t rows, \
+                                        aipl_cnvt_block_t* block) \
+    { \
+        aipl_cnvt_unpack_yuv(frame, x, y, count, rows, block, \
+                             y_step, uv_step, x_shift, y_shift); \
+    } \
+    static void aipl_cnvt_pack_##name(const aipl_cnvt_frame_t* frame, \
+                                      uint32_t x, uint32_t y, \
+                                      uint32_t count, uint32_t rows, \
+                                      const aipl_cnvt_block_t* block) \
+    { \
+        aipl_cnvt_pack_yuv(frame, x, y, count, rows, block, \
+                           y_step, uv_step, x_shift, y_shift); \
+    }
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+aipl_error_t aipl_color_convert_generic_default(const void* input,
+                                                void* output,
+                                                uint32_t pitch,
+                                                uint32_t width,
+                                                uint32_t height,
+                                                aipl_color_format_t input_format,
+                                                aipl_color_format_t output_format,
+                                                const aipl_yuv_coefs_t* coefs)
+{
+    if (input == NULL || output == NULL || coefs == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    if (input_format >= AIPL_COLOR_NUM || output_format >= AIPL_COLOR_NUM)
+        return AIPL_ERR_UNSUPPORTED_FORMAT;
+
+    const aipl_cnvt_kernel_t* src_kernel = &aipl_cnvt_kernels[input_format];
+    const aipl_cnvt_kernel_t* dst_kernel = &aipl_cnvt_kernels[output_format];
+
+    aipl_cnvt_frame_t src;
+    aipl_cnvt_frame_t dst;
+    aipl_cnvt_frame_init(&src, (uint8_t*)input, pitch,
+                         width, height, input_format);
+    aipl_cnvt_frame_init(&dst, output, width,
+                         width, height, output_format);
+
+    aipl_cnvt_block_t block;
+
+    /* Rows are processed in pairs to share 4:2:0 chroma rows */
+    for (uint32_t y = 0; y < height; y += 2)
+    {
+        uint32_t rows = height - y < 2 ? 1 : 2;
+
+        for (uint32_t x = 0; x < width; x += AIPL_CNVT_CHUNK)
+        {
+            uint32_t count = width - x < AIPL_CNVT_CHUNK ? width - x
+                                                         : AIPL_CNVT_CHUNK;
+
+            src_kernel->unpack(&src, x, y, count, rows, &block);
+            aipl_cnvt_space(&block, count, rows,
+                            src_kernel->space, dst_kernel->space, coefs);
+            dst_kernel->pack(&dst, x, y, count, rows, &block);
+        }
+    }
+
+    size_t size = width * height * aipl_color_format_depth(output_format) / 8;
+    aipl_cpu_cache_clean(output, size);
+
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_color_convert_multi_generic_default(const void* input,
+                                                      uint32_t pitch,
+                                                      uint32_t width,
+                                                      uint32_t height,
+                                                      aipl_color_format_t input_format,
+                                                      const aipl_color_output_t* outputs,
+                                                      uint32_t output_num,
+                                                      const aipl_yuv_coefs_t* coefs)
+{
+    if (input == NULL || outputs == NULL || coefs == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    if (output_num == 0 || output_num > AIPL_CONVERT_MULTI_MAX)
+        return AIPL_ERR_NOT_SUPPORTED;
+
+    if (input_format >= AIPL_COLOR_NUM)
+        return AIPL_ERR_UNSUPPORTED_FORMAT;
+
+    const aipl_cnvt_kernel_t* src_kernel = &aipl_cnvt_kernels[input_format];
+    const aipl_cnvt_kernel_t* dst_kernels[AIPL_CONVERT_MULTI_MAX];
+    aipl_cnvt_frame_t dst[AIPL_CONVERT_MULTI_MAX];
+
+    for (uint32_t o = 0; o < output_num; ++o)
+    {
+        if (outputs[o].data == NULL)
+            return AIPL_ERR_NULL_POINTER;
+
+        if (outputs[o].format >= AIPL_COLOR_NUM)
+            return AIPL_ERR_UNSUPPORTED_FORMAT;
+
+        dst_kernels[o] = &aipl_cnvt_kernels[outputs[o].format];
+        aipl_cnvt_frame_init(&dst[o], outputs[o].data, width,
+                             width, height, outputs[o].format);
+    }
+
+    aipl_cnvt_frame_t src;
+    aipl_cnvt_frame_init(&src, (uint8_t*)input, pitch,
+                         width, height, input_format);
+
+    aipl_cnvt_block_t block;
+
+    for (uint32_t y = 0; y < height; y += 2)
+    {
+        uint32_t rows = height - y < 2 ? 1 : 2;
+
+        for (uint32_t x = 0; x < width; x += AIPL_CNVT_CHUNK)
+        {
+            uint32_t count = width - x < AIPL_CNVT_CHUNK ? width - x
+                                                         : AIPL_CNVT_CHUNK;
+
+            src_kernel->unpack(&src, x, y, count, rows, &block);
+
+            /* Every space is filled in at most once per block */
+            uint32_t spaces = 1 << src_kernel->space;
+
+            for (uint32_t o = 0; o < output_num; ++o)
+            {
+                aipl_cnvt_space_t space = dst_kernels[o]->space;
+
+                /* A YUV block also holds the GRAY channel */
+                if (spaces & (1 << AIPL_CNVT_SPACE_YUV))
+                    spaces |= 1 << AIPL_CNVT_SPACE_GRAY;
+
+                if (!(spaces & (1 << space)))
+                {
+                    aipl_cnvt_space(&block, count, rows,
+                                    src_kernel->space, space, coefs);
+                    spaces |= 1 << space;
+                }
+
+                dst_kernels[o]->pack(&dst[o], x, y, count, rows, &block);
+            }
+        }
+    }
+
+    for (uint32_t o = 0; o < output_num; ++o)
+    {
+        size_t size = width * height
+                      * aipl_color_format_depth(outputs[o].format) / 8;
+        aipl_cpu_cache_clean(outputs[o].data, size);
+    }
+
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_color_decode_generic_default(const void* input,
+                                               uint32_t pitch,
+                                               uint32_t width,
+                                               uint32_t height,
+                                               aipl_color_format_t format,
+                                               const aipl_yuv_coefs_t* coefs,
+                                               aipl_argb8888_sink_t sink,
+                                               void* ctx)
+{
+    if (input == NULL || coefs == NULL || sink == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    if (format >= AIPL_COLOR_NUM)
+        return AIPL_ERR_UNSUPPORTED_FORMAT;
+
+    const aipl_cnvt_kernel_t* src_kernel = &aipl_cnvt_kernels[format];
+
+    aipl_cnvt_frame_t src;
+    aipl_cnvt_frame_init(&src, (uint8_t*)input, pitch,
+                         width, height, format);
+
+    aipl_cnvt_block_t block;
+
+    for (uint32_t y = 0; y < height; y += 2)
+    {
+        uint32_t rows = height - y < 2 ? 1 : 2;
+
+        for (uint32_t x = 0; x < width; x += AIPL_CNVT_CHUNK)
+        {
+            uint32_t count = width - x < AIPL_CNVT_CHUNK ? width - x
+                                                         : AIPL_CNVT_CHUNK;
+
+            src_kernel->unpack(&src, x, y, count, rows, &block);
+            aipl_cnvt_space(&block, count, rows,
+                            src_kernel->space, AIPL_CNVT_SPACE_RGB, coefs);
+
+            for (uint32_t r = 0; r < rows; ++r)
+            {
+                sink(block.rgb[r], x, y + r, count, ctx);
+            }
+        }
+    }
+
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_color_encode_generic_default(void* output,
+                                               uint32_t width,
+                                               uint32_t height,
+                                               aipl_color_format_t format,
+                                               const aipl_yuv_coefs_t* coefs,
+                                               aipl_argb8888_source_t source,
+                                               void* ctx)
+{
+    if (output == NULL || coefs == NULL || source == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    if (format >= AIPL_COLOR_NUM)
+        return AIPL_ERR_UNSUPPORTED_FORMAT;
+
+    const aipl_cnvt_kernel_t* dst_kernel = &aipl_cnvt_kernels[format];
+
+    aipl_cnvt_frame_t dst;
+    aipl_cnvt_frame_init(&dst, output, width,
+                         width, height, format);
+
+    aipl_cnvt_block_t block;
+
+    for (uint32_t y = 0; y < height; y += 2)
+    {
+        uint32_t rows = height - y < 2 ? 1 : 2;
+
+        for (uint32_t x = 0; x < width; x += AIPL_CNVT_CHUNK)
+        {
+            uint32_t count = width - x < AIPL_CNVT_CHUNK ? width - x
+                                                         : AIPL_CNVT_CHUNK;
+
+            for (uint32_t r = 0; r < rows; ++r)
+            {
+                source(block.rgb[r], x, y + r, count, ctx);
+            }
+
+            aipl_cnvt_space(&block, count, rows,
+                            AIPL_CNVT_SPACE_RGB, dst_kernel->space, coefs);
+            dst_kernel->pack(&dst, x, y, count, rows, &block);
+        }
+    }
+
+    size_t size = width * height * aipl_color_format_depth(format) / 8;
+    aipl_cpu_cache_clean(output, size);
+
+    return AIPL_ERR_OK;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static void aipl_cnvt_frame_init(aipl_cnvt_frame_t* frame, uint8_t* data,
+                                 uint32_t pitch,
+                                 uint32_t width, uint32_t height,
+                                 aipl_color_format_t format)
+{
+    uint32_t size = pitch * height;
+
+    /* Subsampled chroma planes are laid out like the dedicated
+       converters and aipl_image_create() expect them: whole 2x2 (4:2:0)
+       or 2x1 (4:2:2) blocks only, a trailing odd row or column of an
+       image has no chroma of its own */
+    uint32_t uv_pitch = pitch / 2;
+
+    frame->plane[0] = data;
+    frame->stride[0] = pitch * aipl_color_format_depth(format) / 8;
+    frame->uv_width = width / 2;
+    frame->uv_height = height;
+
+    switch (format)
+    {
+        case AIPL_COLOR_RGB888P:
+            frame->stride[0] = pitch;
+            frame->plane[1] = data + size;
+            frame->plane[2] = data + size * 2;
+            frame->stride[1] = pitch;
+            frame->stride[2] = pitch;
+            break;
+
+        case AIPL_COLOR_YV12:
+            frame->stride[0] = pitch;
+            frame->plane[2] = data + size;
+            frame->plane[1] = data + size + size / 4;
+            frame->stride[1] = uv_pitch;
+            frame->stride[2] = uv_pitch;
+            frame->uv_height = height / 2;
+            break;
+
+        case AIPL_COLOR_I420:
+            frame->stride[0] = pitch;
+            frame->plane[1] = data + size;
+            frame->plane[2] = data + size + size / 4;
+            frame->stride[1] = uv_pitch;
+            frame->stride[2] = uv_pitch;
+            frame->uv_height = height / 2;
+            break;
+
+        case AIPL_COLOR_I422:
+            frame->stride[0] = pitch;
+            frame->plane[1] = data + size;
+            frame->plane[2] = data + size + size / 2;
+            frame->stride[1] = uv_pitch;
+            frame->stride[2] = uv_pitch;
+            break;
+
+        case AIPL_COLOR_I444:
+            frame->stride[0] = pitch;
+            frame->plane[1] = data + size;
+            frame->plane[2] = data + size * 2;
+            frame->stride[1] = pitch;
+            frame->stride[2] = pitch;
+            frame->uv_width = width;
+            break;
+
+        case AIPL_COLOR_NV12:
+        case AIPL_COLOR_NV16:
+            frame->stride[0] = pitch;
+            frame->plane[1] = data + size;
+            frame->plane[2] = data + size + 1;
+            frame->stride[1] = pitch;
+            frame->stride[2] = pitch;
+            if (format == AIPL_COLOR_NV12)
+                frame->uv_height = height / 2;
+            break;
+
+        case AIPL_COLOR_NV21:
+        case AIPL_COLOR_NV61:
+            frame->stride[0] = pitch;
+            frame->plane[2] = data + size;
+            frame->plane[1] = data + size + 1;
+            frame->stride[1] = pitch;
+            frame->stride[2] = pitch;
+            if (format == AIPL_COLOR_NV21)
+                frame->uv_height = height / 2;
+            break;
+
+        case AIPL_COLOR_YUY2:
+            frame->plane[1] = data + 1;
+            frame->plane[2] = data + 3;
+            frame->stride[1] = frame->stride[0];
+            frame->stride[2] = frame->stride[0];
+            break;
+
+        case AIPL_COLOR_UYVY:
+            frame->plane[0] = data + 1;
+            frame->plane[1] = data;
+            frame->plane[2] = data + 2;
+            frame->stride[1] = frame->stride[0];
+            frame->stride[2] = frame->stride[0];
+            break;
+
+        default:
+            frame->plane[1] = NULL;
+            frame->plane[2] = NULL;
+            frame->stride[1] = 0;
+            frame->stride[2] = 0;
+            break;
+    }
+}
+
+static void aipl_cnvt_space(aipl_cnvt_block_t* block,
+                            uint32_t count, uint32_t rows,
+                            aipl_cnvt_space_t src_space,
+                            aipl_cnvt_space_t dst_space,
+                            const aipl_yuv_coefs_t* coefs)
+{
+    for (uint32_t r = 0; r < rows; ++r)
+    {
+        aipl_argb8888_px_t* rgb = block->rgb[r];
+        uint8_t* y = block->y[r];
+        uint8_t* u = block->u[r];
+        uint8_t* v = block->v[r];
+
+        if (src_space == AIPL_CNVT_SPACE_RGB)
+        {
+            if (dst_space == AIPL_CNVT_SPACE_YUV)
+            {
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    aipl_cnvt_px_rgb_to_yuv_coefs(y + i, u + i, v + i,
+                                                  rgb[i].r, rgb[i].g, rgb[i].b,
+                                                  coefs);
+                }
+            }
+            else if (dst_space == AIPL_CNVT_SPACE_GRAY)
+            {
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    aipl_cnvt_px_rgb_to_yuv_y_coefs(y + i,
+                                                    rgb[i].r, rgb[i].g, rgb[i].b,
+                                                    coefs);
+                }
+            }
+        }
+        else if (src_space == AIPL_CNVT_SPACE_YUV)
+        {
+            if (dst_space == AIPL_CNVT_SPACE_RGB)
+            {
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    int32_t r_pre, g_pre, b_pre, c;
+                    aipl_pre_cnvt_px_yuv_to_rgb_coefs(&r_pre, &g_pre, &b_pre,
+                                                      u[i], v[i], coefs);
+                    aipl_pre_cnvt_px_y_coefs(&c, y[i], coefs);
+
+                    aipl_cnvt_px_yuv_to_argb8888(rgb + i, c,
+                                                 r_pre, g_pre, b_pre);
+                }
+            }
+        }
+        else
+        {
+            if (dst_space == AIPL_CNVT_SPACE_RGB)
+            {
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    aipl_cnvt_px_i400_to_argb8888(rgb + i, y + i);
+                }
+            }
+            else if (dst_space == AIPL_CNVT_SPACE_YUV)
+            {
+                memset(u, 0x80, count);
+                memset(v, 0x80, count);
+            }
+        }
+    }
+}
+
+static INLINE void aipl_cnvt_unpack_rgb(const aipl_cnvt_frame_t* frame,
+                                        uint32_t x, uint32_t y,
+                                        uint32_t count, uint32_t rows,
+                                        aipl_cnvt_block_t* block,
+                                        aipl_color_format_t format)
+{
+    for (uint32_t r = 0; r < rows; ++r)
+    {
+        aipl_argb8888_px_t* dst = block->rgb[r];
+        uint32_t offset = (y + r) * frame->stride[0];
+
+        switch (format)
+        {
+            case AIPL_COLOR_ARGB8888:
+                memcpy(dst, frame->plane[0] + offset + x * 4, count * 4);
+                break;
+
+            case AIPL_COLOR_RGBA8888:
+            {
+                const aipl_rgba8888_px_t* src =
+                    (const aipl_rgba8888_px_t*)(frame->plane[0] + offset) + x;
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    aipl_cnvt_px_rgba8888_to_argb8888(dst + i, src + i);
+                }
+                break;
+            }
+
+            case AIPL_COLOR_BGRA8888:
+            {
+                const aipl_bgra8888_px_t* src =
+                    (const aipl_bgra8888_px_t*)(frame->plane[0] + offset) + x;
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    aipl_cnvt_px_bgra8888_to_argb8888(dst + i, src + i);
+                }
+                break;
+            }
+
+            case AIPL_COLOR_ABGR8888:
+            {
+                const aipl_abgr8888_px_t* src =
+                    (const aipl_abgr8888_px_t*)(frame->plane[0] + offset) + x;
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    aipl_cnvt_px_abgr8888_to_argb8888(dst + i, src + i);
+                }
+                break;
+            }
+
+            case AIPL_COLOR_XRGB8888:
+            {
+                /* The alpha byte is never read, pixels are opaque */
+                const aipl_argb8888_px_t* src =
+                    (const aipl_argb8888_px_t*)(frame->plane[0] + offset) + x;
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    dst[i].a = 0xff;
+                    dst[i].r = src[i].r;
+                    dst[i].g = src[i].g;
+                    dst[i].b = src[i].b;
+                }
+                break;
+            }
+
+            case AIPL_COLOR_BGR888:
+            case AIPL_COLOR_RGB888:
+            {
+                uint8_t r_offset = format == AIPL_COLOR_RGB888 ? 0 : 2;
+                uint8_t b_offset = 2 - r_offset;
+                const uint8_t* src = frame->plane[0] + offset + x * 3;
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    aipl_cnvt_px_24bit_to_argb8888(dst + i, src + i * 3,
+                                                   r_offset, 1, b_offset);
+                }
+                break;
+            }
+
+            case AIPL_COLOR_RGB888P:
+            {
+                const uint8_t* r_src = frame->plane[0] + offset + x;
+                const uint8_t* g_src = frame->plane[1] + offset + x;
+                const uint8_t* b_src = frame->plane[2] + offset + x;
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    dst[i].a = 0xff;
+                    dst[i].r = r_src[i];
+                    dst[i].g = g_src[i];
+                    dst[i].b = b_src[i];
+                }
+                break;
+            }
+
+            default:
+            {
+                const uint8_t* src = frame->plane[0] + offset + x * 2;
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    aipl_cnvt_px_16bit_to_argb8888(dst + i, src + i * 2, format);
+                }
+                break;
+            }
+        }
+    }
+}
+
+static INLINE void aipl_cnvt_pack_rgb(const aipl_cnvt_frame_t* frame,
+                                      uint32_t x, uint32_t y,
+                                      uint32_t count, uint32_t rows,
+                                      const aipl_cnvt_block_t* block,
+                                      aipl_color_format_t format)
+{
+    for (uint32_t r = 0; r < rows; ++r)
+    {
+        const aipl_argb8888_px_t* src = block->rgb[r];
+        uint32_t offset = (y + r) * frame->stride[0];
+
+        switch (format)
+        {
+            case AIPL_COLOR_ARGB8888:
+            /* The alpha byte is don't care, whole words are stored as is */
+            case AIPL_COLOR_XRGB8888:
+                memcpy(frame->plane[0] + offset + x * 4, src, count * 4);
+                break;
+
+            case AIPL_COLOR_RGBA8888:
+            {
+                aipl_rgba8888_px_t* dst =
+                    (aipl_rgba8888_px_t*)(frame->plane[0] + offset) + x;
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    aipl_cnvt_px_argb8888_to_rgba8888(dst + i, src + i);
+                }
+                break;
+            }
+
+            case AIPL_COLOR_BGRA8888:
+            {
+                aipl_bgra8888_px_t* dst =
+                    (aipl_bgra8888_px_t*)(frame->plane[0] + offset) + x;
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    aipl_cnvt_px_argb8888_to_bgra8888(dst + i, src + i);
+                }
+                break;
+            }
+
+            case AIPL_COLOR_ABGR8888:
+            {
+                aipl_abgr8888_px_t* dst =
+                    (aipl_abgr8888_px_t*)(frame->plane[0] + offset) + x;
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    aipl_cnvt_px_argb8888_to_abgr8888(dst + i, src + i);
+                }
+                break;
+            }
+
+            case AIPL_COLOR_BGR888:
+            case AIPL_COLOR_RGB888:
+            {
+                uint8_t r_offset = format == AIPL_COLOR_RGB888 ? 0 : 2;
+                uint8_t b_offset = 2 - r_offset;
+                uint8_t* dst = frame->plane[0] + offset + x * 3;
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    aipl_cnvt_px_argb8888_to_24bit(dst + i * 3, src + i,
+                                                   r_offset, 1, b_offset);
+                }
+                break;
+            }
+
+            case AIPL_COLOR_RGB888P:
+            {
+                uint8_t* r_dst = frame->plane[0] + offset + x;
+                uint8_t* g_dst = frame->plane[1] + offset + x;
+                uint8_t* b_dst = frame->plane[2] + offset + x;
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    r_dst[i] = src[i].r;
+                    g_dst[i] = src[i].g;
+                    b_dst[i] = src[i].b;
+                }
+                break;
+            }
+
+            default:
+            {
+                uint8_t* dst = frame->plane[0] + offset + x * 2;
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    aipl_cnvt_px_argb8888_to_16bit(dst + i * 2, src + i, format);
+                }
+                break;
+            }
+        }
+    }
+}
+
+/* The block always holds straight alpha, premultiplication is folded
+   into the unpack and pack of the same pass */
+static INLINE void aipl_cnvt_unpack_premultiplied(const aipl_cnvt_frame_t* frame,
+                                                  uint32_t x, uint32_t y,
+                                                  uint32_t count, uint32_t rows,
+                                                  aipl_cnvt_block_t* block,
+                                                  aipl_color_format_t format)
+{
+    aipl_cnvt_unpack_rgb(frame, x, y, count, rows, block, format);
+
+    for (uint32_t r = 0; r < rows; ++r)
+    {
+        aipl_argb8888_px_t* px = block->rgb[r];
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            aipl_cnvt_px_unpremultiply(px + i, px + i);
+        }
+    }
+}
+
+static INLINE void aipl_cnvt_pack_premultiplied(const aipl_cnvt_frame_t* frame,
+                                                uint32_t x, uint32_t y,
+                                                uint32_t count, uint32_t rows,
+                                                const aipl_cnvt_block_t* block,
+                                                aipl_color_format_t format)
+{
+    aipl_cnvt_block_t premultiplied;
+
+    for (uint32_t r = 0; r < rows; ++r)
+    {
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            aipl_cnvt_px_premultiply(&premultiplied.rgb[r][i],
+                                     &block->rgb[r][i]);
+        }
+    }
+
+    aipl_cnvt_pack_rgb(frame, x, y, count, rows, &premultiplied, format);
+}
+
+static INLINE void aipl_cnvt_unpack_yuv(const aipl_cnvt_frame_t* frame,
+                                        uint32_t x, uint32_t y,
+                                        uint32_t count, uint32_t rows,
+                                        aipl_cnvt_block_t* block,
+                                        uint32_t y_step, uint32_t uv_step,
+                                        uint32_t x_shift, uint32_t y_shift)
+{
+    for (uint32_t r = 0; r < rows; ++r)
+    {
+        const uint8_t* y_src = frame->plane[0] + (y + r) * frame->stride[0]
+                               + x * y_step;
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            block->y[r][i] = y_src[i * y_step];
+        }
+
+        /* A trailing odd row or column takes the chroma of the last
+           whole block, an image without one has neutral chroma */
+        if (frame->uv_width == 0 || frame->uv_height == 0)
+        {
+            memset(block->u[r], 128, count);
+            memset(block->v[r], 128, count);
+            continue;
+        }
+
+        uint32_t uv_row = (y + r) >> y_shift;
+        if (uv_row >= frame->uv_height)
+            uv_row = frame->uv_height - 1;
+
+        const uint8_t* u_src = frame->plane[1] + uv_row * frame->stride[1];
+        const uint8_t* v_src = frame->plane[2] + uv_row * frame->stride[2];
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            uint32_t uv_col = (x + i) >> x_shift;
+            if (uv_col >= frame->uv_width)
+                uv_col = frame->uv_width - 1;
+
+            block->u[r][i] = u_src[uv_col * uv_step];
+            block->v[r][i] = v_src[uv_col * uv_step];
+        }
+    }
+}
+
+static INLINE void aipl_cnvt_pack_yuv(const aipl_cnvt_frame_t* frame,
+                                      uint32_t x, uint32_t y,
+                                      uint32_t count, uint32_t rows,
+                                      const aipl_cnvt_block_t* block,
+                                      uint32_t y_step, uint32_t uv_step,
+                                      uint32_t x_shift, uint32_t y_shift)
+{
+    for (uint32_t r = 0; r < rows; ++r)
+    {
+        uint8_t* y_dst = frame->plane[0] + (y + r) * frame->stride[0]
+                         + x * y_step;
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            y_dst[i * y_step] = block->y[r][i];
+        }
+    }
+
+    /* Subsampled chroma is the rounded average of its block, a
+       trailing odd row or column has no chroma to write */
+    uint32_t uv_rows = y_shift ? 1 : rows;
+    uint32_t block_rows = y_shift ? 2 : 1;
+    uint32_t block_cols = x_shift ? 2 : 1;
+    uint32_t n = block_rows * block_cols;
+
+    for (uint32_t r = 0; r < uv_rows; ++r)
+    {
+        uint32_t uv_row = (y >> y_shift) + r;
+        if (uv_row >= frame->uv_height)
+            break;
+
+        uint8_t* u_dst = frame->plane[1] + uv_row * frame->stride[1];
+        uint8_t* v_dst = frame->plane[2] + uv_row * frame->stride[2];
+
+        for (uint32_t i = 0; i < count; i += block_cols)
+        {
+            uint32_t uv_col = (x + i) >> x_shift;
+            if (uv_col >= frame->uv_width)
+                break;
+
+            uint32_t uv = uv_col * uv_step;
+            uint32_t u = n / 2;
+            uint32_t v = n / 2;
+
+            for (uint32_t br = 0; br < block_rows; ++br)
+            {
+                for (uint32_t bc = 0; bc < block_cols; ++bc)
+                {
+                    u += block->u[r + br][i + bc];
+                    v += block->v[r + br][i + bc];
+                }
+            }
+
+            u_dst[uv] = u / n;
+            v_dst[uv] = v / n;
+        }
+    }
+}
+
+static void aipl_cnvt_unpack_i400(const aipl_cnvt_frame_t* frame,
+                                  uint32_t x, uint32_t y,
+                                  uint32_t count, uint32_t rows,
+                                  aipl_cnvt_block_t* block)
+{
+    for (uint32_t r = 0; r < rows; ++r)
+    {
+        memcpy(block->y[r], frame->plane[0] + (y + r) * frame->stride[0] + x,
+               count);
+    }
+}
+
+static void aipl_cnvt_pack_i400(const aipl_cnvt_frame_t* frame,
+                                uint32_t x, uint32_t y,
+                                uint32_t count, uint32_t rows,
+                                const aipl_cnvt_block_t* block)
+{
+    for (uint32_t r = 0; r < rows; ++r)
+    {
+        memcpy(frame->plane[0] + (y + r) * frame->stride[0] + x, block->y[r],
+               count);
+    }
+}
+
+/* 16-bit luma keeps the 8 most significant of its AIPL_Y16_BITS sample
+   bits and is widened back by replicating them into the low bits */
+static void aipl_cnvt_unpack_y16(const aipl_cnvt_frame_t* frame,
+                                 uint32_t x, uint32_t y,
+                                 uint32_t count, uint32_t rows,
+                                 aipl_cnvt_block_t* block)
+{
+    const uint32_t shift = AIPL_Y16_BITS - 8;
+
+    for (uint32_t r = 0; r < rows; ++r)
+    {
+        const uint16_t* src = (const uint16_t*)(frame->plane[0]
+                                                + (y + r) * frame->stride[0]) + x;
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            uint32_t val = src[i] >> shift;
+
+            block->y[r][i] = val > 255 ? 255 : val;
+        }
+    }
+}
+
+static void aipl_cnvt_pack_y16(const aipl_cnvt_frame_t* frame,
+                               uint32_t x, uint32_t y,
+                               uint32_t count, uint32_t rows,
+                               const aipl_cnvt_block_t* block)
+{
+    for (uint32_t r = 0; r < rows; ++r)
+    {
+        uint16_t* dst = (uint16_t*)(frame->plane[0]
+                                    + (y + r) * frame->stride[0]) + x;
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            uint32_t val = block->y[r][i];
+
+            dst[i] = (val << (AIPL_Y16_BITS - 8)) | (val >> (16 - AIPL_Y16_BITS));
+        }
+    }
+}
+
+AIPL_CNVT_RGB_KERNELS(argb8888, AIPL_COLOR_ARGB8888)
+AIPL_CNVT_RGB_KERNELS(argb4444, AIPL_COLOR_ARGB4444)
+AIPL_CNVT_RGB_KERNELS(argb1555, AIPL_COLOR_ARGB1555)
+AIPL_CNVT_RGB_KERNELS(rgba8888, AIPL_COLOR_RGBA8888)
+AIPL_CNVT_RGB_KERNELS(rgba4444, AIPL_COLOR_RGBA4444)
+AIPL_CNVT_RGB_KERNELS(rgba5551, AIPL_COLOR_RGBA5551)
+AIPL_CNVT_RGB_KERNELS(bgra8888, AIPL_COLOR_BGRA8888)
+AIPL_CNVT_RGB_KERNELS(abgr8888, AIPL_COLOR_ABGR8888)
+AIPL_CNVT_RGB_KERNELS(xrgb8888, AIPL_COLOR_XRGB8888)
+AIPL_CNVT_RGB_KERNELS(bgr888, AIPL_COLOR_BGR888)
+AIPL_CNVT_RGB_KERNELS(rgb888, AIPL_COLOR_RGB888)
+AIPL_CNVT_RGB_KERNELS(rgb888p, AIPL_COLOR_RGB888P)
+AIPL_CNVT_RGB_KERNELS(rgb565, AIPL_COLOR_RGB565)
+
+AIPL_CNVT_PREMULTIPLIED_KERNELS(pargb8888, AIPL_COLOR_ARGB8888)
+AIPL_CNVT_PREMULTIPLIED_KERNELS(prgba8888, AIPL_COLOR_RGBA8888)
+AIPL_CNVT_PREMULTIPLIED_KERNELS(pargb4444, AIPL_COLOR_ARGB4444)
+
+AIPL_CNVT_YUV_KERNELS(yuv_420, 1, 1, 1, 1)
+AIPL_CNVT_YUV_KERNELS(yuv_422, 1, 1, 1, 0)
+AIPL_CNVT_YUV_KERNELS(yuv_444, 1, 1, 0, 0)
+AIPL_CNVT_YUV_KERNELS(yuv_semi_planar, 1, 2, 1, 1)
+AIPL_CNVT_YUV_KERNELS(yuv_semi_planar_422, 1, 2, 1, 0)
+AIPL_CNVT_YUV_KERNELS(yuv_packed, 2, 4, 1, 0)
+
+#endif
@@ -37,6 +37,14 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static aipl_error_t aipl_crop_semi_planar_422_default(const void* input,
+                                                     void* output,
+                                                     uint32_t pitch,
+                                                     uint32_t height,
+                                                     uint32_t left,
+                                                     uint32_t top,
+                                                     uint32_t right,
+                                                     uint32_t bottom);
 
 /**********************
  *  STATIC VARIABLES
@@ -60,13 +68,24 @@ aipl_error_t aipl_crop_default(const void* input, void* output,
     if (input == NULL || output == NULL)
         return AIPL_ERR_NULL_POINTER;
 
-    if (format >= AIPL_COLOR_YV12)
+    bool semi_planar_422 = format == AIPL_COLOR_NV16
+                           || format == AIPL_COLOR_NV61;
+
+    if (aipl_color_format_space(format) != AIPL_SPACE_RGB
+        && format != AIPL_COLOR_Y16 && !semi_planar_422)
         return AIPL_ERR_UNSUPPORTED_FORMAT;
 
     // Checking the boundary
     if( (left > right) || (right > width) || (top > bottom) || (bottom > height) )
         return AIPL_ERR_FRAME_OUT_OF_RANGE;
 
+    if (semi_planar_422)
+    {
+        return aipl_crop_semi_planar_422_default(input, output, pitch,
+                                                 height,
+                                                 left, top, right, bottom);
+    }
+
     uint32_t bpp = aipl_color_format_depth (format);
 
     // Check for no cropping
@@ -137,3 +156,47 @@ aipl_error_t aipl_crop_img_default(const aipl_image_t* input,
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+static aipl_error_t aipl_crop_semi_planar_422_default(const void* input,
+                                                     void* output,
+                                                     uint32_t pitch,
+                                                     uint32_t height,
+                                                     uint32_t left,
+                                                     uint32_t top,
+                                                     uint32_t right,
+                                                     uint32_t bottom)
+{
+    // Chroma pairs can't be split horizontally
+    if ((left & 1) || (right & 1))
+        return AIPL_ERR_FRAME_OUT_OF_RANGE;
+
+    uint32_t new_width = right - left;
+    uint32_t new_height = bottom - top;
+
+    // Luma plane rows are followed by full height interleaved chroma rows
+    const uint8_t *ip_fb = (const uint8_t *)input + top * pitch + left;
+    const uint8_t *ip_uv = (const uint8_t *)input + pitch * height
+                           + top * pitch + left;
+    uint8_t *op_fb = (uint8_t *)output;
+    uint8_t *op_uv = op_fb + new_width * new_height;
+
+    // The output planes never pass the input ones so in-place is safe
+    for (uint32_t i = 0; i < new_height; ++i)
+    {
+        memmove(op_fb, ip_fb, new_width);
+
+        ip_fb += pitch;
+        op_fb += new_width;
+    }
+
+    for (uint32_t i = 0; i < new_height; ++i)
+    {
+        memmove(op_uv, ip_uv, new_width);
+
+        ip_uv += pitch;
+        op_uv += new_width;
+    }
+
+    aipl_cpu_cache_clean(output, new_width * new_height * 2);
+
+    return AIPL_ERR_OK;
+}
@@ -23,15 +23,112 @@
 #include <stddef.h>
 #include <string.h>
 
+#include "aipl_cache.h"
 #include "aipl_utils.h"
+#include "aipl_color_conversion_generic_default.h"
+#include "aipl_video_alloc.h"
 
 /*********************
  *      DEFINES
  *********************/
+/* Number of pixels of a row passed to a consumer at once. Must be even */
+#define AIPL_DEMOSAIC_CHUNK 32
+
+/*
+ * Rows held by the interpolation line buffer. Output rows are
+ * produced in pairs, each one needing two rows above and below it,
+ * and defect correction of a row waits for the two rows below it
+ */
+#define AIPL_DEMOSAIC_LINES 8
+
+/* Mirrored columns on each side of a buffered row */
+#define AIPL_DEMOSAIC_BORDER 2
 
 /**********************
  *      TYPEDEFS
  **********************/
+/* Packed or 16-bit raw image demosaicing state */
+typedef struct {
+    const uint8_t* input;
+    uint32_t stride;            /* Row size in bytes */
+    uint32_t height;
+    aipl_bayer_tile_t tile;     /* Filter phase only */
+    uint8_t shift;              /* Rounding shift of 16-bit samples */
+} aipl_demosaic_raw_ctx_t;
+
+/* Line buffered interpolating demosaicing state */
+typedef struct {
+    const uint8_t* input;
+    uint32_t pitch;
+    uint32_t width;
+    uint32_t height;
+    uint8_t red_row;
+    uint8_t red_col;
+    aipl_demosaic_mode_t mode;
+    bool dpc;                   /* Correct defective pixels */
+    uint8_t threshold;          /* Defective pixel detection threshold */
+    uint8_t* lines;             /* Circular buffer of bordered rows */
+    uint32_t next;              /* Next row to load into the buffer */
+    uint32_t ready;             /* Next row to pass defect correction */
+} aipl_demosaic_lines_ctx_t;
+
+/* Demosaicing with integrated scaling state */
+typedef struct {
+    const uint8_t* input;
+    uint32_t pitch;
+    uint32_t quad_width;
+    uint32_t quad_height;
+    uint32_t output_width;
+    uint32_t output_height;
+    uint32_t x_step;            /* Quads per output pixel in 16.16 */
+    uint32_t y_step;
+    aipl_bayer_tile_t tile;     /* Filter phase only */
+    aipl_demosaic_scale_t scale;
+} aipl_demosaic_resize_ctx_t;
+
+/* Region of interest demosaicing state */
+typedef struct {
+    const uint8_t* input;       /* Region origin */
+    uint32_t pitch;
+    int32_t rows;               /* Frame rows from the origin on */
+    int32_t cols;               /* Frame columns from the origin on */
+    uint8_t red_row;
+    uint8_t red_col;
+} aipl_demosaic_roi_ctx_t;
+
+/* Demosaicing statistics collection state */
+typedef struct {
+    aipl_demosaic_roi_ctx_t roi;    /* Whole image as the region */
+    aipl_demosaic_stats_t* stats;
+    uint32_t width;
+    uint32_t height;
+    uint8_t bin_shift;              /* Luma to histogram bin shift */
+    uint8_t prev[2];                /* Last luma of each row of a pair */
+} aipl_demosaic_stats_ctx_t;
+
+/* Corrected raw image demosaicing state */
+typedef struct {
+    const uint8_t* input;
+    uint32_t pitch;
+    uint32_t width;
+    uint32_t height;
+    uint8_t red_row;
+    uint8_t red_col;
+    const aipl_raw_correction_t* corr;
+    uint32_t x_step;            /* Gain grid points per sample in 16.16 */
+    uint32_t y_step;
+    uint8_t white;              /* Largest corrected sample */
+} aipl_demosaic_corrected_ctx_t;
+
+/* Output planes of a format written by the row encoder */
+typedef struct {
+    uint8_t* plane[3];          /* Y, U and V planes, U and V unused by RGB */
+    uint32_t stride[3];         /* Plane row size in bytes */
+    uint8_t step[3];            /* Bytes between neighbouring samples */
+    uint8_t x_shift;            /* Chroma subsampling */
+    uint8_t y_shift;
+    bool yuv;
+} aipl_demosaic_layout_t;
 
 /**********************
  *  STATIC PROTOTYPES
@@ -39,6 +136,122 @@
 static INLINE void aipl_bayer_to_rgb(uint8_t* rgb0, uint8_t* rgb1,
                                      aipl_bayer_tile_t* tile,
                                      uint32_t idx);
+static void aipl_demosaic_decode_row(aipl_bayer_tile_t* tile,
+                                     uint32_t width, uint32_t y,
+                                     aipl_argb8888_sink_t sink,
+                                     void* ctx);
+static INLINE void aipl_bayer16_to_rgb(uint16_t* rgb0, uint16_t* rgb1,
+                                       const aipl_bayer_tile_t* tile,
+                                       uint32_t idx);
+static INLINE void aipl_demosaic_bin2x2_row(aipl_argb8888_px_t* px,
+                                            uint32_t x, uint32_t y,
+                                            uint32_t count,
+                                            const aipl_demosaic_raw_ctx_t* raw);
+static uint8_t aipl_raw_white_level(const uint16_t* gains,
+                                    bool clip_highlights);
+static INLINE uint8_t aipl_raw10_px(const uint8_t* row, uint32_t x);
+static INLINE uint8_t aipl_raw12_px(const uint8_t* row, uint32_t x);
+static INLINE uint16_t aipl_raw10_px16(const uint8_t* row, uint32_t x);
+static INLINE uint16_t aipl_raw12_px16(const uint8_t* row, uint32_t x);
+static INLINE void aipl_demosaic_raw_row(aipl_argb8888_px_t* px,
+                                         uint32_t x, uint32_t y,
+                                         uint32_t count,
+                                         const aipl_demosaic_raw_ctx_t* raw,
+                                         aipl_raw_format_t format);
+static void aipl_demosaic_raw10_source(aipl_argb8888_px_t* px,
+                                       uint32_t x, uint32_t y,
+                                       uint32_t count,
+                                       void* ctx);
+static void aipl_demosaic_raw12_source(aipl_argb8888_px_t* px,
+                                       uint32_t x, uint32_t y,
+                                       uint32_t count,
+                                       void* ctx);
+static void aipl_demosaic_16bit_source(aipl_argb8888_px_t* px,
+                                       uint32_t x, uint32_t y,
+                                       uint32_t count,
+                                       void* ctx);
+static aipl_error_t aipl_demosaic_lines(const void* input, void* output,
+                                        uint32_t pitch,
+                                        uint32_t width, uint32_t height,
+                                        aipl_bayer_filter_t filter,
+                                        aipl_demosaic_mode_t mode,
+                                        bool dpc, uint8_t threshold,
+                                        aipl_color_format_t format);
+static INLINE uint8_t* aipl_demosaic_line(const aipl_demosaic_lines_ctx_t* ctx,
+                                          uint32_t row);
+static INLINE void aipl_demosaic_line_border(uint8_t* line, uint32_t width);
+static void aipl_demosaic_load_line(aipl_demosaic_lines_ctx_t* ctx,
+                                    uint32_t row);
+static void aipl_demosaic_correct_line(aipl_demosaic_lines_ctx_t* ctx,
+                                       uint32_t row);
+static INLINE uint8_t aipl_demosaic_clamp(int32_t val);
+static INLINE void aipl_demosaic_quad_px(aipl_argb8888_px_t* px,
+                                         const uint8_t* const* l,
+                                         int32_t c,
+                                         bool red_row, bool red_col);
+static INLINE void aipl_demosaic_bilinear_px(aipl_argb8888_px_t* px,
+                                             const uint8_t* const* l,
+                                             int32_t c,
+                                             bool red_row, bool red_col);
+static INLINE void aipl_demosaic_mhc_px(aipl_argb8888_px_t* px,
+                                        const uint8_t* const* l,
+                                        int32_t c,
+                                        bool red_row, bool red_col);
+static void aipl_demosaic_lines_source(aipl_argb8888_px_t* px,
+                                       uint32_t x, uint32_t y,
+                                       uint32_t count,
+                                       void* ctx);
+static void aipl_demosaic_bin2x2_source(aipl_argb8888_px_t* px,
+                                        uint32_t x, uint32_t y,
+                                        uint32_t count,
+                                        void* ctx);
+static INLINE void aipl_demosaic_quad_add(uint32_t* rgb,
+                                          const aipl_demosaic_resize_ctx_t* rs,
+                                          uint32_t qx, uint32_t qy,
+                                          uint32_t weight);
+static INLINE void aipl_demosaic_scale_pos(uint32_t idx, uint32_t step,
+                                           uint32_t size,
+                                           uint32_t* idx0, uint32_t* idx1,
+                                           uint32_t* frac);
+static void aipl_demosaic_resize_source(aipl_argb8888_px_t* px,
+                                        uint32_t x, uint32_t y,
+                                        uint32_t count,
+                                        void* ctx);
+static void aipl_demosaic_roi_source(aipl_argb8888_px_t* px,
+                                     uint32_t x, uint32_t y,
+                                     uint32_t count,
+                                     void* ctx);
+static void aipl_demosaic_stats_source(aipl_argb8888_px_t* px,
+                                       uint32_t x, uint32_t y,
+                                       uint32_t count,
+                                       void* ctx);
+static void aipl_raw_correct_row(uint8_t* dst,
+                                 const aipl_demosaic_corrected_ctx_t* ctx,
+                                 uint32_t row, uint32_t x, uint32_t count);
+static void aipl_demosaic_corrected_source(aipl_argb8888_px_t* px,
+                                           uint32_t x, uint32_t y,
+                                           uint32_t count,
+                                           void* ctx);
+static bool aipl_demosaic_layout(aipl_demosaic_layout_t* layout,
+                                 uint8_t* data,
+                                 uint32_t width, uint32_t height,
+                                 aipl_color_format_t format);
+static void aipl_demosaic_encode_rgb(const aipl_demosaic_layout_t* layout,
+                                     const aipl_argb8888_px_t* px,
+                                     uint32_t x, uint32_t y, uint32_t count,
+                                     aipl_color_format_t format);
+static void aipl_demosaic_encode_yuv(const aipl_demosaic_layout_t* layout,
+                                     aipl_argb8888_px_t (*px)[AIPL_DEMOSAIC_CHUNK],
+                                     uint32_t x, uint32_t y,
+                                     uint32_t count, uint32_t rows,
+                                     const aipl_yuv_coefs_t* coefs);
+static aipl_error_t aipl_demosaic_yuv_luma(const void* input,
+                                           uint8_t* y,
+                                           uint32_t pitch,
+                                           uint32_t width,
+                                           uint32_t height,
+                                           aipl_bayer_filter_t filter,
+                                           const aipl_yuv_coefs_t* coefs);
 static aipl_error_t aipl_demosaic_yuv_planar(const void* input,
                                              uint8_t* y,
                                              uint8_t* u,
@@ -46,7 +259,8 @@ static aipl_error_t aipl_demosaic_yuv_planar(const void* input,
                                              uint32_t pitch,
                                              uint32_t width,
                                              uint32_t height,
-                                             aipl_bayer_filter_t filter);
+                                             aipl_bayer_filter_t filter,
+                                             const aipl_yuv_coefs_t* coefs);
 static aipl_error_t aipl_demosaic_yuv_semi_planar(const void* input,
                                                   uint8_t* y,
                                                   uint8_t* u,
@@ -54,7 +268,8 @@ static aipl_error_t aipl_demosaic_yuv_semi_planar(const void* input,
                                                   uint32_t pitch,
                                                   uint32_t width,
                                                   uint32_t height,
-                                                  aipl_bayer_filter_t filter);
+                                                  aipl_bayer_filter_t filter,
+                                                  const aipl_yuv_coefs_t* coefs);
 static aipl_error_t aipl_demosaic_yuv_packed(const void* input,
                                              uint8_t* y,
                                              uint8_t* u,
@@ -62,7 +277,26 @@ static aipl_error_t aipl_demosaic_yuv_packed(const void* input,
                                              uint32_t pitch,
                                              uint32_t width,
                                              uint32_t height,
-                                             aipl_bayer_filter_t filter);
+                                             aipl_bayer_filter_t filter,
+                                             const aipl_yuv_coefs_t* coefs);
+static aipl_error_t aipl_demosaic_yuv_422(const void* input,
+                                          uint8_t* y,
+                                          uint8_t* u,
+                                          uint8_t* v,
+                                          uint32_t pitch,
+                                          uint32_t width,
+                                          uint32_t height,
+                                          aipl_bayer_filter_t filter,
+                                          const aipl_yuv_coefs_t* coefs);
+static aipl_error_t aipl_demosaic_yuv_444(const void* input,
+                                          uint8_t* y,
+                                          uint8_t* u,
+                                          uint8_t* v,
+                                          uint32_t pitch,
+                                          uint32_t width,
+                                          uint32_t height,
+                                          aipl_bayer_filter_t filter,
+                                          const aipl_yuv_coefs_t* coefs);
 
 /**********************
  *  STATIC VARIABLES
@@ -111,6 +345,9 @@ aipl_error_t aipl_demosaic_default(const void *input, void *output,
         case AIPL_COLOR_BGR888:
             return aipl_demosaic_bgr888_default(input, output, pitch,
                                                 width, height, filter);
+        case AIPL_COLOR_RGB888P:
+            return aipl_demosaic_rgb888p_default(input, output, pitch,
+                                                 width, height, filter);
         case AIPL_COLOR_RGB565:
             return aipl_demosaic_rgb565_default(input, output, pitch,
                                                 width, height, filter);
@@ -169,37 +406,12 @@ aipl_error_t aipl_demosaic_alpha8_default(const void* input,
                                           uint32_t height,
                                           aipl_bayer_filter_t filter)
 {
-    if (input == NULL || output == NULL)
-    {
-        return AIPL_ERR_NULL_POINTER;
-    }
-
-    aipl_bayer_tile_t tile = aipl_bayer_tile(input, pitch, filter);
-
-    for (uint32_t i = 0; i < height - 1; ++i)
-    {
-        uint8_t* dst = (uint8_t*)output + i * width;
-
-        for (uint32_t j = 0; j < width; j += 2)
-        {
-            uint8_t rgb0[3];
-            uint8_t rgb1[3];
-
-            aipl_bayer_to_rgb(rgb0, rgb1, &tile, j);
-
-            aipl_cnvt_px_rgb_to_yuv_y(dst + j, rgb0[0], rgb0[1], rgb0[2]);
-            aipl_cnvt_px_rgb_to_yuv_y(dst + j + 1, rgb1[0], rgb1[1], rgb1[2]);
-        }
-
-        tile.red_src += (i + tile.blue_row) % 2 * pitch * 2;
-        tile.blue_src += (i + tile.red_row) % 2 * pitch * 2;
-    }
-
-    memcpy((uint8_t*)output + (height - 1) * width,
-           (uint8_t*)output + (height - 2) * width,
-           width);
+    const aipl_yuv_coefs_t* coefs =
+        aipl_colorimetry_coefs(AIPL_COLORIMETRY_BT601_LIMITED);
 
-    return AIPL_ERR_OK;
+    return aipl_demosaic_colorimetry_default(input, output, pitch,
+                                             width, height, filter,
+                                             AIPL_COLOR_ALPHA8, coefs);
 }
 
 aipl_error_t aipl_demosaic_argb8888_default(const void* input,
@@ -512,6 +724,92 @@ aipl_error_t aipl_demosaic_bgr888_default(const void* input,
     return AIPL_ERR_OK;
 }
 
+aipl_error_t aipl_demosaic_rgb888p_default(const void* input,
+                                           void* output,
+                                           uint32_t pitch,
+                                           uint32_t width,
+                                           uint32_t height,
+                                           aipl_bayer_filter_t filter)
+{
+    if (output == NULL)
+    {
+        return AIPL_ERR_NULL_POINTER;
+    }
+
+    uint8_t* red = output;
+    uint8_t* green = red + width * height;
+    uint8_t* blue = green + width * height;
+
+    return aipl_demosaic_planar_default(input, red, green, blue,
+                                        pitch, NULL,
+                                        width, height, filter);
+}
+
+aipl_error_t aipl_demosaic_planar_default(const void* input,
+                                          void* red, void* green, void* blue,
+                                          uint32_t pitch,
+                                          const uint32_t plane_pitch[3],
+                                          uint32_t width, uint32_t height,
+                                          aipl_bayer_filter_t filter)
+{
+    if (input == NULL || red == NULL || green == NULL || blue == NULL)
+    {
+        return AIPL_ERR_NULL_POINTER;
+    }
+
+    uint32_t red_pitch = width;
+    uint32_t green_pitch = width;
+    uint32_t blue_pitch = width;
+
+    if (plane_pitch != NULL)
+    {
+        red_pitch = plane_pitch[0];
+        green_pitch = plane_pitch[1];
+        blue_pitch = plane_pitch[2];
+    }
+
+    if (red_pitch < width || green_pitch < width || blue_pitch < width)
+    {
+        return AIPL_ERR_FRAME_OUT_OF_RANGE;
+    }
+
+    aipl_bayer_tile_t tile = aipl_bayer_tile(input, pitch, filter);
+
+    for (uint32_t i = 0; i < height - 1; ++i)
+    {
+        uint8_t* dst_r = (uint8_t*)red + i * red_pitch;
+        uint8_t* dst_g = (uint8_t*)green + i * green_pitch;
+        uint8_t* dst_b = (uint8_t*)blue + i * blue_pitch;
+
+        for (uint32_t j = 0; j < width; j += 2)
+        {
+            uint8_t rgb0[3];
+            uint8_t rgb1[3];
+
+            aipl_bayer_to_rgb(rgb0, rgb1, &tile, j);
+
+            dst_r[j] = rgb0[0];
+            dst_r[j + 1] = rgb1[0];
+            dst_g[j] = rgb0[1];
+            dst_g[j + 1] = rgb1[1];
+            dst_b[j] = rgb0[2];
+            dst_b[j + 1] = rgb1[2];
+        }
+
+        tile.red_src += (i + tile.blue_row) % 2 * pitch * 2;
+        tile.blue_src += (i + tile.red_row) % 2 * pitch * 2;
+    }
+
+    memcpy((uint8_t*)red + (height - 1) * red_pitch,
+           (uint8_t*)red + (height - 2) * red_pitch, width);
+    memcpy((uint8_t*)green + (height - 1) * green_pitch,
+           (uint8_t*)green + (height - 2) * green_pitch, width);
+    memcpy((uint8_t*)blue + (height - 1) * blue_pitch,
+           (uint8_t*)blue + (height - 2) * blue_pitch, width);
+
+    return AIPL_ERR_OK;
+}
+
 aipl_error_t aipl_demosaic_rgb565_default(const void* input,
                                           void* output,
                                           uint32_t pitch,
@@ -557,12 +855,12 @@ aipl_error_t aipl_demosaic_yv12_default(const void* input, void* output,
                                         uint32_t width, uint32_t height,
                                         aipl_bayer_filter_t filter)
 {
-    uint8_t* y = output;
-    uint8_t* v = y + width * height;
-    uint8_t* u = v + width * height / 4;
+    const aipl_yuv_coefs_t* coefs =
+        aipl_colorimetry_coefs(AIPL_COLORIMETRY_BT601_LIMITED);
 
-    return aipl_demosaic_yuv_planar(input, y, u, v, pitch,
-                                          width, height, filter);
+    return aipl_demosaic_colorimetry_default(input, output, pitch,
+                                             width, height, filter,
+                                             AIPL_COLOR_YV12, coefs);
 }
 
 aipl_error_t aipl_demosaic_i420_default(const void* input, void* output,
@@ -570,12 +868,12 @@ aipl_error_t aipl_demosaic_i420_default(const void* input, void* output,
                                         uint32_t width, uint32_t height,
                                         aipl_bayer_filter_t filter)
 {
-    uint8_t* y = output;
-    uint8_t* u = y + width * height;
-    uint8_t* v = u + width * height / 4;
+    const aipl_yuv_coefs_t* coefs =
+        aipl_colorimetry_coefs(AIPL_COLORIMETRY_BT601_LIMITED);
 
-    return aipl_demosaic_yuv_planar(input, y, u, v, pitch,
-                                          width, height, filter);
+    return aipl_demosaic_colorimetry_default(input, output, pitch,
+                                             width, height, filter,
+                                             AIPL_COLOR_I420, coefs);
 }
 
 aipl_error_t aipl_demosaic_i422_default(const void* input, void* output,
@@ -583,53 +881,12 @@ aipl_error_t aipl_demosaic_i422_default(const void* input, void* output,
                                         uint32_t width, uint32_t height,
                                         aipl_bayer_filter_t filter)
 {
-    if (input == NULL || output == NULL)
-    {
-        return AIPL_ERR_NULL_POINTER;
-    }
-
-    uint8_t* y = output;
-    uint8_t* u = y + width * height;
-    uint8_t* v = u + width * height / 2;
-
-    aipl_bayer_tile_t tile = aipl_bayer_tile(input, pitch, filter);
-
-    for (uint32_t i = 0; i < height - 1; ++i)
-    {
-        uint8_t* y_dst = y + i * width;
-        uint8_t* u_dst = u + i * width / 2;
-        uint8_t* v_dst = v + i * width / 2;
-
-        for (uint32_t j = 0; j < width; j += 2)
-        {
-            uint8_t rgb0[3];
-            uint8_t rgb1[3];
-
-            aipl_bayer_to_rgb(rgb0, rgb1, &tile, j);
-
-            aipl_cnvt_px_rgb_to_yuv(y_dst + j,
-                                    u_dst + j / 2,
-                                    v_dst + j / 2,
-                                    rgb0[0], rgb0[1], rgb0[2]);
-            aipl_cnvt_px_rgb_to_yuv_y(y_dst + j + 1,
-                                      rgb1[0], rgb1[1], rgb1[2]);
-        }
-
-        tile.red_src += (i + tile.blue_row) % 2 * pitch * 2;
-        tile.blue_src += (i + tile.red_row) % 2 * pitch * 2;
-    }
-
-    memcpy(y + (height - 1) * width,
-           y + (height - 2) * width,
-           width);
-    memcpy(u + (height - 1) * width / 2,
-           u + (height - 2) * width / 2,
-           width / 2);
-    memcpy(v + (height - 1) * width / 2,
-           v + (height - 2) * width / 2,
-           width / 2);
+    const aipl_yuv_coefs_t* coefs =
+        aipl_colorimetry_coefs(AIPL_COLORIMETRY_BT601_LIMITED);
 
-    return AIPL_ERR_OK;
+    return aipl_demosaic_colorimetry_default(input, output, pitch,
+                                             width, height, filter,
+                                             AIPL_COLOR_I422, coefs);
 }
 
 aipl_error_t aipl_demosaic_i444_default(const void* input, void* output,
@@ -637,55 +894,12 @@ aipl_error_t aipl_demosaic_i444_default(const void* input, void* output,
                                         uint32_t width, uint32_t height,
                                         aipl_bayer_filter_t filter)
 {
-    if (input == NULL || output == NULL)
-    {
-        return AIPL_ERR_NULL_POINTER;
-    }
-
-    uint8_t* y = output;
-    uint8_t* u = y + width * height;
-    uint8_t* v = u + width * height;
+    const aipl_yuv_coefs_t* coefs =
+        aipl_colorimetry_coefs(AIPL_COLORIMETRY_BT601_LIMITED);
 
-    aipl_bayer_tile_t tile = aipl_bayer_tile(input, pitch, filter);
-
-    for (uint32_t i = 0; i < height - 1; ++i)
-    {
-        uint8_t* y_dst = y + i * width;
-        uint8_t* u_dst = u + i * width;
-        uint8_t* v_dst = v + i * width;
-
-        for (uint32_t j = 0; j < width; j += 2)
-        {
-            uint8_t rgb0[3];
-            uint8_t rgb1[3];
-
-            aipl_bayer_to_rgb(rgb0, rgb1, &tile, j);
-
-            aipl_cnvt_px_rgb_to_yuv(y_dst + j,
-                                    u_dst + j,
-                                    v_dst + j,
-                                    rgb0[0], rgb0[1], rgb0[2]);
-            aipl_cnvt_px_rgb_to_yuv(y_dst + j + 1,
-                                    u_dst + j + 1,
-                                    v_dst + j + 1,
-                                    rgb1[0], rgb1[1], rgb1[2]);
-        }
-
-        tile.red_src += (i + tile.blue_row) % 2 * pitch * 2;
-        tile.blue_src += (i + tile.red_row) % 2 * pitch * 2;
-    }
-
-    memcpy(y + (height - 1) * width,
-           y + (height - 2) * width,
-           width);
-    memcpy(u + (height - 1) * width,
-           u + (height - 2) * width,
-           width);
-    memcpy(v + (height - 1) * width,
-           v + (height - 2) * width,
-           width);
-
-    return AIPL_ERR_OK;
+    return aipl_demosaic_colorimetry_default(input, output, pitch,
+                                             width, height, filter,
+                                             AIPL_COLOR_I444, coefs);
 }
 
 aipl_error_t aipl_demosaic_i400_default(const void* input, void* output,
@@ -693,8 +907,12 @@ aipl_error_t aipl_demosaic_i400_default(const void* input, void* output,
                                         uint32_t width, uint32_t height,
                                         aipl_bayer_filter_t filter)
 {
-    return aipl_demosaic_alpha8_default(input, output, pitch,
-                                        width, height, filter);
+    const aipl_yuv_coefs_t* coefs =
+        aipl_colorimetry_coefs(AIPL_COLORIMETRY_BT601_LIMITED);
+
+    return aipl_demosaic_colorimetry_default(input, output, pitch,
+                                             width, height, filter,
+                                             AIPL_COLOR_I400, coefs);
 }
 
 aipl_error_t aipl_demosaic_nv12_default(const void* input, void* output,
@@ -702,12 +920,12 @@ aipl_error_t aipl_demosaic_nv12_default(const void* input, void* output,
                                         uint32_t width, uint32_t height,
                                         aipl_bayer_filter_t filter)
 {
-    uint8_t* y = output;
-    uint8_t* u = y + width * height;
-    uint8_t* v = u + 1;
+    const aipl_yuv_coefs_t* coefs =
+        aipl_colorimetry_coefs(AIPL_COLORIMETRY_BT601_LIMITED);
 
-    return aipl_demosaic_yuv_semi_planar(input, y, u, v, pitch,
-                                         width, height, filter);
+    return aipl_demosaic_colorimetry_default(input, output, pitch,
+                                             width, height, filter,
+                                             AIPL_COLOR_NV12, coefs);
 }
 
 aipl_error_t aipl_demosaic_nv21_default(const void* input, void* output,
@@ -715,12 +933,12 @@ aipl_error_t aipl_demosaic_nv21_default(const void* input, void* output,
                                         uint32_t width, uint32_t height,
                                         aipl_bayer_filter_t filter)
 {
-    uint8_t* y = output;
-    uint8_t* v = y + width * height;
-    uint8_t* u = v + 1;
+    const aipl_yuv_coefs_t* coefs =
+        aipl_colorimetry_coefs(AIPL_COLORIMETRY_BT601_LIMITED);
 
-    return aipl_demosaic_yuv_semi_planar(input, y, u, v, pitch,
-                                         width, height, filter);
+    return aipl_demosaic_colorimetry_default(input, output, pitch,
+                                             width, height, filter,
+                                             AIPL_COLOR_NV21, coefs);
 }
 
 aipl_error_t aipl_demosaic_yuy2_default(const void* input, void* output,
@@ -728,12 +946,12 @@ aipl_error_t aipl_demosaic_yuy2_default(const void* input, void* output,
                                         uint32_t width, uint32_t height,
                                         aipl_bayer_filter_t filter)
 {
-    uint8_t* y = output;
-    uint8_t* u = y + 1;
-    uint8_t* v = u + 2;
+    const aipl_yuv_coefs_t* coefs =
+        aipl_colorimetry_coefs(AIPL_COLORIMETRY_BT601_LIMITED);
 
-    return aipl_demosaic_yuv_packed(input, y, u, v, pitch,
-                                    width, height, filter);
+    return aipl_demosaic_colorimetry_default(input, output, pitch,
+                                             width, height, filter,
+                                             AIPL_COLOR_YUY2, coefs);
 }
 
 aipl_error_t aipl_demosaic_uyvy_default(const void* input, void* output,
@@ -741,105 +959,332 @@ aipl_error_t aipl_demosaic_uyvy_default(const void* input, void* output,
                                         uint32_t width, uint32_t height,
                                         aipl_bayer_filter_t filter)
 {
-    uint8_t* u = output;
-    uint8_t* y = u + 1;
-    uint8_t* v = u + 2;
+    const aipl_yuv_coefs_t* coefs =
+        aipl_colorimetry_coefs(AIPL_COLORIMETRY_BT601_LIMITED);
 
-    return aipl_demosaic_yuv_packed(input, y, u, v, pitch,
-                                    width, height, filter);
+    return aipl_demosaic_colorimetry_default(input, output, pitch,
+                                             width, height, filter,
+                                             AIPL_COLOR_UYVY, coefs);
 }
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
-static INLINE void aipl_bayer_to_rgb(uint8_t* rgb0, uint8_t* rgb1,
-                                     aipl_bayer_tile_t* tile,
-                                     uint32_t idx)
+aipl_error_t aipl_demosaic_colorimetry_default(const void* input, void* output,
+                                               uint32_t pitch,
+                                               uint32_t width, uint32_t height,
+                                               aipl_bayer_filter_t filter,
+                                               aipl_color_format_t format,
+                                               const aipl_yuv_coefs_t* coefs)
 {
-    uint32_t red_col_idx = idx + tile->red_col;
-    uint32_t blue_col_idx = idx + tile->blue_col;
+    if (input == NULL || output == NULL || coefs == NULL)
+    {
+        return AIPL_ERR_NULL_POINTER;
+    }
 
-    rgb0[0] = tile->red_src[red_col_idx];
-    rgb0[1] = (tile->red_src[blue_col_idx]
-               + tile->blue_src[red_col_idx]) >> 1;
-    rgb0[2] = tile->blue_src[blue_col_idx];
+    uint8_t* y = output;
+    uint32_t size = width * height;
 
-    uint32_t red_col_2dx = tile->red_col << 1;
-    uint32_t blue_col_2dx = tile->blue_col << 1;
+    switch (format)
+    {
+        case AIPL_COLOR_ALPHA8:
+        case AIPL_COLOR_I400:
+            return aipl_demosaic_yuv_luma(input, y, pitch,
+                                          width, height, filter, coefs);
+        case AIPL_COLOR_YV12:
+            return aipl_demosaic_yuv_planar(input, y,
+                                            y + size + size / 4, y + size,
+                                            pitch, width, height,
+                                            filter, coefs);
+        case AIPL_COLOR_I420:
+            return aipl_demosaic_yuv_planar(input, y,
+                                            y + size, y + size + size / 4,
+                                            pitch, width, height,
+                                            filter, coefs);
+        case AIPL_COLOR_I422:
+            return aipl_demosaic_yuv_422(input, y,
+                                         y + size, y + size + size / 2,
+                                         pitch, width, height,
+                                         filter, coefs);
+        case AIPL_COLOR_I444:
+            return aipl_demosaic_yuv_444(input, y,
+                                         y + size, y + size * 2,
+                                         pitch, width, height,
+                                         filter, coefs);
+        case AIPL_COLOR_NV12:
+            return aipl_demosaic_yuv_semi_planar(input, y,
+                                                 y + size, y + size + 1,
+                                                 pitch, width, height,
+                                                 filter, coefs);
+        case AIPL_COLOR_NV21:
+            return aipl_demosaic_yuv_semi_planar(input, y,
+                                                 y + size + 1, y + size,
+                                                 pitch, width, height,
+                                                 filter, coefs);
+        case AIPL_COLOR_YUY2:
+            return aipl_demosaic_yuv_packed(input, y, y + 1, y + 3,
+                                            pitch, width, height,
+                                            filter, coefs);
+        case AIPL_COLOR_UYVY:
+            return aipl_demosaic_yuv_packed(input, y + 1, y, y + 2,
+                                            pitch, width, height,
+                                            filter, coefs);
 
-    rgb1[0] = tile->red_src[red_col_idx + blue_col_2dx];
-    rgb1[1] = (tile->red_src[blue_col_idx + red_col_2dx]
-               + tile->blue_src[red_col_idx + blue_col_2dx]) >> 1;
-    rgb1[2] = tile->blue_src[blue_col_idx + red_col_2dx];
+        default:
+            return aipl_demosaic_default(input, output, pitch,
+                                         width, height, filter, format);
+    }
 }
 
-static aipl_error_t aipl_demosaic_yuv_planar(const void* input,
-                                             uint8_t* y,
-                                             uint8_t* u,
-                                             uint8_t* v,
-                                             uint32_t pitch,
-                                             uint32_t width,
-                                             uint32_t height,
-                                             aipl_bayer_filter_t filter)
+aipl_error_t aipl_demosaic_interpolate_default(const void* input,
+                                               void* output,
+                                               uint32_t pitch,
+                                               uint32_t width, uint32_t height,
+                                               aipl_bayer_filter_t filter,
+                                               aipl_demosaic_mode_t mode,
+                                               aipl_color_format_t format)
 {
-    if (input == NULL || y == NULL || u == NULL || v == NULL)
+    if (mode == AIPL_DEMOSAIC_QUAD)
     {
-        return AIPL_ERR_NULL_POINTER;
+        return aipl_demosaic_default(input, output, pitch,
+                                     width, height, filter, format);
     }
 
-    aipl_bayer_tile_t tile = aipl_bayer_tile(input, pitch, filter);
+    return aipl_demosaic_lines(input, output, pitch, width, height, filter,
+                               mode, false, 0, format);
+}
 
-    for (uint32_t i = 0; i < height - 1; ++i)
+aipl_error_t aipl_demosaic_dpc_default(const void* input, void* output,
+                                       uint32_t pitch,
+                                       uint32_t width, uint32_t height,
+                                       aipl_bayer_filter_t filter,
+                                       aipl_demosaic_mode_t mode,
+                                       uint8_t threshold,
+                                       aipl_color_format_t format)
+{
+    return aipl_demosaic_lines(input, output, pitch, width, height, filter,
+                               mode, true, threshold, format);
+}
+
+aipl_error_t aipl_demosaic_bin2x2_default(const void* input, void* output,
+                                          uint32_t pitch,
+                                          uint32_t width, uint32_t height,
+                                          aipl_bayer_filter_t filter,
+                                          aipl_color_format_t format)
+{
+    if (input == NULL || output == NULL)
     {
-        uint8_t* y_dst = y + i * width;
-        uint8_t* u_dst = u + i / 2 * width / 2;
-        uint8_t* v_dst = v + i / 2 * width / 2;
+        return AIPL_ERR_NULL_POINTER;
+    }
 
-        for (uint32_t j = 0; j < width; j += 2)
-        {
-            uint8_t rgb0[3];
-            uint8_t rgb1[3];
+    aipl_demosaic_raw_ctx_t ctx = {
+        .input = input,
+        .stride = pitch,
+        .height = height / 2,
+        .tile = aipl_bayer_tile(input, 0, filter),
+    };
 
-            aipl_bayer_to_rgb(rgb0, rgb1, &tile, j);
+    const aipl_yuv_coefs_t* coefs =
+        aipl_colorimetry_coefs(AIPL_COLORIMETRY_BT601_LIMITED);
 
-            if (i % 2 == 0)
-            {
-                aipl_cnvt_px_rgb_to_yuv(y_dst + j,
-                                        u_dst + j / 2,
-                                        v_dst + j / 2,
-                                        rgb0[0], rgb0[1], rgb0[2]);
-            }
-            else
-            {
-                aipl_cnvt_px_rgb_to_yuv_y(y_dst + j,
-                                          rgb0[0], rgb0[1], rgb0[2]);
-            }
+    return aipl_demosaic_encode_default(output, width / 2, height / 2,
+                                        format, coefs,
+                                        aipl_demosaic_bin2x2_source, &ctx);
+}
 
-            aipl_cnvt_px_rgb_to_yuv_y(y_dst + j + 1,
-                                      rgb1[0], rgb1[1], rgb1[2]);
-        }
+aipl_error_t aipl_demosaic_resize_default(const void* input, void* output,
+                                          uint32_t pitch,
+                                          uint32_t width, uint32_t height,
+                                          aipl_bayer_filter_t filter,
+                                          aipl_color_format_t format,
+                                          uint32_t output_width,
+                                          uint32_t output_height,
+                                          aipl_demosaic_scale_t scale)
+{
+    if (input == NULL || output == NULL)
+    {
+        return AIPL_ERR_NULL_POINTER;
+    }
 
-        tile.red_src += (i + tile.blue_row) % 2 * pitch * 2;
-        tile.blue_src += (i + tile.red_row) % 2 * pitch * 2;
+    if (scale >= AIPL_DEMOSAIC_SCALE_NUM)
+    {
+        return AIPL_ERR_NOT_SUPPORTED;
     }
 
-    memcpy(y + (height - 1) * width,
-           y + (height - 2) * width,
-           width);
+    if (width < 2 || height < 2 || output_width == 0 || output_height == 0)
+    {
+        return AIPL_ERR_FRAME_OUT_OF_RANGE;
+    }
 
-    return AIPL_ERR_OK;
+    aipl_demosaic_resize_ctx_t ctx = {
+        .input = input,
+        .pitch = pitch,
+        .quad_width = width / 2,
+        .quad_height = height / 2,
+        .output_width = output_width,
+        .output_height = output_height,
+        .x_step = ((width / 2) << 16) / output_width,
+        .y_step = ((height / 2) << 16) / output_height,
+        .tile = aipl_bayer_tile(input, 0, filter),
+        .scale = scale,
+    };
+
+    const aipl_yuv_coefs_t* coefs =
+        aipl_colorimetry_coefs(AIPL_COLORIMETRY_BT601_LIMITED);
+
+    return aipl_demosaic_encode_default(output, output_width, output_height,
+                                        format, coefs,
+                                        aipl_demosaic_resize_source, &ctx);
 }
 
-static aipl_error_t aipl_demosaic_yuv_semi_planar(const void* input,
-                                                  uint8_t* y,
-                                                  uint8_t* u,
-                                                  uint8_t* v,
-                                                  uint32_t pitch,
-                                                  uint32_t width,
-                                                  uint32_t height,
-                                                  aipl_bayer_filter_t filter)
+aipl_error_t aipl_demosaic_roi_default(const void* input, void* output,
+                                       uint32_t pitch,
+                                       uint32_t width, uint32_t height,
+                                       aipl_bayer_filter_t filter,
+                                       aipl_color_format_t format,
+                                       uint32_t left, uint32_t top,
+                                       uint32_t right, uint32_t bottom)
 {
-    if (input == NULL || y == NULL || u == NULL || v == NULL)
+    if (input == NULL || output == NULL)
+    {
+        return AIPL_ERR_NULL_POINTER;
+    }
+
+    if (left >= right || right > width || top >= bottom || bottom > height
+        || width < 2 || height < 2)
+    {
+        return AIPL_ERR_FRAME_OUT_OF_RANGE;
+    }
+
+    const uint8_t* origin = (const uint8_t*)input + top * pitch + left;
+    aipl_bayer_tile_t tile =
+        aipl_bayer_tile(origin, 0, aipl_bayer_filter_offset(filter, left, top));
+
+    aipl_demosaic_roi_ctx_t ctx = {
+        .input = origin,
+        .pitch = pitch,
+        .rows = height - top,
+        .cols = width - left,
+        .red_row = tile.red_row,
+        .red_col = tile.red_col,
+    };
+
+    const aipl_yuv_coefs_t* coefs =
+        aipl_colorimetry_coefs(AIPL_COLORIMETRY_BT601_LIMITED);
+
+    return aipl_demosaic_encode_default(output, right - left, bottom - top,
+                                        format, coefs,
+                                        aipl_demosaic_roi_source, &ctx);
+}
+
+aipl_error_t aipl_demosaic_corrected_default(const void* input, void* output,
+                                             uint32_t pitch,
+                                             uint32_t width, uint32_t height,
+                                             aipl_bayer_filter_t filter,
+                                             const aipl_raw_correction_t* correction,
+                                             aipl_color_format_t format)
+{
+    if (input == NULL || output == NULL || correction == NULL)
+    {
+        return AIPL_ERR_NULL_POINTER;
+    }
+
+    if (width < 2 || height < 2)
+    {
+        return AIPL_ERR_FRAME_OUT_OF_RANGE;
+    }
+
+    if (correction->gains != NULL
+        && (correction->grid_width < 2 || correction->grid_height < 2))
+    {
+        return AIPL_ERR_NOT_SUPPORTED;
+    }
+
+    aipl_bayer_tile_t tile = aipl_bayer_tile(input, 0, filter);
+
+    aipl_demosaic_corrected_ctx_t ctx = {
+        .input = input,
+        .pitch = pitch,
+        .width = width,
+        .height = height,
+        .red_row = tile.red_row,
+        .red_col = tile.red_col,
+        .corr = correction,
+        .x_step = ((correction->grid_width - 1) << 16) / (width - 1),
+        .y_step = ((correction->grid_height - 1) << 16) / (height - 1),
+        .white = aipl_raw_white_level(correction->channel_gains,
+                                      correction->clip_highlights),
+    };
+
+    const aipl_yuv_coefs_t* coefs =
+        aipl_colorimetry_coefs(AIPL_COLORIMETRY_BT601_LIMITED);
+
+    return aipl_demosaic_encode_default(output, width, height, format, coefs,
+                                        aipl_demosaic_corrected_source, &ctx);
+}
+
+aipl_error_t aipl_demosaic_stats_default(const void* input, void* output,
+                                         uint32_t pitch,
+                                         uint32_t width, uint32_t height,
+                                         aipl_bayer_filter_t filter,
+                                         aipl_color_format_t format,
+                                         aipl_demosaic_stats_t* stats)
+{
+    if (input == NULL || output == NULL || stats == NULL
+        || stats->cells == NULL || stats->histogram == NULL)
+    {
+        return AIPL_ERR_NULL_POINTER;
+    }
+
+    if (width < 2 || height < 2)
+    {
+        return AIPL_ERR_FRAME_OUT_OF_RANGE;
+    }
+
+    if (stats->grid_width == 0 || stats->grid_width > width
+        || stats->grid_height == 0 || stats->grid_height > height
+        || (stats->histogram_bins != 64 && stats->histogram_bins != 256))
+    {
+        return AIPL_ERR_NOT_SUPPORTED;
+    }
+
+    memset(stats->cells, 0, stats->grid_width * stats->grid_height
+                            * sizeof(aipl_stats_cell_t));
+    memset(stats->histogram, 0, stats->histogram_bins * sizeof(uint32_t));
+
+    aipl_bayer_tile_t tile = aipl_bayer_tile(input, 0, filter);
+
+    /*
+     * The region is one column wider than the image so the last column
+     * is made of the sample after it, as in aipl_demosaic()
+     */
+    aipl_demosaic_stats_ctx_t ctx = {
+        .roi = {
+            .input = input,
+            .pitch = pitch,
+            .rows = height,
+            .cols = width + 1,
+            .red_row = tile.red_row,
+            .red_col = tile.red_col,
+        },
+        .stats = stats,
+        .width = width,
+        .height = height,
+        .bin_shift = stats->histogram_bins == 64 ? 2 : 0,
+    };
+
+    const aipl_yuv_coefs_t* coefs =
+        aipl_colorimetry_coefs(AIPL_COLORIMETRY_BT601_LIMITED);
+
+    return aipl_demosaic_encode_default(output, width, height, format, coefs,
+                                        aipl_demosaic_stats_source, &ctx);
+}
+
+aipl_error_t aipl_demosaic_decode_default(const void* input,
+                                          uint32_t pitch,
+                                          uint32_t width, uint32_t height,
+                                          aipl_bayer_filter_t filter,
+                                          aipl_argb8888_sink_t sink,
+                                          void* ctx)
+{
+    if (input == NULL || sink == NULL)
     {
         return AIPL_ERR_NULL_POINTER;
     }
@@ -848,94 +1293,1862 @@ static aipl_error_t aipl_demosaic_yuv_semi_planar(const void* input,
 
     for (uint32_t i = 0; i < height - 1; ++i)
     {
-        uint8_t* y_dst = y + i * width;
-        uint8_t* u_dst = u + i / 2 * width;
-        uint8_t* v_dst = v + i / 2 * width;
+        aipl_demosaic_decode_row(&tile, width, i, sink, ctx);
 
-        for (uint32_t j = 0; j < width; j += 2)
+        /* The last row repeats the one above it */
+        if (i == height - 2)
         {
-            uint8_t rgb0[3];
-            uint8_t rgb1[3];
+            aipl_demosaic_decode_row(&tile, width, i + 1, sink, ctx);
+        }
 
-            aipl_bayer_to_rgb(rgb0, rgb1, &tile, j);
+        tile.red_src += (i + tile.blue_row) % 2 * pitch * 2;
+        tile.blue_src += (i + tile.red_row) % 2 * pitch * 2;
+    }
 
-            if (i % 2 == 0)
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_demosaic_bin2x2_decode_default(const void* input,
+                                                 uint32_t pitch,
+                                                 uint32_t width,
+                                                 uint32_t height,
+                                                 aipl_bayer_filter_t filter,
+                                                 aipl_argb8888_sink_t sink,
+                                                 void* ctx)
+{
+    if (input == NULL || sink == NULL)
+    {
+        return AIPL_ERR_NULL_POINTER;
+    }
+
+    aipl_demosaic_raw_ctx_t raw = {
+        .input = input,
+        .stride = pitch,
+        .height = height / 2,
+        .tile = aipl_bayer_tile(input, 0, filter),
+    };
+
+    aipl_argb8888_px_t px[AIPL_DEMOSAIC_CHUNK];
+
+    for (uint32_t i = 0; i < height / 2; ++i)
+    {
+        for (uint32_t x = 0; x < width / 2; x += AIPL_DEMOSAIC_CHUNK)
+        {
+            uint32_t count = width / 2 - x < AIPL_DEMOSAIC_CHUNK
+                             ? width / 2 - x : AIPL_DEMOSAIC_CHUNK;
+
+            aipl_demosaic_bin2x2_row(px, x, i, count, &raw);
+
+            sink(px, x, i, count, ctx);
+        }
+    }
+
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_demosaic_encode_default(void* output,
+                                          uint32_t width, uint32_t height,
+                                          aipl_color_format_t format,
+                                          const aipl_yuv_coefs_t* coefs,
+                                          aipl_argb8888_source_t source,
+                                          void* ctx)
+{
+    if (output == NULL || coefs == NULL || source == NULL)
+    {
+        return AIPL_ERR_NULL_POINTER;
+    }
+
+    aipl_demosaic_layout_t layout;
+
+    /* Formats without a writer of their own go through the generic
+       conversion engine when it is built in */
+    if (!aipl_demosaic_layout(&layout, output, width, height, format))
+    {
+#if AIPL_CONVERT_GENERIC
+        return aipl_color_encode_generic_default(output, width, height,
+                                                 format, coefs, source, ctx);
+#else
+        return AIPL_ERR_UNSUPPORTED_FORMAT;
+#endif
+    }
+
+    aipl_argb8888_px_t px[2][AIPL_DEMOSAIC_CHUNK];
+
+    for (uint32_t y = 0; y < height; y += 2)
+    {
+        uint32_t rows = height - y < 2 ? 1 : 2;
+
+        for (uint32_t x = 0; x < width; x += AIPL_DEMOSAIC_CHUNK)
+        {
+            uint32_t count = width - x < AIPL_DEMOSAIC_CHUNK
+                             ? width - x : AIPL_DEMOSAIC_CHUNK;
+
+            for (uint32_t r = 0; r < rows; ++r)
+            {
+                source(px[r], x, y + r, count, ctx);
+            }
+
+            if (layout.yuv)
             {
-                aipl_cnvt_px_rgb_to_yuv(y_dst + j,
-                                        u_dst + j,
-                                        v_dst + j,
-                                        rgb0[0], rgb0[1], rgb0[2]);
+                aipl_demosaic_encode_yuv(&layout, px, x, y, count, rows,
+                                         coefs);
             }
             else
             {
-                aipl_cnvt_px_rgb_to_yuv_y(y_dst + j,
-                                          rgb0[0], rgb0[1], rgb0[2]);
+                for (uint32_t r = 0; r < rows; ++r)
+                {
+                    aipl_demosaic_encode_rgb(&layout, px[r], x, y + r, count,
+                                             format);
+                }
             }
+        }
+    }
 
-            aipl_cnvt_px_rgb_to_yuv_y(y_dst + j + 1,
-                                      rgb1[0], rgb1[1], rgb1[2]);
+    aipl_cpu_cache_clean(output,
+                         width * height * aipl_color_format_depth(format) / 8);
+
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_raw_unpack_8bit_default(const void* input, void* output,
+                                          uint32_t pitch,
+                                          uint32_t width, uint32_t height,
+                                          aipl_raw_format_t raw)
+{
+    if (input == NULL || output == NULL)
+    {
+        return AIPL_ERR_NULL_POINTER;
+    }
+
+    uint32_t stride = aipl_raw_stride(pitch, raw);
+
+    if (stride == 0)
+    {
+        return AIPL_ERR_UNSUPPORTED_FORMAT;
+    }
+
+    for (uint32_t i = 0; i < height; ++i)
+    {
+        const uint8_t* src = (const uint8_t*)input + i * stride;
+        uint8_t* dst = (uint8_t*)output + i * width;
+        uint32_t j = 0;
+
+        switch (raw)
+        {
+            case AIPL_RAW8:
+                memcpy(dst, src, width);
+                j = width;
+                break;
+
+            case AIPL_RAW10:
+                for (; j + 4 <= width; j += 4, src += 5)
+                {
+                    dst[j] = src[0];
+                    dst[j + 1] = src[1];
+                    dst[j + 2] = src[2];
+                    dst[j + 3] = src[3];
+                }
+
+                for (; j < width; ++j)
+                {
+                    dst[j] = aipl_raw10_px(src, j & 3);
+                }
+                break;
+
+            default:
+                for (; j + 2 <= width; j += 2, src += 3)
+                {
+                    dst[j] = src[0];
+                    dst[j + 1] = src[1];
+                }
+
+                for (; j < width; ++j)
+                {
+                    dst[j] = aipl_raw12_px(src, j & 1);
+                }
+                break;
         }
+    }
 
-        tile.red_src += (i + tile.blue_row) % 2 * pitch * 2;
-        tile.blue_src += (i + tile.red_row) % 2 * pitch * 2;
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_raw_unpack_16bit_default(const void* input, void* output,
+                                           uint32_t pitch,
+                                           uint32_t width, uint32_t height,
+                                           aipl_raw_format_t raw)
+{
+    if (input == NULL || output == NULL)
+    {
+        return AIPL_ERR_NULL_POINTER;
     }
 
-    memcpy(y + (height - 1) * width,
-           y + (height - 2) * width,
-           width);
-    memcpy(y + (2 * height - 1) * width,
-           y + (2 * height - 2) * width,
-           width);
+    uint32_t stride = aipl_raw_stride(pitch, raw);
+
+    if (stride == 0)
+    {
+        return AIPL_ERR_UNSUPPORTED_FORMAT;
+    }
+
+    for (uint32_t i = 0; i < height; ++i)
+    {
+        const uint8_t* src = (const uint8_t*)input + i * stride;
+        uint16_t* dst = (uint16_t*)output + i * width;
+        uint32_t j = 0;
+
+        switch (raw)
+        {
+            case AIPL_RAW8:
+                for (; j < width; ++j)
+                {
+                    dst[j] = src[j];
+                }
+                break;
+
+            case AIPL_RAW10:
+                for (; j + 4 <= width; j += 4, src += 5)
+                {
+                    uint8_t lsb = src[4];
+
+                    dst[j] = (src[0] << 2) | (lsb & 0x3);
+                    dst[j + 1] = (src[1] << 2) | ((lsb >> 2) & 0x3);
+                    dst[j + 2] = (src[2] << 2) | ((lsb >> 4) & 0x3);
+                    dst[j + 3] = (src[3] << 2) | (lsb >> 6);
+                }
+
+                for (; j < width; ++j)
+                {
+                    dst[j] = aipl_raw10_px16(src, j & 3);
+                }
+                break;
+
+            default:
+                for (; j + 2 <= width; j += 2, src += 3)
+                {
+                    uint8_t lsb = src[2];
+
+                    dst[j] = (src[0] << 4) | (lsb & 0xf);
+                    dst[j + 1] = (src[1] << 4) | (lsb >> 4);
+                }
+
+                for (; j < width; ++j)
+                {
+                    dst[j] = aipl_raw12_px16(src, j & 1);
+                }
+                break;
+        }
+    }
 
     return AIPL_ERR_OK;
 }
 
-static aipl_error_t aipl_demosaic_yuv_packed(const void* input,
-                                             uint8_t* y,
-                                             uint8_t* u,
-                                             uint8_t* v,
-                                             uint32_t pitch,
-                                             uint32_t width,
-                                             uint32_t height,
-                                             aipl_bayer_filter_t filter)
+aipl_error_t aipl_raw_white_balance_default(const void* input, void* output,
+                                            uint32_t pitch,
+                                            uint32_t width, uint32_t height,
+                                            const uint16_t* gains,
+                                            bool clip_highlights)
 {
-    if (input == NULL || y == NULL || u == NULL || v == NULL)
+    if (input == NULL || output == NULL || gains == NULL)
     {
         return AIPL_ERR_NULL_POINTER;
     }
 
-    aipl_bayer_tile_t tile = aipl_bayer_tile(input, pitch, filter);
+    const uint32_t half = 1 << (AIPL_RAW_GAIN_BITS - 1);
+    uint8_t white = aipl_raw_white_level(gains, clip_highlights);
 
-    for (uint32_t i = 0; i < height - 1; ++i)
+    for (uint32_t i = 0; i < height; ++i)
     {
-        uint8_t* y_dst = y + i * width * 2;
-        uint8_t* u_dst = u + i * width * 2;
-        uint8_t* v_dst = v + i * width * 2;
+        const uint8_t* src = (const uint8_t*)input + i * pitch;
+        uint8_t* dst = (uint8_t*)output + i * width;
+        const uint16_t* row_gains = gains + (i & 1) * 2;
 
-        for (uint32_t j = 0; j < width; j += 2)
+        for (uint32_t j = 0; j < width; ++j)
         {
-            uint8_t rgb0[3];
-            uint8_t rgb1[3];
+            uint32_t val = (src[j] * row_gains[j & 1] + half)
+                           >> AIPL_RAW_GAIN_BITS;
 
-            aipl_bayer_to_rgb(rgb0, rgb1, &tile, j);
+            dst[j] = val > white ? white : val;
+        }
+    }
+
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_demosaic_raw_default(const void* input, void* output,
+                                       uint32_t pitch,
+                                       uint32_t width, uint32_t height,
+                                       aipl_bayer_filter_t filter,
+                                       aipl_raw_format_t raw,
+                                       aipl_color_format_t format)
+{
+    if (raw == AIPL_RAW8)
+    {
+        return aipl_demosaic_default(input, output, pitch,
+                                     width, height, filter, format);
+    }
+
+    if (input == NULL || output == NULL)
+    {
+        return AIPL_ERR_NULL_POINTER;
+    }
+
+    aipl_argb8888_source_t source;
+
+    switch (raw)
+    {
+        case AIPL_RAW10:
+            source = aipl_demosaic_raw10_source;
+            break;
+
+        case AIPL_RAW12:
+            source = aipl_demosaic_raw12_source;
+            break;
+
+        default:
+            return AIPL_ERR_UNSUPPORTED_FORMAT;
+    }
+
+    aipl_demosaic_raw_ctx_t ctx = {
+        .input = input,
+        .stride = aipl_raw_stride(pitch, raw),
+        .height = height,
+        .tile = aipl_bayer_tile(input, 0, filter),
+    };
+
+    const aipl_yuv_coefs_t* coefs =
+        aipl_colorimetry_coefs(AIPL_COLORIMETRY_BT601_LIMITED);
+
+    return aipl_demosaic_encode_default(output, width, height, format,
+                                        coefs, source, &ctx);
+}
+
+aipl_error_t aipl_demosaic_16bit_default(const void* input, void* output,
+                                         uint32_t pitch,
+                                         uint32_t width, uint32_t height,
+                                         aipl_bayer_filter_t filter,
+                                         uint8_t bits,
+                                         aipl_color_format_t format)
+{
+    if (bits < 8 || bits > 16)
+    {
+        return AIPL_ERR_NOT_SUPPORTED;
+    }
+
+    if (input == NULL || output == NULL)
+    {
+        return AIPL_ERR_NULL_POINTER;
+    }
+
+    aipl_demosaic_raw_ctx_t ctx = {
+        .input = input,
+        .stride = pitch * 2,
+        .height = height,
+        .tile = aipl_bayer_tile(input, 0, filter),
+        .shift = bits - 8,
+    };
+
+    const aipl_yuv_coefs_t* coefs =
+        aipl_colorimetry_coefs(AIPL_COLORIMETRY_BT601_LIMITED);
+
+    return aipl_demosaic_encode_default(output, width, height, format, coefs,
+                                        aipl_demosaic_16bit_source, &ctx);
+}
+
+aipl_error_t aipl_demosaic_16bit_rgb16_default(const void* input, void* output,
+                                               uint32_t pitch,
+                                               uint32_t width, uint32_t height,
+                                               aipl_bayer_filter_t filter)
+{
+    if (input == NULL || output == NULL)
+    {
+        return AIPL_ERR_NULL_POINTER;
+    }
+
+    /* Tile pointers step over 16-bit samples */
+    aipl_bayer_tile_t tile = aipl_bayer_tile(input, pitch * 2, filter);
 
-            aipl_cnvt_px_rgb_to_yuv(y_dst + j * 2,
-                                    u_dst + j * 2,
-                                    v_dst + j * 2,
-                                    rgb0[0], rgb0[1], rgb0[2]);
-            aipl_cnvt_px_rgb_to_yuv_y(y_dst + (j + 1) * 2,
-                                      rgb1[0], rgb1[1], rgb1[2]);
+    for (uint32_t i = 0; i < height - 1; ++i)
+    {
+        uint16_t* dst = (uint16_t*)output + i * width * 3;
 
+        for (uint32_t j = 0; j < width; j += 2)
+        {
+            aipl_bayer16_to_rgb(dst + j * 3, dst + j * 3 + 3, &tile, j);
         }
 
-        tile.red_src += (i + tile.blue_row) % 2 * pitch * 2;
-        tile.blue_src += (i + tile.red_row) % 2 * pitch * 2;
+        tile.red_src += (i + tile.blue_row) % 2 * pitch * 4;
+        tile.blue_src += (i + tile.red_row) % 2 * pitch * 4;
     }
 
-    uint8_t* output = y < u ? y : u;
-    memcpy(output + (height - 1) * width * 2,
-           output + (height - 2) * width * 2,
-           width * 2);
+    memcpy((uint16_t*)output + (height - 1) * width * 3,
+           (uint16_t*)output + (height - 2) * width * 3,
+           width * 3 * sizeof(uint16_t));
 
     return AIPL_ERR_OK;
 }
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static INLINE void aipl_bayer_to_rgb(uint8_t* rgb0, uint8_t* rgb1,
+                                     aipl_bayer_tile_t* tile,
+                                     uint32_t idx)
+{
+    uint32_t red_col_idx = idx + tile->red_col;
+    uint32_t blue_col_idx = idx + tile->blue_col;
+
+    rgb0[0] = tile->red_src[red_col_idx];
+    rgb0[1] = (tile->red_src[blue_col_idx]
+               + tile->blue_src[red_col_idx]) >> 1;
+    rgb0[2] = tile->blue_src[blue_col_idx];
+
+    uint32_t red_col_2dx = tile->red_col << 1;
+    uint32_t blue_col_2dx = tile->blue_col << 1;
+
+    rgb1[0] = tile->red_src[red_col_idx + blue_col_2dx];
+    rgb1[1] = (tile->red_src[blue_col_idx + red_col_2dx]
+               + tile->blue_src[red_col_idx + blue_col_2dx]) >> 1;
+    rgb1[2] = tile->blue_src[blue_col_idx + red_col_2dx];
+}
+
+static INLINE void aipl_bayer16_to_rgb(uint16_t* rgb0, uint16_t* rgb1,
+                                       const aipl_bayer_tile_t* tile,
+                                       uint32_t idx)
+{
+    const uint16_t* red_src = (const uint16_t*)tile->red_src;
+    const uint16_t* blue_src = (const uint16_t*)tile->blue_src;
+
+    uint32_t red_col_idx = idx + tile->red_col;
+    uint32_t blue_col_idx = idx + tile->blue_col;
+
+    rgb0[0] = red_src[red_col_idx];
+    rgb0[1] = (red_src[blue_col_idx] + blue_src[red_col_idx]) >> 1;
+    rgb0[2] = blue_src[blue_col_idx];
+
+    uint32_t red_col_2dx = tile->red_col << 1;
+    uint32_t blue_col_2dx = tile->blue_col << 1;
+
+    rgb1[0] = red_src[red_col_idx + blue_col_2dx];
+    rgb1[1] = (red_src[blue_col_idx + red_col_2dx]
+               + blue_src[red_col_idx + blue_col_2dx]) >> 1;
+    rgb1[2] = blue_src[blue_col_idx + red_col_2dx];
+}
+
+static void aipl_demosaic_decode_row(aipl_bayer_tile_t* tile,
+                                     uint32_t width, uint32_t y,
+                                     aipl_argb8888_sink_t sink,
+                                     void* ctx)
+{
+    aipl_argb8888_px_t px[AIPL_DEMOSAIC_CHUNK];
+
+    for (uint32_t x = 0; x < width; x += AIPL_DEMOSAIC_CHUNK)
+    {
+        uint32_t count = width - x < AIPL_DEMOSAIC_CHUNK ? width - x
+                                                         : AIPL_DEMOSAIC_CHUNK;
+
+        for (uint32_t j = 0; j < count; j += 2)
+        {
+            uint8_t rgb0[3];
+            uint8_t rgb1[3];
+
+            aipl_bayer_to_rgb(rgb0, rgb1, tile, x + j);
+
+            px[j].r = rgb0[0];
+            px[j].g = rgb0[1];
+            px[j].b = rgb0[2];
+            px[j].a = 0xff;
+            px[j + 1].r = rgb1[0];
+            px[j + 1].g = rgb1[1];
+            px[j + 1].b = rgb1[2];
+            px[j + 1].a = 0xff;
+        }
+
+        sink(px, x, y, count, ctx);
+    }
+}
+
+static aipl_error_t aipl_demosaic_yuv_luma(const void* input,
+                                           uint8_t* y,
+                                           uint32_t pitch,
+                                           uint32_t width,
+                                           uint32_t height,
+                                           aipl_bayer_filter_t filter,
+                                           const aipl_yuv_coefs_t* coefs)
+{
+    if (input == NULL || y == NULL)
+    {
+        return AIPL_ERR_NULL_POINTER;
+    }
+
+    aipl_bayer_tile_t tile = aipl_bayer_tile(input, pitch, filter);
+    const aipl_yuv_coefs_t yuv = *coefs;
+
+    for (uint32_t i = 0; i < height - 1; ++i)
+    {
+        uint8_t* dst = y + i * width;
+
+        for (uint32_t j = 0; j < width; j += 2)
+        {
+            uint8_t rgb0[3];
+            uint8_t rgb1[3];
+
+            aipl_bayer_to_rgb(rgb0, rgb1, &tile, j);
+
+            aipl_cnvt_px_rgb_to_yuv_y_coefs(dst + j,
+                                            rgb0[0], rgb0[1], rgb0[2], &yuv);
+            aipl_cnvt_px_rgb_to_yuv_y_coefs(dst + j + 1,
+                                            rgb1[0], rgb1[1], rgb1[2], &yuv);
+        }
+
+        tile.red_src += (i + tile.blue_row) % 2 * pitch * 2;
+        tile.blue_src += (i + tile.red_row) % 2 * pitch * 2;
+    }
+
+    memcpy(y + (height - 1) * width,
+           y + (height - 2) * width,
+           width);
+
+    return AIPL_ERR_OK;
+}
+
+static aipl_error_t aipl_demosaic_yuv_planar(const void* input,
+                                             uint8_t* y,
+                                             uint8_t* u,
+                                             uint8_t* v,
+                                             uint32_t pitch,
+                                             uint32_t width,
+                                             uint32_t height,
+                                             aipl_bayer_filter_t filter,
+                                             const aipl_yuv_coefs_t* coefs)
+{
+    if (input == NULL || y == NULL || u == NULL || v == NULL)
+    {
+        return AIPL_ERR_NULL_POINTER;
+    }
+
+    aipl_bayer_tile_t tile = aipl_bayer_tile(input, pitch, filter);
+    const aipl_yuv_coefs_t yuv = *coefs;
+
+    for (uint32_t i = 0; i < height - 1; ++i)
+    {
+        uint8_t* y_dst = y + i * width;
+        uint8_t* u_dst = u + i / 2 * width / 2;
+        uint8_t* v_dst = v + i / 2 * width / 2;
+
+        for (uint32_t j = 0; j < width; j += 2)
+        {
+            uint8_t rgb0[3];
+            uint8_t rgb1[3];
+
+            aipl_bayer_to_rgb(rgb0, rgb1, &tile, j);
+
+            if (i % 2 == 0)
+            {
+                aipl_cnvt_px_rgb_to_yuv_coefs(y_dst + j,
+                                              u_dst + j / 2,
+                                              v_dst + j / 2,
+                                              rgb0[0], rgb0[1], rgb0[2],
+                                              &yuv);
+            }
+            else
+            {
+                aipl_cnvt_px_rgb_to_yuv_y_coefs(y_dst + j,
+                                                rgb0[0], rgb0[1], rgb0[2],
+                                                &yuv);
+            }
+
+            aipl_cnvt_px_rgb_to_yuv_y_coefs(y_dst + j + 1,
+                                            rgb1[0], rgb1[1], rgb1[2],
+                                            &yuv);
+        }
+
+        tile.red_src += (i + tile.blue_row) % 2 * pitch * 2;
+        tile.blue_src += (i + tile.red_row) % 2 * pitch * 2;
+    }
+
+    memcpy(y + (height - 1) * width,
+           y + (height - 2) * width,
+           width);
+
+    return AIPL_ERR_OK;
+}
+
+static aipl_error_t aipl_demosaic_yuv_semi_planar(const void* input,
+                                                  uint8_t* y,
+                                                  uint8_t* u,
+                                                  uint8_t* v,
+                                                  uint32_t pitch,
+                                                  uint32_t width,
+                                                  uint32_t height,
+                                                  aipl_bayer_filter_t filter,
+                                                  const aipl_yuv_coefs_t* coefs)
+{
+    if (input == NULL || y == NULL || u == NULL || v == NULL)
+    {
+        return AIPL_ERR_NULL_POINTER;
+    }
+
+    aipl_bayer_tile_t tile = aipl_bayer_tile(input, pitch, filter);
+    const aipl_yuv_coefs_t yuv = *coefs;
+
+    for (uint32_t i = 0; i < height - 1; ++i)
+    {
+        uint8_t* y_dst = y + i * width;
+        uint8_t* u_dst = u + i / 2 * width;
+        uint8_t* v_dst = v + i / 2 * width;
+
+        for (uint32_t j = 0; j < width; j += 2)
+        {
+            uint8_t rgb0[3];
+            uint8_t rgb1[3];
+
+            aipl_bayer_to_rgb(rgb0, rgb1, &tile, j);
+
+            if (i % 2 == 0)
+            {
+                aipl_cnvt_px_rgb_to_yuv_coefs(y_dst + j,
+                                              u_dst + j,
+                                              v_dst + j,
+                                              rgb0[0], rgb0[1], rgb0[2],
+                                              &yuv);
+            }
+            else
+            {
+                aipl_cnvt_px_rgb_to_yuv_y_coefs(y_dst + j,
+                                                rgb0[0], rgb0[1], rgb0[2],
+                                                &yuv);
+            }
+
+            aipl_cnvt_px_rgb_to_yuv_y_coefs(y_dst + j + 1,
+                                            rgb1[0], rgb1[1], rgb1[2],
+                                            &yuv);
+        }
+
+        tile.red_src += (i + tile.blue_row) % 2 * pitch * 2;
+        tile.blue_src += (i + tile.red_row) % 2 * pitch * 2;
+    }
+
+    memcpy(y + (height - 1) * width,
+           y + (height - 2) * width,
+           width);
+    memcpy(y + (2 * height - 1) * width,
+           y + (2 * height - 2) * width,
+           width);
+
+    return AIPL_ERR_OK;
+}
+
+static aipl_error_t aipl_demosaic_yuv_packed(const void* input,
+                                             uint8_t* y,
+                                             uint8_t* u,
+                                             uint8_t* v,
+                                             uint32_t pitch,
+                                             uint32_t width,
+                                             uint32_t height,
+                                             aipl_bayer_filter_t filter,
+                                             const aipl_yuv_coefs_t* coefs)
+{
+    if (input == NULL || y == NULL || u == NULL || v == NULL)
+    {
+        return AIPL_ERR_NULL_POINTER;
+    }
+
+    aipl_bayer_tile_t tile = aipl_bayer_tile(input, pitch, filter);
+    const aipl_yuv_coefs_t yuv = *coefs;
+
+    for (uint32_t i = 0; i < height - 1; ++i)
+    {
+        uint8_t* y_dst = y + i * width * 2;
+        uint8_t* u_dst = u + i * width * 2;
+        uint8_t* v_dst = v + i * width * 2;
+
+        for (uint32_t j = 0; j < width; j += 2)
+        {
+            uint8_t rgb0[3];
+            uint8_t rgb1[3];
+
+            aipl_bayer_to_rgb(rgb0, rgb1, &tile, j);
+
+            aipl_cnvt_px_rgb_to_yuv_coefs(y_dst + j * 2,
+                                          u_dst + j * 2,
+                                          v_dst + j * 2,
+                                          rgb0[0], rgb0[1], rgb0[2],
+                                          &yuv);
+            aipl_cnvt_px_rgb_to_yuv_y_coefs(y_dst + (j + 1) * 2,
+                                            rgb1[0], rgb1[1], rgb1[2],
+                                            &yuv);
+
+        }
+
+        tile.red_src += (i + tile.blue_row) % 2 * pitch * 2;
+        tile.blue_src += (i + tile.red_row) % 2 * pitch * 2;
+    }
+
+    uint8_t* output = y < u ? y : u;
+    memcpy(output + (height - 1) * width * 2,
+           output + (height - 2) * width * 2,
+           width * 2);
+
+    return AIPL_ERR_OK;
+}
+
+static aipl_error_t aipl_demosaic_yuv_422(const void* input,
+                                          uint8_t* y,
+                                          uint8_t* u,
+                                          uint8_t* v,
+                                          uint32_t pitch,
+                                          uint32_t width,
+                                          uint32_t height,
+                                          aipl_bayer_filter_t filter,
+                                          const aipl_yuv_coefs_t* coefs)
+{
+    if (input == NULL || y == NULL || u == NULL || v == NULL)
+    {
+        return AIPL_ERR_NULL_POINTER;
+    }
+
+    aipl_bayer_tile_t tile = aipl_bayer_tile(input, pitch, filter);
+    const aipl_yuv_coefs_t yuv = *coefs;
+
+    for (uint32_t i = 0; i < height - 1; ++i)
+    {
+        uint8_t* y_dst = y + i * width;
+        uint8_t* u_dst = u + i * width / 2;
+        uint8_t* v_dst = v + i * width / 2;
+
+        for (uint32_t j = 0; j < width; j += 2)
+        {
+            uint8_t rgb0[3];
+            uint8_t rgb1[3];
+
+            aipl_bayer_to_rgb(rgb0, rgb1, &tile, j);
+
+            aipl_cnvt_px_rgb_to_yuv_coefs(y_dst + j,
+                                          u_dst + j / 2,
+                                          v_dst + j / 2,
+                                          rgb0[0], rgb0[1], rgb0[2],
+                                          &yuv);
+            aipl_cnvt_px_rgb_to_yuv_y_coefs(y_dst + j + 1,
+                                            rgb1[0], rgb1[1], rgb1[2],
+                                            &yuv);
+        }
+
+        tile.red_src += (i + tile.blue_row) % 2 * pitch * 2;
+        tile.blue_src += (i + tile.red_row) % 2 * pitch * 2;
+    }
+
+    memcpy(y + (height - 1) * width,
+           y + (height - 2) * width,
+           width);
+    memcpy(u + (height - 1) * width / 2,
+           u + (height - 2) * width / 2,
+           width / 2);
+    memcpy(v + (height - 1) * width / 2,
+           v + (height - 2) * width / 2,
+           width / 2);
+
+    return AIPL_ERR_OK;
+}
+
+static aipl_error_t aipl_demosaic_yuv_444(const void* input,
+                                          uint8_t* y,
+                                          uint8_t* u,
+                                          uint8_t* v,
+                                          uint32_t pitch,
+                                          uint32_t width,
+                                          uint32_t height,
+                                          aipl_bayer_filter_t filter,
+                                          const aipl_yuv_coefs_t* coefs)
+{
+    if (input == NULL || y == NULL || u == NULL || v == NULL)
+    {
+        return AIPL_ERR_NULL_POINTER;
+    }
+
+    aipl_bayer_tile_t tile = aipl_bayer_tile(input, pitch, filter);
+    const aipl_yuv_coefs_t yuv = *coefs;
+
+    for (uint32_t i = 0; i < height - 1; ++i)
+    {
+        uint8_t* y_dst = y + i * width;
+        uint8_t* u_dst = u + i * width;
+        uint8_t* v_dst = v + i * width;
+
+        for (uint32_t j = 0; j < width; j += 2)
+        {
+            uint8_t rgb0[3];
+            uint8_t rgb1[3];
+
+            aipl_bayer_to_rgb(rgb0, rgb1, &tile, j);
+
+            aipl_cnvt_px_rgb_to_yuv_coefs(y_dst + j,
+                                          u_dst + j,
+                                          v_dst + j,
+                                          rgb0[0], rgb0[1], rgb0[2],
+                                          &yuv);
+            aipl_cnvt_px_rgb_to_yuv_coefs(y_dst + j + 1,
+                                          u_dst + j + 1,
+                                          v_dst + j + 1,
+                                          rgb1[0], rgb1[1], rgb1[2],
+                                          &yuv);
+        }
+
+        tile.red_src += (i + tile.blue_row) % 2 * pitch * 2;
+        tile.blue_src += (i + tile.red_row) % 2 * pitch * 2;
+    }
+
+    memcpy(y + (height - 1) * width,
+           y + (height - 2) * width,
+           width);
+    memcpy(u + (height - 1) * width,
+           u + (height - 2) * width,
+           width);
+    memcpy(v + (height - 1) * width,
+           v + (height - 2) * width,
+           width);
+
+    return AIPL_ERR_OK;
+}
+
+static INLINE void aipl_demosaic_bin2x2_row(aipl_argb8888_px_t* px,
+                                            uint32_t x, uint32_t y,
+                                            uint32_t count,
+                                            const aipl_demosaic_raw_ctx_t* raw)
+{
+    const aipl_bayer_tile_t* tile = &raw->tile;
+    const uint8_t* quad = raw->input + 2 * y * raw->stride;
+    const uint8_t* red_src = quad + tile->red_row * raw->stride;
+    const uint8_t* blue_src = quad + tile->blue_row * raw->stride;
+
+    for (uint32_t j = 0; j < count; ++j)
+    {
+        uint32_t c = (x + j) * 2;
+
+        px[j].r = red_src[c + tile->red_col];
+        px[j].g = (red_src[c + tile->blue_col]
+                   + blue_src[c + tile->red_col]) >> 1;
+        px[j].b = blue_src[c + tile->blue_col];
+        px[j].a = 0xff;
+    }
+}
+
+static uint8_t aipl_raw_white_level(const uint16_t* gains,
+                                    bool clip_highlights)
+{
+    if (gains == NULL || !clip_highlights)
+    {
+        return 255;
+    }
+
+    /* Level reached by a saturated sample of the weakest channel */
+    uint32_t min = gains[0];
+
+    for (uint32_t c = 1; c < 4; ++c)
+    {
+        min = gains[c] < min ? gains[c] : min;
+    }
+
+    uint32_t level = (255 * min + (1 << (AIPL_RAW_GAIN_BITS - 1)))
+                     >> AIPL_RAW_GAIN_BITS;
+
+    return level > 255 ? 255 : level;
+}
+
+static INLINE uint8_t aipl_raw10_px(const uint8_t* row, uint32_t x)
+{
+    /* The first 4 bytes of a group hold the 8 most significant bits */
+    return row[(x >> 2) * 5 + (x & 3)];
+}
+
+static INLINE uint8_t aipl_raw12_px(const uint8_t* row, uint32_t x)
+{
+    /* The first 2 bytes of a group hold the 8 most significant bits */
+    return row[(x >> 1) * 3 + (x & 1)];
+}
+
+static INLINE uint16_t aipl_raw10_px16(const uint8_t* row, uint32_t x)
+{
+    const uint8_t* group = row + (x >> 2) * 5;
+    uint32_t k = x & 3;
+
+    return (group[k] << 2) | ((group[4] >> (k * 2)) & 0x3);
+}
+
+static INLINE uint16_t aipl_raw12_px16(const uint8_t* row, uint32_t x)
+{
+    const uint8_t* group = row + (x >> 1) * 3;
+    uint32_t k = x & 1;
+
+    return (group[k] << 4) | ((group[2] >> (k * 4)) & 0xf);
+}
+
+static INLINE void aipl_demosaic_raw_row(aipl_argb8888_px_t* px,
+                                         uint32_t x, uint32_t y,
+                                         uint32_t count,
+                                         const aipl_demosaic_raw_ctx_t* raw,
+                                         aipl_raw_format_t format)
+{
+    /* The last row repeats the one above it */
+    uint32_t i = y < raw->height - 1 ? y : raw->height - 2;
+
+    const aipl_bayer_tile_t* tile = &raw->tile;
+    const uint8_t* red_src = raw->input
+                             + (i + ((i + tile->red_row) & 1)) * raw->stride;
+    const uint8_t* blue_src = raw->input
+                              + (i + ((i + tile->blue_row) & 1)) * raw->stride;
+
+    uint32_t red_col_2dx = tile->red_col << 1;
+    uint32_t blue_col_2dx = tile->blue_col << 1;
+
+#define AIPL_RAW_PX(row, idx) (format == AIPL_RAW10 ? aipl_raw10_px(row, idx) \
+                                                    : aipl_raw12_px(row, idx))
+
+    for (uint32_t j = 0; j < count; j += 2)
+    {
+        uint32_t red_col_idx = x + j + tile->red_col;
+        uint32_t blue_col_idx = x + j + tile->blue_col;
+
+        px[j].r = AIPL_RAW_PX(red_src, red_col_idx);
+        px[j].g = (AIPL_RAW_PX(red_src, blue_col_idx)
+                   + AIPL_RAW_PX(blue_src, red_col_idx)) >> 1;
+        px[j].b = AIPL_RAW_PX(blue_src, blue_col_idx);
+        px[j].a = 0xff;
+
+        px[j + 1].r = AIPL_RAW_PX(red_src, red_col_idx + blue_col_2dx);
+        px[j + 1].g = (AIPL_RAW_PX(red_src, blue_col_idx + red_col_2dx)
+                       + AIPL_RAW_PX(blue_src, red_col_idx + blue_col_2dx)) >> 1;
+        px[j + 1].b = AIPL_RAW_PX(blue_src, blue_col_idx + red_col_2dx);
+        px[j + 1].a = 0xff;
+    }
+
+#undef AIPL_RAW_PX
+}
+
+static void aipl_demosaic_raw10_source(aipl_argb8888_px_t* px,
+                                       uint32_t x, uint32_t y,
+                                       uint32_t count,
+                                       void* ctx)
+{
+    aipl_demosaic_raw_row(px, x, y, count, ctx, AIPL_RAW10);
+}
+
+static void aipl_demosaic_raw12_source(aipl_argb8888_px_t* px,
+                                       uint32_t x, uint32_t y,
+                                       uint32_t count,
+                                       void* ctx)
+{
+    aipl_demosaic_raw_row(px, x, y, count, ctx, AIPL_RAW12);
+}
+
+static void aipl_demosaic_16bit_source(aipl_argb8888_px_t* px,
+                                       uint32_t x, uint32_t y,
+                                       uint32_t count,
+                                       void* ctx)
+{
+    const aipl_demosaic_raw_ctx_t* raw = ctx;
+
+    /* The last row repeats the one above it */
+    uint32_t i = y < raw->height - 1 ? y : raw->height - 2;
+
+    aipl_bayer_tile_t tile = raw->tile;
+    tile.red_src = raw->input + (i + ((i + tile.red_row) & 1)) * raw->stride;
+    tile.blue_src = raw->input + (i + ((i + tile.blue_row) & 1)) * raw->stride;
+
+    uint32_t round = (1 << raw->shift) >> 1;
+
+    for (uint32_t j = 0; j < count; j += 2)
+    {
+        uint16_t rgb[6];
+
+        aipl_bayer16_to_rgb(rgb, rgb + 3, &tile, x + j);
+
+        for (uint32_t c = 0; c < 6; ++c)
+        {
+            uint32_t val = (rgb[c] + round) >> raw->shift;
+            rgb[c] = val > 255 ? 255 : val;
+        }
+
+        px[j].r = rgb[0];
+        px[j].g = rgb[1];
+        px[j].b = rgb[2];
+        px[j].a = 0xff;
+        px[j + 1].r = rgb[3];
+        px[j + 1].g = rgb[4];
+        px[j + 1].b = rgb[5];
+        px[j + 1].a = 0xff;
+    }
+}
+
+static aipl_error_t aipl_demosaic_lines(const void* input, void* output,
+                                        uint32_t pitch,
+                                        uint32_t width, uint32_t height,
+                                        aipl_bayer_filter_t filter,
+                                        aipl_demosaic_mode_t mode,
+                                        bool dpc, uint8_t threshold,
+                                        aipl_color_format_t format)
+{
+    if (input == NULL || output == NULL)
+    {
+        return AIPL_ERR_NULL_POINTER;
+    }
+
+    if (mode >= AIPL_DEMOSAIC_MODE_NUM || width < 3 || height < 3)
+    {
+        return AIPL_ERR_NOT_SUPPORTED;
+    }
+
+    aipl_bayer_tile_t tile = aipl_bayer_tile(input, 0, filter);
+
+    aipl_demosaic_lines_ctx_t ctx = {
+        .input = input,
+        .pitch = pitch,
+        .width = width,
+        .height = height,
+        .red_row = tile.red_row,
+        .red_col = tile.red_col,
+        .mode = mode,
+        .dpc = dpc,
+        .threshold = threshold,
+        .next = 0,
+        .ready = 0,
+    };
+
+    ctx.lines = aipl_video_alloc(AIPL_DEMOSAIC_LINES
+                                 * (width + 2 * AIPL_DEMOSAIC_BORDER));
+
+    if (ctx.lines == NULL)
+    {
+        return AIPL_ERR_NO_MEM;
+    }
+
+    const aipl_yuv_coefs_t* coefs =
+        aipl_colorimetry_coefs(AIPL_COLORIMETRY_BT601_LIMITED);
+
+    aipl_error_t ret = aipl_demosaic_encode_default(output, width, height,
+                                                    format, coefs,
+                                                    aipl_demosaic_lines_source,
+                                                    &ctx);
+
+    aipl_video_free(ctx.lines);
+
+    return ret;
+}
+
+static INLINE uint8_t* aipl_demosaic_line(const aipl_demosaic_lines_ctx_t* ctx,
+                                          uint32_t row)
+{
+    return ctx->lines + AIPL_DEMOSAIC_BORDER
+           + row % AIPL_DEMOSAIC_LINES
+             * (ctx->width + 2 * AIPL_DEMOSAIC_BORDER);
+}
+
+static INLINE void aipl_demosaic_line_border(uint8_t* line, uint32_t width)
+{
+    /* Mirror the columns around the image edges to keep the phase */
+    line[-2] = line[2];
+    line[-1] = line[1];
+    line[width] = line[width - 2];
+    line[width + 1] = line[width - 3];
+}
+
+static void aipl_demosaic_load_line(aipl_demosaic_lines_ctx_t* ctx,
+                                    uint32_t row)
+{
+    uint8_t* line = aipl_demosaic_line(ctx, row);
+
+    memcpy(line, ctx->input + row * ctx->pitch, ctx->width);
+
+    aipl_demosaic_line_border(line, ctx->width);
+}
+
+static void aipl_demosaic_correct_line(aipl_demosaic_lines_ctx_t* ctx,
+                                       uint32_t row)
+{
+    int32_t width = ctx->width;
+    int32_t height = ctx->height;
+    int32_t threshold = ctx->threshold;
+
+    /* Same channel neighbours, taken from the other side at the edges */
+    int32_t r = row;
+    uint8_t* cur = aipl_demosaic_line(ctx, r);
+    const uint8_t* up = aipl_demosaic_line(ctx, r >= 2 ? r - 2 : r + 2);
+    const uint8_t* down = aipl_demosaic_line(ctx, r + 2 < height ? r + 2
+                                                                 : r - 2);
+
+    for (int32_t c = 0; c < width; ++c)
+    {
+        int32_t left = c >= 2 ? c - 2 : c + 2;
+        int32_t right = c + 2 < width ? c + 2 : c - 2;
+
+        uint8_t nb[8] = {
+            up[left], up[c], up[right],
+            cur[left], cur[right],
+            down[left], down[c], down[right],
+        };
+
+        uint8_t min = nb[0];
+        uint8_t max = nb[0];
+
+        for (uint32_t k = 1; k < 8; ++k)
+        {
+            min = nb[k] < min ? nb[k] : min;
+            max = nb[k] > max ? nb[k] : max;
+        }
+
+        if (cur[c] > max + threshold)
+        {
+            cur[c] = max;
+        }
+        else if (cur[c] < min - threshold)
+        {
+            cur[c] = min;
+        }
+    }
+
+    aipl_demosaic_line_border(cur, width);
+}
+
+static INLINE uint8_t aipl_demosaic_clamp(int32_t val)
+{
+    return val < 0 ? 0 : val > 255 ? 255 : val;
+}
+
+static INLINE void aipl_demosaic_quad_px(aipl_argb8888_px_t* px,
+                                         const uint8_t* const* l,
+                                         int32_t c,
+                                         bool red_row, bool red_col)
+{
+    /* The 2x2 window at the pixel, as in aipl_demosaic() */
+    const uint8_t* red_src = red_row ? l[2] : l[3];
+    const uint8_t* blue_src = red_row ? l[3] : l[2];
+    int32_t red_x = c + !red_col;
+    int32_t blue_x = c + red_col;
+
+    px->r = red_src[red_x];
+    px->g = (red_src[blue_x] + blue_src[red_x]) >> 1;
+    px->b = blue_src[blue_x];
+    px->a = 0xff;
+}
+
+static INLINE void aipl_demosaic_bilinear_px(aipl_argb8888_px_t* px,
+                                             const uint8_t* const* l,
+                                             int32_t c,
+                                             bool red_row, bool red_col)
+{
+    uint8_t own = l[2][c];
+
+    if (red_row == red_col)
+    {
+        /* Red or blue sample */
+        uint8_t g = (l[1][c] + l[3][c] + l[2][c - 1] + l[2][c + 1] + 2) >> 2;
+        uint8_t other = (l[1][c - 1] + l[1][c + 1]
+                         + l[3][c - 1] + l[3][c + 1] + 2) >> 2;
+
+        px->r = red_row ? own : other;
+        px->g = g;
+        px->b = red_row ? other : own;
+    }
+    else
+    {
+        /* Green sample */
+        uint8_t hor = (l[2][c - 1] + l[2][c + 1] + 1) >> 1;
+        uint8_t ver = (l[1][c] + l[3][c] + 1) >> 1;
+
+        px->r = red_row ? hor : ver;
+        px->g = own;
+        px->b = red_row ? ver : hor;
+    }
+
+    px->a = 0xff;
+}
+
+static INLINE void aipl_demosaic_mhc_px(aipl_argb8888_px_t* px,
+                                        const uint8_t* const* l,
+                                        int32_t c,
+                                        bool red_row, bool red_col)
+{
+    /* Filter taps scaled by 16 */
+    int32_t own = l[2][c];
+    int32_t hor1 = l[2][c - 1] + l[2][c + 1];
+    int32_t hor2 = l[2][c - 2] + l[2][c + 2];
+    int32_t ver1 = l[1][c] + l[3][c];
+    int32_t ver2 = l[0][c] + l[4][c];
+    int32_t diag = l[1][c - 1] + l[1][c + 1] + l[3][c - 1] + l[3][c + 1];
+
+    if (red_row == red_col)
+    {
+        /* Red or blue sample */
+        uint8_t g = aipl_demosaic_clamp((8 * own + 4 * (hor1 + ver1)
+                                         - 2 * (hor2 + ver2) + 8) >> 4);
+        uint8_t other = aipl_demosaic_clamp((12 * own + 4 * diag
+                                             - 3 * (hor2 + ver2) + 8) >> 4);
+
+        px->r = red_row ? own : other;
+        px->g = g;
+        px->b = red_row ? other : own;
+    }
+    else
+    {
+        /* Green sample */
+        uint8_t hor = aipl_demosaic_clamp((10 * own + 8 * hor1 - 2 * hor2
+                                           - 2 * diag + ver2 + 8) >> 4);
+        uint8_t ver = aipl_demosaic_clamp((10 * own + 8 * ver1 - 2 * ver2
+                                           - 2 * diag + hor2 + 8) >> 4);
+
+        px->r = red_row ? hor : ver;
+        px->g = own;
+        px->b = red_row ? ver : hor;
+    }
+
+    px->a = 0xff;
+}
+
+static void aipl_demosaic_lines_source(aipl_argb8888_px_t* px,
+                                       uint32_t x, uint32_t y,
+                                       uint32_t count,
+                                       void* ctx)
+{
+    aipl_demosaic_lines_ctx_t* lines = ctx;
+    int32_t height = lines->height;
+
+    /* Each raw row is loaded once as the output rows advance */
+    uint32_t last = y + 2 < lines->height ? y + 2 : lines->height - 1;
+
+    while (lines->ready <= last)
+    {
+        uint32_t need = lines->ready;
+
+        if (lines->dpc)
+        {
+            need = need + 2 < lines->height ? need + 2 : lines->height - 1;
+        }
+
+        while (lines->next <= need)
+        {
+            aipl_demosaic_load_line(lines, lines->next++);
+        }
+
+        if (lines->dpc)
+        {
+            aipl_demosaic_correct_line(lines, lines->ready);
+        }
+
+        lines->ready++;
+    }
+
+    /* Mirror the rows around the image edges to keep the phase */
+    const uint8_t* l[5];
+    for (int32_t k = 0; k < 5; ++k)
+    {
+        int32_t row = (int32_t)y + k - 2;
+        row = row < 0 ? -row : row >= height ? 2 * height - 2 - row : row;
+
+        l[k] = aipl_demosaic_line(lines, row);
+    }
+
+    bool red_row = (y & 1) == lines->red_row;
+
+    for (uint32_t j = 0; j < count; ++j)
+    {
+        int32_t c = x + j;
+        bool red_col = (c & 1) == lines->red_col;
+
+        switch (lines->mode)
+        {
+            case AIPL_DEMOSAIC_MHC:
+                aipl_demosaic_mhc_px(&px[j], l, c, red_row, red_col);
+                break;
+
+            case AIPL_DEMOSAIC_BILINEAR:
+                aipl_demosaic_bilinear_px(&px[j], l, c, red_row, red_col);
+                break;
+
+            default:
+                aipl_demosaic_quad_px(&px[j], l, c, red_row, red_col);
+                break;
+        }
+    }
+}
+
+static void aipl_demosaic_bin2x2_source(aipl_argb8888_px_t* px,
+                                        uint32_t x, uint32_t y,
+                                        uint32_t count,
+                                        void* ctx)
+{
+    aipl_demosaic_bin2x2_row(px, x, y, count, ctx);
+}
+
+static INLINE void aipl_demosaic_quad_add(uint32_t* rgb,
+                                          const aipl_demosaic_resize_ctx_t* rs,
+                                          uint32_t qx, uint32_t qy,
+                                          uint32_t weight)
+{
+    const aipl_bayer_tile_t* tile = &rs->tile;
+    const uint8_t* quad = rs->input + 2 * qy * rs->pitch + 2 * qx;
+    const uint8_t* red_src = quad + tile->red_row * rs->pitch;
+    const uint8_t* blue_src = quad + tile->blue_row * rs->pitch;
+
+    /* Green is kept as the sum of both samples */
+    rgb[0] += red_src[tile->red_col] * weight;
+    rgb[1] += (red_src[tile->blue_col] + blue_src[tile->red_col]) * weight;
+    rgb[2] += blue_src[tile->blue_col] * weight;
+}
+
+static INLINE void aipl_demosaic_scale_pos(uint32_t idx, uint32_t step,
+                                           uint32_t size,
+                                           uint32_t* idx0, uint32_t* idx1,
+                                           uint32_t* frac)
+{
+    /* Output pixel center in 16.16 quad coordinates */
+    int32_t pos = idx * step + step / 2 - 0x8000;
+
+    if (pos < 0)
+    {
+        pos = 0;
+    }
+
+    *idx0 = pos >> 16;
+    *frac = (pos >> 8) & 0xff;
+
+    if (*idx0 >= size - 1)
+    {
+        *idx0 = size - 1;
+        *frac = 0;
+    }
+
+    *idx1 = *idx0 + (*frac != 0);
+}
+
+static void aipl_demosaic_resize_source(aipl_argb8888_px_t* px,
+                                        uint32_t x, uint32_t y,
+                                        uint32_t count,
+                                        void* ctx)
+{
+    const aipl_demosaic_resize_ctx_t* rs = ctx;
+
+    if (rs->scale == AIPL_DEMOSAIC_SCALE_AREA)
+    {
+        uint32_t qy0 = y * rs->quad_height / rs->output_height;
+        uint32_t qy1 = (y + 1) * rs->quad_height / rs->output_height;
+        qy1 = qy1 > qy0 ? qy1 : qy0 + 1;
+
+        for (uint32_t j = 0; j < count; ++j)
+        {
+            uint32_t qx0 = (x + j) * rs->quad_width / rs->output_width;
+            uint32_t qx1 = (x + j + 1) * rs->quad_width / rs->output_width;
+            qx1 = qx1 > qx0 ? qx1 : qx0 + 1;
+
+            uint32_t rgb[3] = { 0 };
+
+            for (uint32_t qy = qy0; qy < qy1; ++qy)
+            {
+                for (uint32_t qx = qx0; qx < qx1; ++qx)
+                {
+                    aipl_demosaic_quad_add(rgb, rs, qx, qy, 1);
+                }
+            }
+
+            uint32_t n = (qx1 - qx0) * (qy1 - qy0);
+
+            px[j].r = (rgb[0] + n / 2) / n;
+            px[j].g = (rgb[1] + n) / (2 * n);
+            px[j].b = (rgb[2] + n / 2) / n;
+            px[j].a = 0xff;
+        }
+    }
+    else
+    {
+        uint32_t qy0, qy1, y_frac;
+        aipl_demosaic_scale_pos(y, rs->y_step, rs->quad_height,
+                                &qy0, &qy1, &y_frac);
+
+        for (uint32_t j = 0; j < count; ++j)
+        {
+            uint32_t qx0, qx1, x_frac;
+            aipl_demosaic_scale_pos(x + j, rs->x_step, rs->quad_width,
+                                    &qx0, &qx1, &x_frac);
+
+            /* Weights in 0.16 fixed point */
+            uint32_t rgb[3] = { 0 };
+            aipl_demosaic_quad_add(rgb, rs, qx0, qy0,
+                                   (256 - x_frac) * (256 - y_frac));
+            aipl_demosaic_quad_add(rgb, rs, qx1, qy0,
+                                   x_frac * (256 - y_frac));
+            aipl_demosaic_quad_add(rgb, rs, qx0, qy1,
+                                   (256 - x_frac) * y_frac);
+            aipl_demosaic_quad_add(rgb, rs, qx1, qy1,
+                                   x_frac * y_frac);
+
+            px[j].r = (rgb[0] + (1 << 15)) >> 16;
+            px[j].g = (rgb[1] + (1 << 16)) >> 17;
+            px[j].b = (rgb[2] + (1 << 15)) >> 16;
+            px[j].a = 0xff;
+        }
+    }
+}
+
+static void aipl_demosaic_roi_source(aipl_argb8888_px_t* px,
+                                     uint32_t x, uint32_t y,
+                                     uint32_t count,
+                                     void* ctx)
+{
+    const aipl_demosaic_roi_ctx_t* roi = ctx;
+
+    /*
+     * Every pixel is made of the 2x2 window at its position.
+     * The last frame row repeats the one above it
+     */
+    int32_t i = (int32_t)y + 1 < roi->rows ? (int32_t)y : roi->rows - 2;
+
+    const uint8_t* rows[2] = {
+        roi->input + i * (int32_t)roi->pitch,
+        roi->input + (i + 1) * (int32_t)roi->pitch,
+    };
+
+    uint32_t red_y = (i + roi->red_row) & 1;
+
+    for (uint32_t j = 0; j < count; ++j)
+    {
+        /* The last frame column repeats the one before it */
+        int32_t c = (int32_t)(x + j) + 1 < roi->cols ? (int32_t)(x + j)
+                                                     : roi->cols - 2;
+
+        uint32_t red_x = (c + roi->red_col) & 1;
+
+        const uint8_t* red_src = rows[red_y] + c;
+        const uint8_t* blue_src = rows[red_y ^ 1] + c;
+
+        px[j].r = red_src[red_x];
+        px[j].g = (red_src[red_x ^ 1] + blue_src[red_x]) >> 1;
+        px[j].b = blue_src[red_x ^ 1];
+        px[j].a = 0xff;
+    }
+}
+
+static void aipl_demosaic_stats_source(aipl_argb8888_px_t* px,
+                                       uint32_t x, uint32_t y,
+                                       uint32_t count,
+                                       void* ctx)
+{
+    aipl_demosaic_stats_ctx_t* st = ctx;
+    aipl_demosaic_stats_t* stats = st->stats;
+
+    aipl_demosaic_roi_source(px, x, y, count, &st->roi);
+
+    uint32_t grid_width = stats->grid_width;
+    aipl_stats_cell_t* cells = stats->cells
+                               + y * stats->grid_height / st->height
+                                 * grid_width;
+
+    /* Cell of the first pixel and the first pixel of the next cell */
+    uint32_t cx = x * grid_width / st->width;
+    uint32_t edge = ((cx + 1) * st->width + grid_width - 1) / grid_width;
+
+    uint8_t prev = st->prev[y & 1];
+
+    for (uint32_t j = 0; j < count; ++j)
+    {
+        if (x + j >= edge)
+        {
+            ++cx;
+            edge = ((cx + 1) * st->width + grid_width - 1) / grid_width;
+        }
+
+        aipl_stats_cell_t* cell = &cells[cx];
+        uint8_t luma = (77 * px[j].r + 150 * px[j].g + 29 * px[j].b + 128) >> 8;
+
+        cell->sum_r += px[j].r;
+        cell->sum_g += px[j].g;
+        cell->sum_b += px[j].b;
+        cell->count++;
+
+        if (x + j > 0)
+        {
+            cell->sharpness += luma > prev ? luma - prev : prev - luma;
+        }
+
+        stats->histogram[luma >> st->bin_shift]++;
+
+        prev = luma;
+    }
+
+    st->prev[y & 1] = prev;
+}
+
+static void aipl_raw_correct_row(uint8_t* dst,
+                                 const aipl_demosaic_corrected_ctx_t* ctx,
+                                 uint32_t row, uint32_t x, uint32_t count)
+{
+    const aipl_raw_correction_t* corr = ctx->corr;
+    const uint8_t* src = ctx->input + row * ctx->pitch;
+    const uint8_t* black = corr->black_level;
+    const uint16_t* channel_gains = corr->channel_gains;
+    uint32_t ch_row = (row & 1) << 1;
+
+    const int32_t one = 1 << AIPL_RAW_GAIN_BITS;
+    const int32_t frac_shift = 16 - AIPL_RAW_GAIN_BITS;
+
+    if (corr->gains == NULL)
+    {
+        for (uint32_t j = 0; j < count; ++j)
+        {
+            uint32_t ch = ch_row | ((x + j) & 1);
+            int32_t val = src[x + j] - black[ch];
+            val = val < 0 ? 0 : val;
+
+            if (channel_gains != NULL)
+            {
+                val = (val * channel_gains[ch] + one / 2)
+                      >> AIPL_RAW_GAIN_BITS;
+            }
+
+            dst[j] = val > ctx->white ? ctx->white : val;
+        }
+
+        return;
+    }
+
+    /* Gain grid rows around the sample row */
+    uint32_t pos_y = row * ctx->y_step;
+    uint32_t gy = pos_y >> 16;
+    gy = gy < corr->grid_height - 1u ? gy : corr->grid_height - 2u;
+    int32_t fy = (pos_y - (gy << 16)) >> frac_shift;
+
+    const uint16_t* top = corr->gains + gy * corr->grid_width * 4;
+    const uint16_t* bottom = top + corr->grid_width * 4;
+
+    for (uint32_t j = 0; j < count; ++j)
+    {
+        uint32_t c = x + j;
+        uint32_t ch = ch_row | (c & 1);
+
+        uint32_t pos_x = c * ctx->x_step;
+        uint32_t gx = pos_x >> 16;
+        gx = gx < corr->grid_width - 1u ? gx : corr->grid_width - 2u;
+        int32_t fx = (pos_x - (gx << 16)) >> frac_shift;
+
+        const uint16_t* t = top + gx * 4 + ch;
+        const uint16_t* b = bottom + gx * 4 + ch;
+
+        int32_t gain_t = (t[0] * (one - fx) + t[4] * fx + one / 2)
+                         >> AIPL_RAW_GAIN_BITS;
+        int32_t gain_b = (b[0] * (one - fx) + b[4] * fx + one / 2)
+                         >> AIPL_RAW_GAIN_BITS;
+        int32_t gain = (gain_t * (one - fy) + gain_b * fy + one / 2)
+                       >> AIPL_RAW_GAIN_BITS;
+
+        if (channel_gains != NULL)
+        {
+            gain = (gain * channel_gains[ch] + one / 2) >> AIPL_RAW_GAIN_BITS;
+        }
+
+        int32_t val = src[c] - black[ch];
+        val = val < 0 ? 0 : (val * gain + one / 2) >> AIPL_RAW_GAIN_BITS;
+
+        dst[j] = val > ctx->white ? ctx->white : val;
+    }
+}
+
+static void aipl_demosaic_corrected_source(aipl_argb8888_px_t* px,
+                                           uint32_t x, uint32_t y,
+                                           uint32_t count,
+                                           void* ctx)
+{
+    const aipl_demosaic_corrected_ctx_t* cc = ctx;
+
+    /* The last row repeats the one above it */
+    uint32_t i = y < cc->height - 1 ? y : cc->height - 2;
+    uint32_t red_y = (i + cc->red_row) & 1;
+
+    /* Corrected samples of both window rows, one column past the run */
+    uint8_t rows[2][AIPL_DEMOSAIC_CHUNK + 1];
+
+    for (uint32_t k = 0; k < count; k += AIPL_DEMOSAIC_CHUNK)
+    {
+        uint32_t n = count - k < AIPL_DEMOSAIC_CHUNK ? count - k
+                                                     : AIPL_DEMOSAIC_CHUNK;
+
+        /* The last column repeats the one before it */
+        uint32_t first = x + k < cc->width - 1 ? x + k : cc->width - 2;
+        uint32_t last = x + k + n < cc->width ? x + k + n : cc->width - 1;
+
+        aipl_raw_correct_row(rows[0], cc, i, first, last - first + 1);
+        aipl_raw_correct_row(rows[1], cc, i + 1, first, last - first + 1);
+
+        for (uint32_t j = 0; j < n; ++j)
+        {
+            uint32_t c = x + k + j < cc->width - 1 ? x + k + j
+                                                   : cc->width - 2;
+            uint32_t red_x = (c + cc->red_col) & 1;
+
+            const uint8_t* red_src = rows[red_y] + c - first;
+            const uint8_t* blue_src = rows[red_y ^ 1] + c - first;
+
+            px[k + j].r = red_src[red_x];
+            px[k + j].g = (red_src[red_x ^ 1] + blue_src[red_x]) >> 1;
+            px[k + j].b = blue_src[red_x ^ 1];
+            px[k + j].a = 0xff;
+        }
+    }
+}
+
+static bool aipl_demosaic_layout(aipl_demosaic_layout_t* layout,
+                                 uint8_t* data,
+                                 uint32_t width, uint32_t height,
+                                 aipl_color_format_t format)
+{
+    uint32_t size = width * height;
+
+    /* Subsampled chroma planes round odd sizes up, the same
+       as the generic conversion engine lays them out */
+    uint32_t uv_width = (width + 1) / 2;
+    uint32_t uv_size = uv_width * ((height + 1) / 2);
+
+    *layout = (aipl_demosaic_layout_t) {
+        .plane = { data, NULL, NULL },
+        .stride = { width * aipl_color_format_depth(format) / 8, 0, 0 },
+        .step = { 1, 1, 1 },
+        .x_shift = 1,
+        .y_shift = 1,
+        .yuv = true,
+    };
+
+    switch (format)
+    {
+        case AIPL_COLOR_ARGB8888:
+        case AIPL_COLOR_ARGB4444:
+        case AIPL_COLOR_ARGB1555:
+        case AIPL_COLOR_RGBA8888:
+        case AIPL_COLOR_RGBA4444:
+        case AIPL_COLOR_RGBA5551:
+        case AIPL_COLOR_BGRA8888:
+        case AIPL_COLOR_ABGR8888:
+        case AIPL_COLOR_RGB888:
+        case AIPL_COLOR_BGR888:
+        case AIPL_COLOR_RGB565:
+            layout->yuv = false;
+            break;
+
+        case AIPL_COLOR_RGB888P:
+            layout->plane[1] = data + size;
+            layout->plane[2] = data + size * 2;
+            layout->stride[0] = width;
+            layout->yuv = false;
+            break;
+
+        case AIPL_COLOR_ALPHA8:
+        case AIPL_COLOR_I400:
+            layout->stride[0] = width;
+            break;
+
+        case AIPL_COLOR_YV12:
+            layout->stride[0] = width;
+            layout->plane[2] = data + size;
+            layout->plane[1] = data + size + uv_size;
+            layout->stride[1] = uv_width;
+            layout->stride[2] = uv_width;
+            break;
+
+        case AIPL_COLOR_I420:
+            layout->stride[0] = width;
+            layout->plane[1] = data + size;
+            layout->plane[2] = data + size + uv_size;
+            layout->stride[1] = uv_width;
+            layout->stride[2] = uv_width;
+            break;
+
+        case AIPL_COLOR_I422:
+            layout->stride[0] = width;
+            layout->plane[1] = data + size;
+            layout->plane[2] = data + size + uv_width * height;
+            layout->stride[1] = uv_width;
+            layout->stride[2] = uv_width;
+            layout->y_shift = 0;
+            break;
+
+        case AIPL_COLOR_I444:
+            layout->stride[0] = width;
+            layout->plane[1] = data + size;
+            layout->plane[2] = data + size * 2;
+            layout->stride[1] = width;
+            layout->stride[2] = width;
+            layout->x_shift = 0;
+            layout->y_shift = 0;
+            break;
+
+        case AIPL_COLOR_NV12:
+        case AIPL_COLOR_NV21:
+        {
+            uint8_t u = format == AIPL_COLOR_NV12 ? 0 : 1;
+
+            layout->plane[1] = data + size + u;
+            layout->plane[2] = data + size + (u ^ 1);
+            layout->stride[0] = width;
+            layout->stride[1] = uv_width * 2;
+            layout->stride[2] = uv_width * 2;
+            layout->step[1] = 2;
+            layout->step[2] = 2;
+            break;
+        }
+
+        case AIPL_COLOR_YUY2:
+        case AIPL_COLOR_UYVY:
+        {
+            uint8_t y = format == AIPL_COLOR_YUY2 ? 0 : 1;
+
+            layout->plane[0] = data + y;
+            layout->plane[1] = data + (y ^ 1);
+            layout->plane[2] = data + (y ^ 1) + 2;
+            layout->stride[0] = uv_width * 4;
+            layout->stride[1] = uv_width * 4;
+            layout->stride[2] = uv_width * 4;
+            layout->step[0] = 2;
+            layout->step[1] = 4;
+            layout->step[2] = 4;
+            layout->y_shift = 0;
+            break;
+        }
+
+        default:
+            return false;
+    }
+
+    return true;
+}
+
+static void aipl_demosaic_encode_rgb(const aipl_demosaic_layout_t* layout,
+                                     const aipl_argb8888_px_t* px,
+                                     uint32_t x, uint32_t y, uint32_t count,
+                                     aipl_color_format_t format)
+{
+    uint8_t* dst = layout->plane[0] + y * layout->stride[0];
+
+    switch (format)
+    {
+        case AIPL_COLOR_ARGB8888:
+            memcpy(dst + x * 4, px, count * 4);
+            break;
+
+        case AIPL_COLOR_RGBA8888:
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                aipl_cnvt_px_argb8888_to_rgba8888((aipl_rgba8888_px_t*)dst
+                                                  + x + i, px + i);
+            }
+            break;
+
+        case AIPL_COLOR_BGRA8888:
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                aipl_cnvt_px_argb8888_to_bgra8888((aipl_bgra8888_px_t*)dst
+                                                  + x + i, px + i);
+            }
+            break;
+
+        case AIPL_COLOR_ABGR8888:
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                aipl_cnvt_px_argb8888_to_abgr8888((aipl_abgr8888_px_t*)dst
+                                                  + x + i, px + i);
+            }
+            break;
+
+        case AIPL_COLOR_RGB888:
+        case AIPL_COLOR_BGR888:
+        {
+            uint8_t r_offset = format == AIPL_COLOR_RGB888 ? 0 : 2;
+
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                aipl_cnvt_px_argb8888_to_24bit(dst + (x + i) * 3, px + i,
+                                               r_offset, 1, 2 - r_offset);
+            }
+            break;
+        }
+
+        case AIPL_COLOR_RGB888P:
+        {
+            uint8_t* g_dst = layout->plane[1] + y * layout->stride[0];
+            uint8_t* b_dst = layout->plane[2] + y * layout->stride[0];
+
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                dst[x + i] = px[i].r;
+                g_dst[x + i] = px[i].g;
+                b_dst[x + i] = px[i].b;
+            }
+            break;
+        }
+
+        default:
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                aipl_cnvt_px_argb8888_to_16bit(dst + (x + i) * 2, px + i,
+                                               format);
+            }
+            break;
+    }
+}
+
+static void aipl_demosaic_encode_yuv(const aipl_demosaic_layout_t* layout,
+                                     aipl_argb8888_px_t (*px)[AIPL_DEMOSAIC_CHUNK],
+                                     uint32_t x, uint32_t y,
+                                     uint32_t count, uint32_t rows,
+                                     const aipl_yuv_coefs_t* coefs)
+{
+    uint8_t u[2][AIPL_DEMOSAIC_CHUNK];
+    uint8_t v[2][AIPL_DEMOSAIC_CHUNK];
+
+    for (uint32_t r = 0; r < rows; ++r)
+    {
+        uint8_t* y_dst = layout->plane[0] + (y + r) * layout->stride[0]
+                         + x * layout->step[0];
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            aipl_cnvt_px_rgb_to_yuv_coefs(y_dst + i * layout->step[0],
+                                          &u[r][i], &v[r][i],
+                                          px[r][i].r, px[r][i].g, px[r][i].b,
+                                          coefs);
+        }
+    }
+
+    if (layout->plane[1] == NULL)
+    {
+        return;
+    }
+
+    /* Chroma is the rounded average of its block, the trailing row
+       and column of odd sizes make up blocks of their own */
+    uint32_t block_rows = layout->y_shift ? rows : 1;
+    uint32_t block_step = 1 << layout->x_shift;
+
+    for (uint32_t r = 0; r < rows; r += block_rows)
+    {
+        uint32_t offset = ((y + r) >> layout->y_shift) * layout->stride[1]
+                          + (x >> layout->x_shift) * layout->step[1];
+        uint8_t* u_dst = layout->plane[1] + offset;
+        uint8_t* v_dst = layout->plane[2] + offset;
+
+        for (uint32_t i = 0; i < count; i += block_step)
+        {
+            uint32_t cols = count - i < block_step ? count - i : block_step;
+            uint32_t n = block_rows * cols;
+            uint32_t idx = i >> layout->x_shift;
+            uint32_t u_sum = 0;
+            uint32_t v_sum = 0;
+
+            for (uint32_t br = r; br < r + block_rows; ++br)
+            {
+                for (uint32_t c = i; c < i + cols; ++c)
+                {
+                    u_sum += u[br][c];
+                    v_sum += v[br][c];
+                }
+            }
+
+            u_dst[idx * layout->step[1]] = (u_sum + n / 2) / n;
+            v_dst[idx * layout->step[2]] = (v_sum + n / 2) / n;
+        }
+    }
+}
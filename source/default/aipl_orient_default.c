@@ -0,0 +1,231 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/******************************************************************************
+ * @file    aipl_orient_default.c
+ * @brief   Default orientation transform function implementations
+ *
+******************************************************************************/
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "aipl_orient_default.h"
+
+#include <string.h>
+#include <stddef.h>
+
+#include "aipl_config.h"
+#include "aipl_cache.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/* Side of the square tile used for transposing orientations */
+#define AIPL_ORIENT_TILE_SIZE 16
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void aipl_orient_tile(const uint8_t* src, uint8_t* dst,
+                             int32_t src_pitch,
+                             int32_t width, int32_t height,
+                             int32_t dst_x_step, int32_t dst_y_step,
+                             uint32_t bpp);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+aipl_error_t aipl_orient_default(const void* input, void* output,
+                                 uint32_t pitch,
+                                 uint32_t width, uint32_t height,
+                                 aipl_color_format_t format,
+                                 aipl_orientation_t orientation,
+                                 uint32_t left, uint32_t top,
+                                 uint32_t right, uint32_t bottom)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    if (aipl_color_format_space(format) != AIPL_SPACE_RGB)
+        return AIPL_ERR_UNSUPPORTED_FORMAT;
+
+    if (orientation < AIPL_ORIENT_NORMAL || orientation > AIPL_ORIENT_ROTATE_270)
+        return AIPL_ERR_NOT_SUPPORTED;
+
+    if ((left > right) || (right > width) || (top > bottom) || (bottom > height))
+        return AIPL_ERR_FRAME_OUT_OF_RANGE;
+
+    uint32_t bpp = aipl_color_format_depth(format) / 8;
+    int32_t new_width = right - left;
+    int32_t new_height = bottom - top;
+
+    /* Every orientation is an optional transpose followed by mirroring */
+    bool transpose = aipl_orientation_is_transposed(orientation);
+    bool flip_h = orientation == AIPL_ORIENT_FLIP_H
+                  || orientation == AIPL_ORIENT_ROTATE_180
+                  || orientation == AIPL_ORIENT_ROTATE_90
+                  || orientation == AIPL_ORIENT_TRANSVERSE;
+    bool flip_v = orientation == AIPL_ORIENT_FLIP_V
+                  || orientation == AIPL_ORIENT_ROTATE_180
+                  || orientation == AIPL_ORIENT_ROTATE_270
+                  || orientation == AIPL_ORIENT_TRANSVERSE;
+
+    int32_t output_width = transpose ? new_height : new_width;
+    int32_t output_height = transpose ? new_width : new_height;
+
+    /* Output offsets of a source pixel step along each axis */
+    int32_t out_col = flip_h ? -(int32_t)bpp : (int32_t)bpp;
+    int32_t out_row = (flip_v ? -output_width : output_width) * (int32_t)bpp;
+    int32_t dst_x_step = transpose ? out_row : out_col;
+    int32_t dst_y_step = transpose ? out_col : out_row;
+
+    const uint8_t* src = (const uint8_t*)input + (top * pitch + left) * bpp;
+    uint8_t* dst = (uint8_t*)output
+                   + ((flip_v ? output_height - 1 : 0) * output_width
+                      + (flip_h ? output_width - 1 : 0)) * bpp;
+
+    int32_t src_pitch = pitch * bpp;
+
+    if (!transpose && !flip_h)
+    {
+        /* Rows keep their pixel order */
+        for (int32_t y = 0; y < new_height; ++y)
+        {
+            memmove(dst + y * dst_y_step, src + y * src_pitch,
+                    new_width * bpp);
+        }
+    }
+    else
+    {
+        /* Transposing writes are spread over whole columns,
+           so walk the source in tiles to keep them cache local */
+        int32_t tile_width = transpose ? AIPL_ORIENT_TILE_SIZE : new_width;
+        int32_t tile_height = transpose ? AIPL_ORIENT_TILE_SIZE : 1;
+
+        for (int32_t ty = 0; ty < new_height; ty += tile_height)
+        {
+            int32_t h = new_height - ty < tile_height ? new_height - ty
+                                                      : tile_height;
+
+            for (int32_t tx = 0; tx < new_width; tx += tile_width)
+            {
+                int32_t w = new_width - tx < tile_width ? new_width - tx
+                                                        : tile_width;
+
+                aipl_orient_tile(src + ty * src_pitch + tx * (int32_t)bpp,
+                                 dst + ty * dst_y_step + tx * dst_x_step,
+                                 src_pitch, w, h,
+                                 dst_x_step, dst_y_step,
+                                 bpp);
+            }
+        }
+    }
+
+    size_t size = new_width * new_height * bpp;
+    aipl_cpu_cache_clean(output, size);
+
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_orient_img_default(const aipl_image_t* input,
+                                     aipl_image_t* output,
+                                     aipl_orientation_t orientation,
+                                     uint32_t left, uint32_t top,
+                                     uint32_t right, uint32_t bottom)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    if (output->format != input->format)
+        return AIPL_ERR_FORMAT_MISMATCH;
+
+    uint32_t new_width = right - left;
+    uint32_t new_height = bottom - top;
+    if (aipl_orientation_is_transposed(orientation))
+    {
+        new_width = bottom - top;
+        new_height = right - left;
+    }
+
+    if (new_width != output->width || new_height != output->height)
+        return AIPL_ERR_SIZE_MISMATCH;
+
+    return aipl_orient_default(input->data, output->data,
+                               input->pitch,
+                               input->width, input->height,
+                               input->format,
+                               orientation,
+                               left, top,
+                               right, bottom);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static void aipl_orient_tile(const uint8_t* src, uint8_t* dst,
+                             int32_t src_pitch,
+                             int32_t width, int32_t height,
+                             int32_t dst_x_step, int32_t dst_y_step,
+                             uint32_t bpp)
+{
+    for (int32_t y = 0; y < height; ++y)
+    {
+        const uint8_t* src_px = src + y * src_pitch;
+        uint8_t* dst_px = dst + y * dst_y_step;
+
+        switch (bpp)
+        {
+            case 1:
+                for (int32_t x = 0; x < width; ++x)
+                {
+                    *dst_px = src_px[x];
+                    dst_px += dst_x_step;
+                }
+                break;
+            case 2:
+                for (int32_t x = 0; x < width; ++x)
+                {
+                    *(uint16_t*)dst_px = ((const uint16_t*)src_px)[x];
+                    dst_px += dst_x_step;
+                }
+                break;
+            case 3:
+                for (int32_t x = 0; x < width; ++x)
+                {
+                    dst_px[0] = src_px[0];
+                    dst_px[1] = src_px[1];
+                    dst_px[2] = src_px[2];
+                    src_px += 3;
+                    dst_px += dst_x_step;
+                }
+                break;
+            case 4:
+                for (int32_t x = 0; x < width; ++x)
+                {
+                    *(uint32_t*)dst_px = ((const uint32_t*)src_px)[x];
+                    dst_px += dst_x_step;
+                }
+                break;
+        }
+    }
+}
@@ -0,0 +1,237 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/******************************************************************************
+ * @file    aipl_premultiply_default.c
+ * @brief   Default premultiplied alpha function implementations
+ *
+******************************************************************************/
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "aipl_premultiply_default.h"
+
+#include <stddef.h>
+
+#include "aipl_utils.h"
+
+#if !defined(AIPL_HELIUM_ACCELERATION) || defined(AIPL_INCLUDE_ALL_DEFAULT)
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+aipl_error_t aipl_premultiply_argb8888_default(const void* input, void* output,
+                                               uint32_t pitch,
+                                               uint32_t width, uint32_t height)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    const aipl_argb8888_px_t* src_ptr = input;
+    aipl_argb8888_px_t* dst_ptr = output;
+
+    for (uint32_t i = 0; i < height; ++i)
+    {
+        const aipl_argb8888_px_t* src = src_ptr + (i * pitch);
+        aipl_argb8888_px_t* dst = dst_ptr + (i * width);
+
+        for (uint32_t j = 0; j < width; ++j)
+        {
+            aipl_cnvt_px_premultiply(dst, src);
+
+            ++src;
+            ++dst;
+        }
+    }
+
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_premultiply_rgba8888_default(const void* input, void* output,
+                                               uint32_t pitch,
+                                               uint32_t width, uint32_t height)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    const aipl_rgba8888_px_t* src_ptr = input;
+    aipl_rgba8888_px_t* dst_ptr = output;
+
+    for (uint32_t i = 0; i < height; ++i)
+    {
+        const aipl_rgba8888_px_t* src = src_ptr + (i * pitch);
+        aipl_rgba8888_px_t* dst = dst_ptr + (i * width);
+
+        for (uint32_t j = 0; j < width; ++j)
+        {
+            uint8_t a = src->a;
+
+            dst->r = aipl_premultiply_channel(src->r, a);
+            dst->g = aipl_premultiply_channel(src->g, a);
+            dst->b = aipl_premultiply_channel(src->b, a);
+            dst->a = a;
+
+            ++src;
+            ++dst;
+        }
+    }
+
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_premultiply_argb4444_default(const void* input, void* output,
+                                               uint32_t pitch,
+                                               uint32_t width, uint32_t height)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    const aipl_argb4444_px_t* src_ptr = input;
+    aipl_argb4444_px_t* dst_ptr = output;
+
+    for (uint32_t i = 0; i < height; ++i)
+    {
+        const aipl_argb4444_px_t* src = src_ptr + (i * pitch);
+        aipl_argb4444_px_t* dst = dst_ptr + (i * width);
+
+        for (uint32_t j = 0; j < width; ++j)
+        {
+            uint8_t a = src->a;
+
+            dst->r = aipl_premultiply_channel_4bit(src->r, a);
+            dst->g = aipl_premultiply_channel_4bit(src->g, a);
+            dst->b = aipl_premultiply_channel_4bit(src->b, a);
+            dst->a = a;
+
+            ++src;
+            ++dst;
+        }
+    }
+
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_unpremultiply_pargb8888_default(const void* input, void* output,
+                                                  uint32_t pitch,
+                                                  uint32_t width, uint32_t height)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    const aipl_argb8888_px_t* src_ptr = input;
+    aipl_argb8888_px_t* dst_ptr = output;
+
+    for (uint32_t i = 0; i < height; ++i)
+    {
+        const aipl_argb8888_px_t* src = src_ptr + (i * pitch);
+        aipl_argb8888_px_t* dst = dst_ptr + (i * width);
+
+        for (uint32_t j = 0; j < width; ++j)
+        {
+            aipl_cnvt_px_unpremultiply(dst, src);
+
+            ++src;
+            ++dst;
+        }
+    }
+
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_unpremultiply_prgba8888_default(const void* input, void* output,
+                                                  uint32_t pitch,
+                                                  uint32_t width, uint32_t height)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    const aipl_rgba8888_px_t* src_ptr = input;
+    aipl_rgba8888_px_t* dst_ptr = output;
+
+    for (uint32_t i = 0; i < height; ++i)
+    {
+        const aipl_rgba8888_px_t* src = src_ptr + (i * pitch);
+        aipl_rgba8888_px_t* dst = dst_ptr + (i * width);
+
+        for (uint32_t j = 0; j < width; ++j)
+        {
+            uint8_t a = src->a;
+
+            dst->r = aipl_unpremultiply_channel(src->r, a);
+            dst->g = aipl_unpremultiply_channel(src->g, a);
+            dst->b = aipl_unpremultiply_channel(src->b, a);
+            dst->a = a;
+
+            ++src;
+            ++dst;
+        }
+    }
+
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_unpremultiply_pargb4444_default(const void* input, void* output,
+                                                  uint32_t pitch,
+                                                  uint32_t width, uint32_t height)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    const aipl_argb4444_px_t* src_ptr = input;
+    aipl_argb4444_px_t* dst_ptr = output;
+
+    for (uint32_t i = 0; i < height; ++i)
+    {
+        const aipl_argb4444_px_t* src = src_ptr + (i * pitch);
+        aipl_argb4444_px_t* dst = dst_ptr + (i * width);
+
+        for (uint32_t j = 0; j < width; ++j)
+        {
+            uint8_t a = src->a;
+
+            dst->r = aipl_unpremultiply_channel_4bit(src->r, a);
+            dst->g = aipl_unpremultiply_channel_4bit(src->g, a);
+            dst->b = aipl_unpremultiply_channel_4bit(src->b, a);
+            dst->a = a;
+
+            ++src;
+            ++dst;
+        }
+    }
+
+    return AIPL_ERR_OK;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#endif
@@ -0,0 +1,615 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/******************************************************************************
+ * @file    aipl_remap_default.c
+ * @brief   Default coordinate map based image remapping function implementations
+ *
+******************************************************************************/
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "aipl_remap_default.h"
+
+#include <stddef.h>
+
+#include "aipl_config.h"
+#include "aipl_cache.h"
+#include "aipl_utils.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/* Side of the square output tile walked at once */
+#define AIPL_REMAP_TILE_SIZE 16
+
+/* Map coordinates are in 24.8 fixed point */
+#define AIPL_REMAP_FRAC_BITS 8
+#define AIPL_REMAP_HALF (1 << (AIPL_REMAP_FRAC_BITS - 1))
+
+#define AIPL_REMAP_MAX_PLANES 3
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/* Single plane of samples remapped independently */
+typedef struct {
+    const uint8_t* src;
+    int32_t src_pitch;      /* Input row size in bytes */
+    int32_t src_step;       /* Input pixel size in bytes */
+    int32_t width;          /* Input plane width */
+    int32_t height;         /* Input plane height */
+    uint8_t* dst;
+    int32_t dst_pitch;      /* Output row size in bytes */
+    int32_t dst_step;       /* Output pixel size in bytes */
+    int32_t dst_height;     /* Output plane height */
+    uint32_t channels;      /* Samples per pixel */
+    uint32_t shift_x;       /* Horizontal subsampling */
+    uint32_t shift_y;       /* Vertical subsampling */
+    uint8_t fill;           /* Value of the samples mapped outside */
+    aipl_color_format_t format;
+} aipl_remap_plane_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static uint32_t aipl_remap_setup_planes(aipl_remap_plane_t* planes,
+                                        const uint8_t* input, uint8_t* output,
+                                        uint32_t pitch,
+                                        uint32_t width, uint32_t height,
+                                        aipl_color_format_t format,
+                                        uint32_t output_width,
+                                        uint32_t output_height);
+static void aipl_remap_coords(const aipl_remap_t* map,
+                              int32_t x, int32_t y, int32_t count,
+                              int32_t* u, int32_t* v);
+static void aipl_remap_plane_row(const aipl_remap_plane_t* plane,
+                                 uint8_t* dst, int32_t count,
+                                 const int32_t* u, const int32_t* v,
+                                 bool interpolate);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+aipl_error_t aipl_remap_default(const void* input, void* output,
+                                uint32_t pitch,
+                                uint32_t width, uint32_t height,
+                                aipl_color_format_t format,
+                                uint32_t output_width, uint32_t output_height,
+                                const aipl_remap_t* map,
+                                bool interpolate)
+{
+    if (input == NULL || output == NULL
+        || map == NULL || map->points == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    if (map->step_shift > AIPL_REMAP_MAX_STEP_SHIFT)
+        return AIPL_ERR_NOT_SUPPORTED;
+
+    if (output_width == 0 || output_height == 0)
+        return AIPL_ERR_OK;
+
+    if (map->grid_width <= ((output_width - 1) >> map->step_shift)
+        || map->grid_height <= ((output_height - 1) >> map->step_shift))
+        return AIPL_ERR_SIZE_MISMATCH;
+
+    aipl_remap_plane_t planes[AIPL_REMAP_MAX_PLANES];
+    uint32_t plane_cnt = aipl_remap_setup_planes(planes, input, output,
+                                                 pitch, width, height, format,
+                                                 output_width, output_height);
+    if (plane_cnt == 0)
+        return AIPL_ERR_UNSUPPORTED_FORMAT;
+
+    int32_t u[AIPL_REMAP_TILE_SIZE];
+    int32_t v[AIPL_REMAP_TILE_SIZE];
+
+    /* Neighbouring output pixels usually sample neighbouring input pixels,
+       so walking the output in tiles keeps the source reads cache local */
+    for (int32_t ty = 0; ty < (int32_t)output_height; ty += AIPL_REMAP_TILE_SIZE)
+    {
+        int32_t ty_end = ty + AIPL_REMAP_TILE_SIZE;
+        if (ty_end > (int32_t)output_height)
+            ty_end = output_height;
+
+        for (int32_t tx = 0; tx < (int32_t)output_width; tx += AIPL_REMAP_TILE_SIZE)
+        {
+            int32_t tx_end = tx + AIPL_REMAP_TILE_SIZE;
+            if (tx_end > (int32_t)output_width)
+                tx_end = output_width;
+
+            for (int32_t y = ty; y < ty_end; ++y)
+            {
+                aipl_remap_coords(map, tx, y, tx_end - tx, u, v);
+
+                for (uint32_t i = 0; i < plane_cnt; ++i)
+                {
+                    const aipl_remap_plane_t* plane = &planes[i];
+
+                    /* Subsampled planes take every n-th map coordinate */
+                    if ((y & ((1 << plane->shift_y) - 1)) != 0
+                        || (y >> plane->shift_y) >= plane->dst_height)
+                        continue;
+
+                    int32_t x0 = tx >> plane->shift_x;
+                    int32_t count = (tx_end >> plane->shift_x) - x0;
+
+                    aipl_remap_plane_row(plane,
+                                         plane->dst
+                                         + (y >> plane->shift_y) * plane->dst_pitch
+                                         + x0 * plane->dst_step,
+                                         count, u, v, interpolate);
+                }
+            }
+        }
+    }
+
+    aipl_cpu_cache_clean(output, output_width * output_height
+                                 * aipl_color_format_depth(format) / 8);
+
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_remap_img_default(const aipl_image_t* input,
+                                    aipl_image_t* output,
+                                    const aipl_remap_t* map,
+                                    bool interpolate)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    if (output->format != input->format)
+        return AIPL_ERR_FORMAT_MISMATCH;
+
+    return aipl_remap_default(input->data, output->data,
+                              input->pitch,
+                              input->width, input->height,
+                              input->format,
+                              output->width, output->height,
+                              map, interpolate);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static void aipl_remap_set_plane(aipl_remap_plane_t* plane,
+                                 const uint8_t* src, int32_t src_pitch,
+                                 int32_t src_step,
+                                 uint32_t width, uint32_t height,
+                                 uint8_t* dst, int32_t dst_step,
+                                 uint32_t output_width, uint32_t output_height,
+                                 uint32_t channels,
+                                 uint32_t shift_x, uint32_t shift_y,
+                                 uint8_t fill,
+                                 aipl_color_format_t format)
+{
+    plane->src = src;
+    plane->src_pitch = src_pitch;
+    plane->src_step = src_step;
+    plane->width = width >> shift_x;
+    plane->height = height >> shift_y;
+    plane->dst = dst;
+    plane->dst_pitch = (output_width >> shift_x) * dst_step;
+    plane->dst_step = dst_step;
+    plane->dst_height = output_height >> shift_y;
+    plane->channels = channels;
+    plane->shift_x = shift_x;
+    plane->shift_y = shift_y;
+    plane->fill = fill;
+    plane->format = format;
+}
+
+static uint32_t aipl_remap_setup_planes(aipl_remap_plane_t* planes,
+                                        const uint8_t* input, uint8_t* output,
+                                        uint32_t pitch,
+                                        uint32_t width, uint32_t height,
+                                        aipl_color_format_t format,
+                                        uint32_t output_width,
+                                        uint32_t output_height)
+{
+    uint32_t yuv_size = pitch * height;
+    uint32_t out_size = output_width * output_height;
+
+    const uint8_t* u_ptr = NULL;
+    const uint8_t* v_ptr = NULL;
+    uint8_t* out_u_ptr = NULL;
+    uint8_t* out_v_ptr = NULL;
+    uint32_t shift_x = 0;
+    uint32_t shift_y = 0;
+
+    switch (format)
+    {
+        case AIPL_COLOR_ALPHA8:
+        case AIPL_COLOR_ARGB8888:
+        case AIPL_COLOR_ARGB4444:
+        case AIPL_COLOR_ARGB1555:
+        case AIPL_COLOR_RGBA8888:
+        case AIPL_COLOR_RGBA4444:
+        case AIPL_COLOR_RGBA5551:
+        case AIPL_COLOR_BGR888:
+        case AIPL_COLOR_RGB888:
+        case AIPL_COLOR_RGB565:
+        {
+            uint32_t bpp = aipl_color_format_depth(format) / 8;
+            aipl_remap_set_plane(&planes[0], input, pitch * bpp, bpp,
+                                 width, height, output, bpp,
+                                 output_width, output_height,
+                                 bpp, 0, 0, 0, format);
+            return 1;
+        }
+
+        case AIPL_COLOR_RGB888P:
+            for (uint32_t i = 0; i < 3; ++i)
+            {
+                aipl_remap_set_plane(&planes[i], input + i * yuv_size, pitch, 1,
+                                     width, height, output + i * out_size, 1,
+                                     output_width, output_height,
+                                     1, 0, 0, 0, format);
+            }
+            return 3;
+
+        case AIPL_COLOR_YUY2:
+        case AIPL_COLOR_UYVY:
+        {
+            uint32_t y_offset = format == AIPL_COLOR_YUY2 ? 0 : 1;
+            uint32_t u_offset = format == AIPL_COLOR_YUY2 ? 1 : 0;
+            uint32_t v_offset = format == AIPL_COLOR_YUY2 ? 3 : 2;
+
+            /* Luma and both chroma components are strided planes */
+            aipl_remap_set_plane(&planes[0], input + y_offset, pitch * 2, 2,
+                                 width, height, output + y_offset, 2,
+                                 output_width, output_height,
+                                 1, 0, 0, 16, format);
+            aipl_remap_set_plane(&planes[1], input + u_offset, pitch * 2, 4,
+                                 width, height, output + u_offset, 4,
+                                 output_width, output_height,
+                                 1, 1, 0, 128, format);
+            aipl_remap_set_plane(&planes[2], input + v_offset, pitch * 2, 4,
+                                 width, height, output + v_offset, 4,
+                                 output_width, output_height,
+                                 1, 1, 0, 128, format);
+            planes[1].dst_pitch = output_width * 2;
+            planes[2].dst_pitch = output_width * 2;
+            return 3;
+        }
+
+        case AIPL_COLOR_NV12:
+        case AIPL_COLOR_NV21:
+            /* Interleaved chroma is remapped as a single two channel plane */
+            aipl_remap_set_plane(&planes[0], input, pitch, 1,
+                                 width, height, output, 1,
+                                 output_width, output_height,
+                                 1, 0, 0, 16, format);
+            aipl_remap_set_plane(&planes[1], input + yuv_size, pitch, 2,
+                                 width, height, output + out_size, 2,
+                                 output_width, output_height,
+                                 2, 1, 1, 128, format);
+            return 2;
+
+        case AIPL_COLOR_I400:
+            aipl_remap_set_plane(&planes[0], input, pitch, 1,
+                                 width, height, output, 1,
+                                 output_width, output_height,
+                                 1, 0, 0, 16, format);
+            return 1;
+
+        case AIPL_COLOR_YV12:
+            v_ptr = input + yuv_size;
+            u_ptr = v_ptr + yuv_size / 4;
+            out_v_ptr = output + out_size;
+            out_u_ptr = out_v_ptr + out_size / 4;
+            shift_x = 1;
+            shift_y = 1;
+            break;
+        case AIPL_COLOR_I420:
+            u_ptr = input + yuv_size;
+            v_ptr = u_ptr + yuv_size / 4;
+            out_u_ptr = output + out_size;
+            out_v_ptr = out_u_ptr + out_size / 4;
+            shift_x = 1;
+            shift_y = 1;
+            break;
+        case AIPL_COLOR_I422:
+            u_ptr = input + yuv_size;
+            v_ptr = u_ptr + yuv_size / 2;
+            out_u_ptr = output + out_size;
+            out_v_ptr = out_u_ptr + out_size / 2;
+            shift_x = 1;
+            break;
+        case AIPL_COLOR_I444:
+            u_ptr = input + yuv_size;
+            v_ptr = u_ptr + yuv_size;
+            out_u_ptr = output + out_size;
+            out_v_ptr = out_u_ptr + out_size;
+            break;
+
+        default:
+            return 0;
+    }
+
+    /* Planar YUV formats */
+    aipl_remap_set_plane(&planes[0], input, pitch, 1,
+                         width, height, output, 1,
+                         output_width, output_height,
+                         1, 0, 0, 16, format);
+    aipl_remap_set_plane(&planes[1], u_ptr, pitch >> shift_x, 1,
+                         width, height, out_u_ptr, 1,
+                         output_width, output_height,
+                         1, shift_x, shift_y, 128, format);
+    aipl_remap_set_plane(&planes[2], v_ptr, pitch >> shift_x, 1,
+                         width, height, out_v_ptr, 1,
+                         output_width, output_height,
+                         1, shift_x, shift_y, 128, format);
+
+    return 3;
+}
+
+static INLINE int32_t aipl_remap_point_u(const aipl_remap_point_t* point)
+{
+    return (int32_t)point->x * (1 << AIPL_REMAP_FRAC_BITS) + point->fx;
+}
+
+static INLINE int32_t aipl_remap_point_v(const aipl_remap_point_t* point)
+{
+    return (int32_t)point->y * (1 << AIPL_REMAP_FRAC_BITS) + point->fy;
+}
+
+static void aipl_remap_coords(const aipl_remap_t* map,
+                              int32_t x, int32_t y, int32_t count,
+                              int32_t* u, int32_t* v)
+{
+    uint32_t shift = map->step_shift;
+    int32_t grid_width = map->grid_width;
+    int32_t grid_height = map->grid_height;
+
+    int32_t j = y >> shift;
+    const aipl_remap_point_t* row0 = map->points + j * grid_width;
+
+    if (shift == 0)
+    {
+        for (int32_t k = 0; k < count; ++k)
+        {
+            u[k] = aipl_remap_point_u(&row0[x + k]);
+            v[k] = aipl_remap_point_v(&row0[x + k]);
+        }
+        return;
+    }
+
+    /*
+     * Grid rows and columns past the last one repeat it. The 24.8 map
+     * coordinates are weighted by up to 2^AIPL_REMAP_MAX_STEP_SHIFT,
+     * which needs 64 bits for far apart grid points
+     */
+    int32_t step = 1 << shift;
+    int32_t half = step >> 1;
+    int32_t wy = y & (step - 1);
+    const aipl_remap_point_t* row1 = j + 1 < grid_height ? row0 + grid_width
+                                                         : row0;
+    int32_t end = x + count;
+
+    while (x < end)
+    {
+        int32_t i0 = x >> shift;
+        int32_t i1 = i0 + 1 < grid_width ? i0 + 1 : i0;
+
+        /* Vertically interpolated cell edges */
+        int64_t u_left = ((int64_t)aipl_remap_point_u(&row0[i0]) * (step - wy)
+                          + (int64_t)aipl_remap_point_u(&row1[i0]) * wy
+                          + half) >> shift;
+        int64_t v_left = ((int64_t)aipl_remap_point_v(&row0[i0]) * (step - wy)
+                          + (int64_t)aipl_remap_point_v(&row1[i0]) * wy
+                          + half) >> shift;
+        int64_t u_right = ((int64_t)aipl_remap_point_u(&row0[i1]) * (step - wy)
+                           + (int64_t)aipl_remap_point_u(&row1[i1]) * wy
+                           + half) >> shift;
+        int64_t v_right = ((int64_t)aipl_remap_point_v(&row0[i1]) * (step - wy)
+                           + (int64_t)aipl_remap_point_v(&row1[i1]) * wy
+                           + half) >> shift;
+
+        /* Walk the cell incrementally */
+        int32_t wx = x & (step - 1);
+        int64_t du = u_right - u_left;
+        int64_t dv = v_right - v_left;
+        int64_t u_acc = u_left * step + du * wx + half;
+        int64_t v_acc = v_left * step + dv * wx + half;
+
+        int32_t n = step - wx < end - x ? step - wx : end - x;
+        for (int32_t k = 0; k < n; ++k)
+        {
+            *u++ = (int32_t)(u_acc >> shift);
+            *v++ = (int32_t)(v_acc >> shift);
+            u_acc += du;
+            v_acc += dv;
+        }
+
+        x += n;
+    }
+}
+
+static INLINE void aipl_remap_nearest_row(const aipl_remap_plane_t* plane,
+                                          uint8_t* dst, int32_t count,
+                                          const int32_t* u, const int32_t* v,
+                                          uint32_t channels)
+{
+    uint32_t shift_x = plane->shift_x;
+    uint32_t shift_y = plane->shift_y;
+
+    for (int32_t k = 0; k < count; ++k)
+    {
+        int32_t xi = ((u[k << shift_x] >> shift_x) + AIPL_REMAP_HALF)
+                     >> AIPL_REMAP_FRAC_BITS;
+        int32_t yi = ((v[k << shift_x] >> shift_y) + AIPL_REMAP_HALF)
+                     >> AIPL_REMAP_FRAC_BITS;
+
+        if ((uint32_t)xi < (uint32_t)plane->width
+            && (uint32_t)yi < (uint32_t)plane->height)
+        {
+            const uint8_t* px = plane->src + yi * plane->src_pitch
+                                + xi * plane->src_step;
+            for (uint32_t c = 0; c < channels; ++c)
+                dst[c] = px[c];
+        }
+        else
+        {
+            for (uint32_t c = 0; c < channels; ++c)
+                dst[c] = plane->fill;
+        }
+
+        dst += plane->dst_step;
+    }
+}
+
+static INLINE void aipl_remap_bilinear_row(const aipl_remap_plane_t* plane,
+                                           uint8_t* dst, int32_t count,
+                                           const int32_t* u, const int32_t* v,
+                                           uint32_t channels,
+                                           aipl_color_format_t format)
+{
+    uint32_t shift_x = plane->shift_x;
+    uint32_t shift_y = plane->shift_y;
+    int32_t u_max = (plane->width - 1) << AIPL_REMAP_FRAC_BITS;
+    int32_t v_max = (plane->height - 1) << AIPL_REMAP_FRAC_BITS;
+
+    for (int32_t k = 0; k < count; ++k)
+    {
+        int32_t uu = u[k << shift_x] >> shift_x;
+        int32_t vv = v[k << shift_x] >> shift_y;
+
+        if (uu < 0 || uu > u_max || vv < 0 || vv > v_max)
+        {
+            for (uint32_t c = 0; c < channels; ++c)
+                dst[c] = plane->fill;
+
+            dst += plane->dst_step;
+            continue;
+        }
+
+        int32_t xi = uu >> AIPL_REMAP_FRAC_BITS;
+        int32_t yi = vv >> AIPL_REMAP_FRAC_BITS;
+        uint32_t fx = uu & ((1 << AIPL_REMAP_FRAC_BITS) - 1);
+        uint32_t fy = vv & ((1 << AIPL_REMAP_FRAC_BITS) - 1);
+
+        /* Neighbours past the last row or column have zero weight */
+        int32_t x_step = fx != 0 ? plane->src_step : 0;
+        int32_t y_step = fy != 0 ? plane->src_pitch : 0;
+
+        const uint8_t* p00 = plane->src + yi * plane->src_pitch
+                             + xi * plane->src_step;
+
+        if (format == AIPL_COLOR_UNKNOWN)
+        {
+            aipl_bilinear_px(dst, p00, p00 + x_step,
+                             p00 + y_step, p00 + y_step + x_step,
+                             fx, fy, channels);
+        }
+        else
+        {
+            /* Packed channels are interpolated in ARGB8888 */
+            aipl_argb8888_px_t px[4];
+            aipl_argb8888_px_t res;
+            aipl_cnvt_px_16bit_to_argb8888(&px[0], p00, format);
+            aipl_cnvt_px_16bit_to_argb8888(&px[1], p00 + x_step, format);
+            aipl_cnvt_px_16bit_to_argb8888(&px[2], p00 + y_step, format);
+            aipl_cnvt_px_16bit_to_argb8888(&px[3], p00 + y_step + x_step, format);
+
+            aipl_bilinear_px((uint8_t*)&res,
+                             (const uint8_t*)&px[0],
+                             (const uint8_t*)&px[1],
+                             (const uint8_t*)&px[2],
+                             (const uint8_t*)&px[3],
+                             fx, fy, 4);
+
+            aipl_cnvt_px_argb8888_to_16bit(dst, &res, format);
+        }
+
+        dst += plane->dst_step;
+    }
+}
+
+static void aipl_remap_plane_row(const aipl_remap_plane_t* plane,
+                                 uint8_t* dst, int32_t count,
+                                 const int32_t* u, const int32_t* v,
+                                 bool interpolate)
+{
+    /* Constant channel counts and formats let the row loops specialize */
+    if (!interpolate)
+    {
+        switch (plane->channels)
+        {
+            case 1:
+                aipl_remap_nearest_row(plane, dst, count, u, v, 1);
+                break;
+            case 2:
+                aipl_remap_nearest_row(plane, dst, count, u, v, 2);
+                break;
+            case 3:
+                aipl_remap_nearest_row(plane, dst, count, u, v, 3);
+                break;
+            default:
+                aipl_remap_nearest_row(plane, dst, count, u, v, 4);
+                break;
+        }
+        return;
+    }
+
+    switch (plane->format)
+    {
+        case AIPL_COLOR_ARGB4444:
+            aipl_remap_bilinear_row(plane, dst, count, u, v, 2,
+                                    AIPL_COLOR_ARGB4444);
+            break;
+        case AIPL_COLOR_ARGB1555:
+            aipl_remap_bilinear_row(plane, dst, count, u, v, 2,
+                                    AIPL_COLOR_ARGB1555);
+            break;
+        case AIPL_COLOR_RGBA4444:
+            aipl_remap_bilinear_row(plane, dst, count, u, v, 2,
+                                    AIPL_COLOR_RGBA4444);
+            break;
+        case AIPL_COLOR_RGBA5551:
+            aipl_remap_bilinear_row(plane, dst, count, u, v, 2,
+                                    AIPL_COLOR_RGBA5551);
+            break;
+        case AIPL_COLOR_RGB565:
+            aipl_remap_bilinear_row(plane, dst, count, u, v, 2,
+                                    AIPL_COLOR_RGB565);
+            break;
+        default:
+            /* Byte channels of all other formats */
+            switch (plane->channels)
+            {
+                case 1:
+                    aipl_remap_bilinear_row(plane, dst, count, u, v, 1,
+                                            AIPL_COLOR_UNKNOWN);
+                    break;
+                case 2:
+                    aipl_remap_bilinear_row(plane, dst, count, u, v, 2,
+                                            AIPL_COLOR_UNKNOWN);
+                    break;
+                case 3:
+                    aipl_remap_bilinear_row(plane, dst, count, u, v, 3,
+                                            AIPL_COLOR_UNKNOWN);
+                    break;
+                default:
+                    aipl_remap_bilinear_row(plane, dst, count, u, v, 4,
+                                            AIPL_COLOR_UNKNOWN);
+                    break;
+            }
+            break;
+    }
+}
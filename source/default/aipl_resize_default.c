@@ -42,7 +42,8 @@ static aipl_error_t aipl_resize_sw_8bit_channels(const void* input, void* output
                                                  int input_pitch,
                                                  int input_width, int input_height,
                                                  int output_width, int output_height,
-                                                 aipl_color_format_t format);
+                                                 uint32_t pixel_size_B,
+                                                 uint32_t channels);
 static aipl_error_t aipl_resize_sw_argb1555(const void* input, void* output,
                                             int input_pitch,
                                             int input_width, int input_height,
@@ -51,6 +52,17 @@ static aipl_error_t aipl_resize_sw_rgba5551(const void* input, void* output,
                                             int input_pitch,
                                             int input_width, int input_height,
                                             int output_width, int output_height);
+static aipl_error_t aipl_resize_sw_y16(const void* input, void* output,
+                                       int input_pitch,
+                                       int input_width, int input_height,
+                                       int output_width, int output_height);
+static aipl_error_t aipl_resize_sw_semi_planar_422(const void* input,
+                                                   void* output,
+                                                   int input_pitch,
+                                                   int input_width,
+                                                   int input_height,
+                                                   int output_width,
+                                                   int output_height);
 #if !defined(AIPL_DAVE2D_ACCELERATION) || defined(AIPL_INCLUDE_ALL_DEFAULT)
 static aipl_error_t aipl_resize_sw_4bit_channels(const void* input, void* output,
                                                  int input_pitch,
@@ -88,12 +100,24 @@ aipl_error_t aipl_resize_default(const void* input, void* output,
         /* RGB color formats */
         case AIPL_COLOR_ARGB8888:
         case AIPL_COLOR_RGBA8888:
+        case AIPL_COLOR_BGRA8888:
+        case AIPL_COLOR_ABGR8888:
+        case AIPL_COLOR_XRGB8888:
+        case AIPL_COLOR_PARGB8888:
+        case AIPL_COLOR_PRGBA8888:
         case AIPL_COLOR_RGB888:
         case AIPL_COLOR_BGR888:
+        {
+            uint32_t pixel_size_B = aipl_color_format_depth(format) / 8;
+            /* The ignored alpha byte of XRGB8888 is not interpolated */
+            uint32_t channels = format == AIPL_COLOR_XRGB8888
+                                ? 3 : pixel_size_B;
+
             return aipl_resize_sw_8bit_channels(input, output, pitch,
                                                 width, height,
                                                 output_width, output_height,
-                                                format);
+                                                pixel_size_B, channels);
+        }
         case AIPL_COLOR_ARGB1555:
             return aipl_resize_sw_argb1555(input, output, pitch,
                                            width, height,
@@ -105,6 +129,7 @@ aipl_error_t aipl_resize_default(const void* input, void* output,
 #if !defined(AIPL_DAVE2D_ACCELERATION) || defined(AIPL_INCLUDE_ALL_DEFAULT)
         case AIPL_COLOR_ARGB4444:
         case AIPL_COLOR_RGBA4444:
+        case AIPL_COLOR_PARGB4444:
             return aipl_resize_sw_4bit_channels(input, output, pitch,
                                                 width, height,
                                                 output_width, output_height);
@@ -114,6 +139,17 @@ aipl_error_t aipl_resize_default(const void* input, void* output,
                                          output_width, output_height);
 #endif
 
+        /* YUV color formats */
+        case AIPL_COLOR_Y16:
+            return aipl_resize_sw_y16(input, output, pitch,
+                                      width, height,
+                                      output_width, output_height);
+        case AIPL_COLOR_NV16:
+        case AIPL_COLOR_NV61:
+            return aipl_resize_sw_semi_planar_422(input, output, pitch,
+                                                  width, height,
+                                                  output_width, output_height);
+
         default:
             return AIPL_ERR_UNSUPPORTED_FORMAT;
     }
@@ -145,13 +181,12 @@ static aipl_error_t aipl_resize_sw_8bit_channels(const void* input, void* output
                                                  int input_pitch,
                                                  int input_width, int input_height,
                                                  int output_width, int output_height,
-                                                 aipl_color_format_t format)
+                                                 uint32_t pixel_size_B,
+                                                 uint32_t channels)
 {
     if (input == NULL || output == NULL)
         return AIPL_ERR_NULL_POINTER;
 
-    const uint32_t pixel_size_B = aipl_color_format_depth(format)/8;
-
     const uint8_t* srcImage = (const uint8_t*)input;
     uint8_t* dstImage = (uint8_t*)output;
 
@@ -203,7 +238,7 @@ static aipl_error_t aipl_resize_sw_8bit_channels(const void* input, void* output
             __builtin_prefetch(&s[tx + input_pitch + 64]);
 
             // interpolate each color channel
-            for (int color = 0; color < pixel_size_B;
+            for (int color = 0; color < channels;
                 color++)
             {
                 uint32_t p00, p01, p10, p11;
@@ -218,6 +253,9 @@ static aipl_error_t aipl_resize_sw_8bit_channels(const void* input, void* output
                 //ready next loop
                 tx++;
             }
+
+            if (channels < pixel_size_B)
+                *d++ = 0xff;
         }
     }
     return AIPL_ERR_OK;
@@ -586,4 +624,107 @@ static aipl_error_t aipl_resize_sw_rgb565(const void* input, void* output,
 }
 #endif
 
+static aipl_error_t aipl_resize_sw_y16(const void* input, void* output,
+                                       int input_pitch,
+                                       int input_width, int input_height,
+                                       int output_width, int output_height)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    const uint16_t* srcImage = (const uint16_t*)input;
+    uint16_t* dstImage = (uint16_t*)output;
+
+    uint32_t src_x_accum, src_y_accum; // accumulators and fractions for scaling the image
+    uint32_t x_frac, nx_frac, y_frac, ny_frac;
+    int x, y, ty;
+
+    if (input_height < 2) {
+        return AIPL_ERR_FRAME_OUT_OF_RANGE;
+    }
+
+#undef FRAC_BITS
+#define FRAC_BITS 14
+    const int FRAC_VAL = (1 << FRAC_BITS);
+    const int FRAC_MASK = (FRAC_VAL - 1);
+
+    // start at 1/2 pixel in to account for integer downsampling which might miss pixels
+    src_y_accum = FRAC_VAL / 2;
+    const uint32_t src_x_frac = (input_width * FRAC_VAL) / output_width;
+    const uint32_t src_y_frac = (input_height * FRAC_VAL) / output_height;
+
+    const uint16_t *s;
+    uint16_t *d;
+
+    for (y = 0; y < output_height; y++) {
+        // do indexing computations
+        ty = src_y_accum >> FRAC_BITS; // src y
+        y_frac = src_y_accum & FRAC_MASK;
+        ny_frac = FRAC_VAL - y_frac; // y fraction and 1.0 - y fraction
+        src_y_accum += src_y_frac;
+
+        s = &srcImage[ty * input_pitch];
+        d = &dstImage[y * output_width];
+        // start at 1/2 pixel in to account for integer downsampling which might miss pixels
+        src_x_accum = FRAC_VAL / 2;
+        for (x = 0; x < output_width; x++)
+        {
+            uint32_t tx;
+            // do indexing computations
+            tx = (src_x_accum >> FRAC_BITS);
+            x_frac = src_x_accum & FRAC_MASK;
+            nx_frac = FRAC_VAL - x_frac; // x fraction and 1.0 - x fraction
+            src_x_accum += src_x_frac;
+
+            // 16-bit samples times the 14-bit fractions fit in 32 bits
+            uint32_t p00, p01, p10, p11;
+            p00 = s[tx];
+            p10 = s[tx + 1];
+            p01 = s[tx + input_pitch];
+            p11 = s[tx + input_pitch + 1];
+            INTERPOLATE_CHANNEL(p00, p10, nx_frac, x_frac);
+            INTERPOLATE_CHANNEL(p01, p11, nx_frac, x_frac);
+            INTERPOLATE_CHANNEL(p00, p01, ny_frac, y_frac);
+
+            *d++ = (uint16_t)p00; // store new pixel
+        }
+    }
+    return AIPL_ERR_OK;
+}
+
+static aipl_error_t aipl_resize_sw_semi_planar_422(const void* input,
+                                                   void* output,
+                                                   int input_pitch,
+                                                   int input_width,
+                                                   int input_height,
+                                                   int output_width,
+                                                   int output_height)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    // Chroma pairs can't be split horizontally
+    if ((input_pitch & 1) || (input_width & 1) || (output_width & 1))
+        return AIPL_ERR_FRAME_OUT_OF_RANGE;
+
+    const uint8_t* src = (const uint8_t*)input;
+    uint8_t* dst = (uint8_t*)output;
+
+    // Luma is resized as a single channel plane
+    aipl_error_t ret = aipl_resize_sw_8bit_channels(src, dst, input_pitch,
+                                                    input_width, input_height,
+                                                    output_width, output_height,
+                                                    1, 1);
+    if (ret != AIPL_ERR_OK)
+        return ret;
+
+    // Full height interleaved chroma is resized as a two channel plane
+    return aipl_resize_sw_8bit_channels(src + input_pitch * input_height,
+                                        dst + output_width * output_height,
+                                        input_pitch / 2,
+                                        input_width / 2, input_height,
+                                        output_width / 2, output_height,
+                                        2, 2);
+}
+
 #endif
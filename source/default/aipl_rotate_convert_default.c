@@ -0,0 +1,514 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/******************************************************************************
+ * @file    aipl_rotate_convert_default.c
+ * @brief   Default fused rotate and color conversion function implementations
+ *
+******************************************************************************/
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "aipl_rotate_convert_default.h"
+
+#include <stddef.h>
+
+#include "aipl_config.h"
+#include "aipl_cache.h"
+#include "aipl_utils.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/* Side of the square tile used for 90 and 270 degree rotations */
+#define AIPL_ROTATE_CONVERT_TILE_SIZE 16
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/**
+ * Row kernel: converts width source pixels and writes them
+ * dst_step bytes apart
+ */
+typedef void (*aipl_rotate_convert_row_t)(const uint8_t* src, uint8_t* dst,
+                                          int32_t width, int32_t dst_step,
+                                          aipl_color_format_t output_format);
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void aipl_rotate_convert_row_argb8888(const uint8_t* src, uint8_t* dst,
+                                             int32_t width, int32_t dst_step,
+                                             aipl_color_format_t output_format);
+static void aipl_rotate_convert_row_rgba8888(const uint8_t* src, uint8_t* dst,
+                                             int32_t width, int32_t dst_step,
+                                             aipl_color_format_t output_format);
+static void aipl_rotate_convert_row_bgr888(const uint8_t* src, uint8_t* dst,
+                                           int32_t width, int32_t dst_step,
+                                           aipl_color_format_t output_format);
+static void aipl_rotate_convert_row_rgb888(const uint8_t* src, uint8_t* dst,
+                                           int32_t width, int32_t dst_step,
+                                           aipl_color_format_t output_format);
+static void aipl_rotate_convert_row_rgb565(const uint8_t* src, uint8_t* dst,
+                                           int32_t width, int32_t dst_step,
+                                           aipl_color_format_t output_format);
+static void aipl_rotate_convert_row_i400(const uint8_t* src, uint8_t* dst,
+                                         int32_t width, int32_t dst_step,
+                                         aipl_color_format_t output_format);
+static void aipl_rotate_convert_row_yuy2(const uint8_t* src, uint8_t* dst,
+                                         int32_t width, int32_t dst_step,
+                                         aipl_color_format_t output_format);
+static void aipl_rotate_convert_row_uyvy(const uint8_t* src, uint8_t* dst,
+                                         int32_t width, int32_t dst_step,
+                                         aipl_color_format_t output_format);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+aipl_error_t aipl_rotate_convert_default(const void* input, void* output,
+                                         uint32_t pitch,
+                                         uint32_t width, uint32_t height,
+                                         aipl_color_format_t input_format,
+                                         aipl_color_format_t output_format,
+                                         aipl_rotation_t rotation)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    aipl_rotate_convert_row_t row;
+    switch (input_format)
+    {
+        case AIPL_COLOR_ARGB8888:
+            row = aipl_rotate_convert_row_argb8888;
+            break;
+        case AIPL_COLOR_RGBA8888:
+            row = aipl_rotate_convert_row_rgba8888;
+            break;
+        case AIPL_COLOR_BGR888:
+            row = aipl_rotate_convert_row_bgr888;
+            break;
+        case AIPL_COLOR_RGB888:
+            row = aipl_rotate_convert_row_rgb888;
+            break;
+        case AIPL_COLOR_RGB565:
+            row = aipl_rotate_convert_row_rgb565;
+            break;
+        case AIPL_COLOR_I400:
+            row = aipl_rotate_convert_row_i400;
+            break;
+        case AIPL_COLOR_YUY2:
+            row = aipl_rotate_convert_row_yuy2;
+            break;
+        case AIPL_COLOR_UYVY:
+            row = aipl_rotate_convert_row_uyvy;
+            break;
+        default:
+            return AIPL_ERR_UNSUPPORTED_FORMAT;
+    }
+
+    switch (output_format)
+    {
+        case AIPL_COLOR_ARGB8888:
+        case AIPL_COLOR_RGBA8888:
+        case AIPL_COLOR_BGR888:
+        case AIPL_COLOR_RGB888:
+        case AIPL_COLOR_RGB565:
+            break;
+        default:
+            return AIPL_ERR_UNSUPPORTED_FORMAT;
+    }
+
+    int32_t in_bpp = aipl_color_format_depth(input_format) / 8;
+    int32_t out_bpp = aipl_color_format_depth(output_format) / 8;
+    int32_t w = width;
+    int32_t h = height;
+
+    /* Output offsets of a source pixel step along each axis
+       and the output offset of the first source pixel */
+    int32_t dst_x_step;
+    int32_t dst_y_step;
+    int32_t dst_offset;
+    switch (rotation)
+    {
+        case AIPL_ROTATE_0:
+            dst_x_step = out_bpp;
+            dst_y_step = w * out_bpp;
+            dst_offset = 0;
+            break;
+        case AIPL_ROTATE_90:
+            dst_x_step = h * out_bpp;
+            dst_y_step = -out_bpp;
+            dst_offset = (h - 1) * out_bpp;
+            break;
+        case AIPL_ROTATE_180:
+            dst_x_step = -out_bpp;
+            dst_y_step = -w * out_bpp;
+            dst_offset = (w * h - 1) * out_bpp;
+            break;
+        case AIPL_ROTATE_270:
+            dst_x_step = -h * out_bpp;
+            dst_y_step = out_bpp;
+            dst_offset = (w - 1) * h * out_bpp;
+            break;
+        default:
+            return AIPL_ERR_NOT_SUPPORTED;
+    }
+
+    /* Rotations by 90 and 270 degrees write output columns,
+       so walk the source in tiles to keep them cache local */
+    bool transpose = rotation == AIPL_ROTATE_90 || rotation == AIPL_ROTATE_270;
+    int32_t tile_width = transpose ? AIPL_ROTATE_CONVERT_TILE_SIZE : w;
+    int32_t tile_height = transpose ? AIPL_ROTATE_CONVERT_TILE_SIZE : 1;
+
+    const uint8_t* src = input;
+    uint8_t* dst = (uint8_t*)output + dst_offset;
+    int32_t src_pitch = pitch * in_bpp;
+
+    for (int32_t ty = 0; ty < h; ty += tile_height)
+    {
+        int32_t th = h - ty < tile_height ? h - ty : tile_height;
+
+        for (int32_t tx = 0; tx < w; tx += tile_width)
+        {
+            int32_t tw = w - tx < tile_width ? w - tx : tile_width;
+
+            const uint8_t* src_tile = src + ty * src_pitch + tx * in_bpp;
+            uint8_t* dst_tile = dst + ty * dst_y_step + tx * dst_x_step;
+
+            for (int32_t y = 0; y < th; ++y)
+            {
+                row(src_tile + y * src_pitch, dst_tile + y * dst_y_step,
+                    tw, dst_x_step, output_format);
+            }
+        }
+    }
+
+    aipl_cpu_cache_clean(output, w * h * out_bpp);
+
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_rotate_convert_img_default(const aipl_image_t* input,
+                                             aipl_image_t* output,
+                                             aipl_rotation_t rotation)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    if ((rotation == AIPL_ROTATE_0 || rotation == AIPL_ROTATE_180) &&
+        (input->width != output->width || input->height != output->height))
+        return AIPL_ERR_SIZE_MISMATCH;
+
+    if ((rotation == AIPL_ROTATE_90 || rotation == AIPL_ROTATE_270) &&
+        (input->width != output->height || input->height != output->width))
+        return AIPL_ERR_SIZE_MISMATCH;
+
+    return aipl_rotate_convert_default(input->data, output->data,
+                                       input->pitch,
+                                       input->width, input->height,
+                                       input->format, output->format,
+                                       rotation);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static INLINE int32_t aipl_rotate_convert_px_size(aipl_color_format_t format)
+{
+    switch (format)
+    {
+        case AIPL_COLOR_ARGB8888:
+        case AIPL_COLOR_RGBA8888:
+            return 4;
+        case AIPL_COLOR_BGR888:
+        case AIPL_COLOR_RGB888:
+            return 3;
+        case AIPL_COLOR_RGB565:
+            return 2;
+        default:
+            return 1;
+    }
+}
+
+static INLINE void aipl_rotate_convert_load_px(aipl_argb8888_px_t* px,
+                                               const uint8_t* src,
+                                               aipl_color_format_t format)
+{
+    switch (format)
+    {
+        case AIPL_COLOR_ARGB8888:
+            *px = *(const aipl_argb8888_px_t*)src;
+            break;
+        case AIPL_COLOR_RGBA8888:
+            aipl_cnvt_px_rgba8888_to_argb8888(px,
+                                              (const aipl_rgba8888_px_t*)src);
+            break;
+        case AIPL_COLOR_BGR888:
+            aipl_cnvt_px_24bit_to_argb8888(px, src, 2, 1, 0);
+            break;
+        case AIPL_COLOR_RGB888:
+            aipl_cnvt_px_24bit_to_argb8888(px, src, 0, 1, 2);
+            break;
+        case AIPL_COLOR_RGB565:
+            aipl_cnvt_px_rgb565_to_argb8888(px, (const aipl_rgb565_px_t*)src);
+            break;
+        default:
+            aipl_cnvt_px_i400_to_argb8888(px, src);
+            break;
+    }
+}
+
+static INLINE void aipl_rotate_convert_store_px(uint8_t* dst,
+                                                const aipl_argb8888_px_t* px,
+                                                aipl_color_format_t format)
+{
+    switch (format)
+    {
+        case AIPL_COLOR_ARGB8888:
+            *(aipl_argb8888_px_t*)dst = *px;
+            break;
+        case AIPL_COLOR_RGBA8888:
+            aipl_cnvt_px_argb8888_to_rgba8888((aipl_rgba8888_px_t*)dst, px);
+            break;
+        case AIPL_COLOR_BGR888:
+            aipl_cnvt_px_argb8888_to_24bit(dst, px, 2, 1, 0);
+            break;
+        case AIPL_COLOR_RGB888:
+            aipl_cnvt_px_argb8888_to_24bit(dst, px, 0, 1, 2);
+            break;
+        default:
+            aipl_cnvt_px_argb8888_to_rgb565((aipl_rgb565_px_t*)dst, px);
+            break;
+    }
+}
+
+static INLINE void aipl_rotate_convert_store_yuv_px(uint8_t* dst,
+                                                    int32_t c, int32_t r,
+                                                    int32_t g, int32_t b,
+                                                    aipl_color_format_t format)
+{
+    switch (format)
+    {
+        case AIPL_COLOR_ARGB8888:
+            aipl_cnvt_px_yuv_to_argb8888((aipl_argb8888_px_t*)dst, c, r, g, b);
+            break;
+        case AIPL_COLOR_RGBA8888:
+            aipl_cnvt_px_yuv_to_rgba8888((aipl_rgba8888_px_t*)dst, c, r, g, b);
+            break;
+        case AIPL_COLOR_BGR888:
+            aipl_cnvt_px_yuv_to_24bit(dst, c, r, g, b, 2, 1, 0);
+            break;
+        case AIPL_COLOR_RGB888:
+            aipl_cnvt_px_yuv_to_24bit(dst, c, r, g, b, 0, 1, 2);
+            break;
+        default:
+            aipl_cnvt_px_yuv_to_rgb565((aipl_rgb565_px_t*)dst, c, r, g, b);
+            break;
+    }
+}
+
+static INLINE void aipl_rotate_convert_rgb_row(const uint8_t* src, uint8_t* dst,
+                                               int32_t width, int32_t dst_step,
+                                               aipl_color_format_t input_format,
+                                               aipl_color_format_t output_format)
+{
+    int32_t src_step = aipl_rotate_convert_px_size(input_format);
+
+    for (int32_t x = 0; x < width; ++x)
+    {
+        aipl_argb8888_px_t px;
+        aipl_rotate_convert_load_px(&px, src, input_format);
+        aipl_rotate_convert_store_px(dst, &px, output_format);
+
+        src += src_step;
+        dst += dst_step;
+    }
+}
+
+/* Expands the row loop for every output format so that
+   the per pixel format switches are resolved at compile time */
+static INLINE void aipl_rotate_convert_rgb_row_any(const uint8_t* src, uint8_t* dst,
+                                                   int32_t width, int32_t dst_step,
+                                                   aipl_color_format_t input_format,
+                                                   aipl_color_format_t output_format)
+{
+    switch (output_format)
+    {
+        case AIPL_COLOR_ARGB8888:
+            aipl_rotate_convert_rgb_row(src, dst, width, dst_step,
+                                        input_format, AIPL_COLOR_ARGB8888);
+            break;
+        case AIPL_COLOR_RGBA8888:
+            aipl_rotate_convert_rgb_row(src, dst, width, dst_step,
+                                        input_format, AIPL_COLOR_RGBA8888);
+            break;
+        case AIPL_COLOR_BGR888:
+            aipl_rotate_convert_rgb_row(src, dst, width, dst_step,
+                                        input_format, AIPL_COLOR_BGR888);
+            break;
+        case AIPL_COLOR_RGB888:
+            aipl_rotate_convert_rgb_row(src, dst, width, dst_step,
+                                        input_format, AIPL_COLOR_RGB888);
+            break;
+        default:
+            aipl_rotate_convert_rgb_row(src, dst, width, dst_step,
+                                        input_format, AIPL_COLOR_RGB565);
+            break;
+    }
+}
+
+static INLINE void aipl_rotate_convert_yuv_packed_row(const uint8_t* src, uint8_t* dst,
+                                                      int32_t width, int32_t dst_step,
+                                                      uint8_t y_offset,
+                                                      uint8_t u_offset,
+                                                      uint8_t v_offset,
+                                                      aipl_color_format_t output_format)
+{
+    int32_t x = 0;
+    for (; x + 1 < width; x += 2)
+    {
+        int32_t c0, c1;
+        int32_t r, g, b;
+
+        aipl_pre_cnvt_px_yuv_to_rgb(&r, &g, &b,
+                                    src[u_offset], src[v_offset]);
+        aipl_pre_cnvt_2px_y(&c0, &c1,
+                            src[y_offset], src[y_offset + 2]);
+
+        aipl_rotate_convert_store_yuv_px(dst, c0, r, g, b, output_format);
+        aipl_rotate_convert_store_yuv_px(dst + dst_step, c1, r, g, b,
+                                         output_format);
+
+        src += 4;
+        dst += 2 * dst_step;
+    }
+
+    if (x < width)
+    {
+        int32_t c;
+        int32_t r, g, b;
+
+        aipl_pre_cnvt_px_yuv_to_rgb(&r, &g, &b,
+                                    src[u_offset], src[v_offset]);
+        aipl_pre_cnvt_px_y(&c, src[y_offset]);
+
+        aipl_rotate_convert_store_yuv_px(dst, c, r, g, b, output_format);
+    }
+}
+
+static INLINE void aipl_rotate_convert_yuv_packed_row_any(const uint8_t* src, uint8_t* dst,
+                                                          int32_t width, int32_t dst_step,
+                                                          uint8_t y_offset,
+                                                          uint8_t u_offset,
+                                                          uint8_t v_offset,
+                                                          aipl_color_format_t output_format)
+{
+    switch (output_format)
+    {
+        case AIPL_COLOR_ARGB8888:
+            aipl_rotate_convert_yuv_packed_row(src, dst, width, dst_step,
+                                               y_offset, u_offset, v_offset,
+                                               AIPL_COLOR_ARGB8888);
+            break;
+        case AIPL_COLOR_RGBA8888:
+            aipl_rotate_convert_yuv_packed_row(src, dst, width, dst_step,
+                                               y_offset, u_offset, v_offset,
+                                               AIPL_COLOR_RGBA8888);
+            break;
+        case AIPL_COLOR_BGR888:
+            aipl_rotate_convert_yuv_packed_row(src, dst, width, dst_step,
+                                               y_offset, u_offset, v_offset,
+                                               AIPL_COLOR_BGR888);
+            break;
+        case AIPL_COLOR_RGB888:
+            aipl_rotate_convert_yuv_packed_row(src, dst, width, dst_step,
+                                               y_offset, u_offset, v_offset,
+                                               AIPL_COLOR_RGB888);
+            break;
+        default:
+            aipl_rotate_convert_yuv_packed_row(src, dst, width, dst_step,
+                                               y_offset, u_offset, v_offset,
+                                               AIPL_COLOR_RGB565);
+            break;
+    }
+}
+
+static void aipl_rotate_convert_row_argb8888(const uint8_t* src, uint8_t* dst,
+                                             int32_t width, int32_t dst_step,
+                                             aipl_color_format_t output_format)
+{
+    aipl_rotate_convert_rgb_row_any(src, dst, width, dst_step,
+                                    AIPL_COLOR_ARGB8888, output_format);
+}
+
+static void aipl_rotate_convert_row_rgba8888(const uint8_t* src, uint8_t* dst,
+                                             int32_t width, int32_t dst_step,
+                                             aipl_color_format_t output_format)
+{
+    aipl_rotate_convert_rgb_row_any(src, dst, width, dst_step,
+                                    AIPL_COLOR_RGBA8888, output_format);
+}
+
+static void aipl_rotate_convert_row_bgr888(const uint8_t* src, uint8_t* dst,
+                                           int32_t width, int32_t dst_step,
+                                           aipl_color_format_t output_format)
+{
+    aipl_rotate_convert_rgb_row_any(src, dst, width, dst_step,
+                                    AIPL_COLOR_BGR888, output_format);
+}
+
+static void aipl_rotate_convert_row_rgb888(const uint8_t* src, uint8_t* dst,
+                                           int32_t width, int32_t dst_step,
+                                           aipl_color_format_t output_format)
+{
+    aipl_rotate_convert_rgb_row_any(src, dst, width, dst_step,
+                                    AIPL_COLOR_RGB888, output_format);
+}
+
+static void aipl_rotate_convert_row_rgb565(const uint8_t* src, uint8_t* dst,
+                                           int32_t width, int32_t dst_step,
+                                           aipl_color_format_t output_format)
+{
+    aipl_rotate_convert_rgb_row_any(src, dst, width, dst_step,
+                                    AIPL_COLOR_RGB565, output_format);
+}
+
+static void aipl_rotate_convert_row_i400(const uint8_t* src, uint8_t* dst,
+                                         int32_t width, int32_t dst_step,
+                                         aipl_color_format_t output_format)
+{
+    aipl_rotate_convert_rgb_row_any(src, dst, width, dst_step,
+                                    AIPL_COLOR_I400, output_format);
+}
+
+static void aipl_rotate_convert_row_yuy2(const uint8_t* src, uint8_t* dst,
+                                         int32_t width, int32_t dst_step,
+                                         aipl_color_format_t output_format)
+{
+    aipl_rotate_convert_yuv_packed_row_any(src, dst, width, dst_step,
+                                           0, 1, 3, output_format);
+}
+
+static void aipl_rotate_convert_row_uyvy(const uint8_t* src, uint8_t* dst,
+                                         int32_t width, int32_t dst_step,
+                                         aipl_color_format_t output_format)
+{
+    aipl_rotate_convert_yuv_packed_row_any(src, dst, width, dst_step,
+                                           1, 0, 2, output_format);
+}
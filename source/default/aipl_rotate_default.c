@@ -57,7 +57,7 @@
     if (input == NULL || output == NULL)
         return AIPL_ERR_NULL_POINTER;
 
-    if (format >= AIPL_COLOR_YV12)
+    if (aipl_color_format_space(format) != AIPL_SPACE_RGB)
         return AIPL_ERR_UNSUPPORTED_FORMAT;
 
     const uint8_t* src = input;
@@ -0,0 +1,440 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/******************************************************************************
+ * @file    aipl_tensor_default.c
+ * @brief   Default neural network input tensor function implementations
+ *
+******************************************************************************/
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "aipl_tensor_default.h"
+
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+
+#include "aipl_cache.h"
+#include "aipl_utils.h"
+#include "aipl_color_conversion_generic_default.h"
+#include "aipl_demosaic_default.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/* Fractional bits of the channel multipliers and biases */
+#define AIPL_TENSOR_Q_BITS 16
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/* Tensor output state with the channel parameters folded
+   into fixed point multipliers and biases */
+typedef struct {
+    uint8_t* data;
+    uint32_t width;
+    uint32_t px_stride;     /* Elements between two pixels of a channel */
+    uint32_t ch_stride;     /* Elements between two channels of a pixel */
+    uint8_t src[3];         /* ARGB8888 byte of every output channel */
+    int32_t mult[3];
+    int32_t bias[3];        /* Mean, zero point and rounding */
+    float fmult[3];
+    float fbias[3];         /* Mean and zero point */
+} aipl_tensor_ctx_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static aipl_error_t aipl_tensor_ctx_init(aipl_tensor_ctx_t* tensor,
+                                         void* output,
+                                         uint32_t width, uint32_t height,
+                                         const aipl_tensor_params_t* params);
+
+static void aipl_tensor_sink_int8(const aipl_argb8888_px_t* px,
+                                  uint32_t x, uint32_t y,
+                                  uint32_t count,
+                                  void* ctx);
+
+static void aipl_tensor_sink_uint8(const aipl_argb8888_px_t* px,
+                                   uint32_t x, uint32_t y,
+                                   uint32_t count,
+                                   void* ctx);
+
+static void aipl_tensor_sink_float32(const aipl_argb8888_px_t* px,
+                                     uint32_t x, uint32_t y,
+                                     uint32_t count,
+                                     void* ctx);
+
+static void aipl_tensor_sink_float16(const aipl_argb8888_px_t* px,
+                                     uint32_t x, uint32_t y,
+                                     uint32_t count,
+                                     void* ctx);
+
+static uint16_t aipl_tensor_float_to_half(float f);
+
+static bool aipl_tensor_is_planar_uint8(const aipl_tensor_params_t* params);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const aipl_argb8888_sink_t aipl_tensor_sinks[] = {
+    [AIPL_TENSOR_INT8] = aipl_tensor_sink_int8,
+    [AIPL_TENSOR_UINT8] = aipl_tensor_sink_uint8,
+    [AIPL_TENSOR_FLOAT32] = aipl_tensor_sink_float32,
+    [AIPL_TENSOR_FLOAT16] = aipl_tensor_sink_float16,
+};
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+#if AIPL_CONVERT_GENERIC
+aipl_error_t aipl_tensor_convert_default(const void* input, void* output,
+                                         uint32_t pitch,
+                                         uint32_t width, uint32_t height,
+                                         aipl_color_format_t format,
+                                         const aipl_tensor_params_t* params)
+{
+    if (input == NULL || output == NULL || params == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    aipl_tensor_ctx_t tensor;
+    aipl_error_t ret = aipl_tensor_ctx_init(&tensor, output,
+                                            width, height, params);
+    if (ret != AIPL_ERR_OK)
+        return ret;
+
+    const aipl_yuv_coefs_t* coefs =
+        aipl_colorimetry_coefs(AIPL_COLORIMETRY_BT601_LIMITED);
+
+    ret = aipl_color_decode_generic_default(input, pitch, width, height,
+                                            format, coefs,
+                                            aipl_tensor_sinks[params->type],
+                                            &tensor);
+    if (ret != AIPL_ERR_OK)
+        return ret;
+
+    aipl_cpu_cache_clean(output, aipl_tensor_size(width, height, params->type));
+
+    return AIPL_ERR_OK;
+}
+#endif
+
+aipl_error_t aipl_tensor_demosaic_default(const void* input, void* output,
+                                          uint32_t pitch,
+                                          uint32_t width, uint32_t height,
+                                          aipl_bayer_filter_t filter,
+                                          const aipl_tensor_params_t* params)
+{
+    if (input == NULL || output == NULL || params == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    aipl_tensor_ctx_t tensor;
+    aipl_error_t ret = aipl_tensor_ctx_init(&tensor, output,
+                                            width, height, params);
+    if (ret != AIPL_ERR_OK)
+        return ret;
+
+    if (aipl_tensor_is_planar_uint8(params))
+    {
+        /* Unnormalized planes are written by the planar demosaic kernel */
+        uint8_t* red = output;
+        uint8_t* green = red + width * height;
+        uint8_t* blue = green + width * height;
+
+        if (params->order == AIPL_TENSOR_BGR)
+        {
+            blue = output;
+            red = blue + width * height * 2;
+        }
+
+        ret = aipl_demosaic_planar(input, red, green, blue, pitch, NULL,
+                                   width, height, filter);
+    }
+    else
+    {
+        ret = aipl_demosaic_decode_default(input, pitch, width, height,
+                                           filter,
+                                           aipl_tensor_sinks[params->type],
+                                           &tensor);
+    }
+    if (ret != AIPL_ERR_OK)
+        return ret;
+
+    aipl_cpu_cache_clean(output, aipl_tensor_size(width, height, params->type));
+
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_tensor_demosaic_bin2x2_default(const void* input,
+                                                 void* output,
+                                                 uint32_t pitch,
+                                                 uint32_t width,
+                                                 uint32_t height,
+                                                 aipl_bayer_filter_t filter,
+                                                 const aipl_tensor_params_t* params)
+{
+    if (input == NULL || output == NULL || params == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    aipl_tensor_ctx_t tensor;
+    aipl_error_t ret = aipl_tensor_ctx_init(&tensor, output,
+                                            width / 2, height / 2, params);
+    if (ret != AIPL_ERR_OK)
+        return ret;
+
+    ret = aipl_demosaic_bin2x2_decode_default(input, pitch, width, height,
+                                              filter,
+                                              aipl_tensor_sinks[params->type],
+                                              &tensor);
+    if (ret != AIPL_ERR_OK)
+        return ret;
+
+    aipl_cpu_cache_clean(output, aipl_tensor_size(width / 2, height / 2,
+                                                  params->type));
+
+    return AIPL_ERR_OK;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static aipl_error_t aipl_tensor_ctx_init(aipl_tensor_ctx_t* tensor,
+                                         void* output,
+                                         uint32_t width, uint32_t height,
+                                         const aipl_tensor_params_t* params)
+{
+    if (params->type > AIPL_TENSOR_FLOAT16
+        || params->layout > AIPL_TENSOR_CHW
+        || params->order > AIPL_TENSOR_BGR)
+        return AIPL_ERR_NOT_SUPPORTED;
+
+    tensor->data = output;
+    tensor->width = width;
+
+    if (params->layout == AIPL_TENSOR_HWC)
+    {
+        tensor->px_stride = 3;
+        tensor->ch_stride = 1;
+    }
+    else
+    {
+        tensor->px_stride = 1;
+        tensor->ch_stride = width * height;
+    }
+
+    for (uint32_t c = 0; c < 3; ++c)
+    {
+        /* Parameters are given in R, G, B order */
+        uint32_t p = params->order == AIPL_TENSOR_RGB ? c : 2 - c;
+
+        float scale = params->scale[p];
+        float offset = params->zero_point[p] - params->mean[p] * scale;
+
+        tensor->src[c] = p == 0 ? offsetof(aipl_argb8888_px_t, r)
+                         : p == 1 ? offsetof(aipl_argb8888_px_t, g)
+                         : offsetof(aipl_argb8888_px_t, b);
+        tensor->fmult[c] = scale;
+        tensor->fbias[c] = offset;
+
+        /* Floating point tensors need no fixed point parameters */
+        if (params->type >= AIPL_TENSOR_FLOAT32)
+            continue;
+
+        float bias = offset * (1 << AIPL_TENSOR_Q_BITS);
+
+        if (fabsf(scale) > AIPL_TENSOR_MAX_SCALE
+            || fabsf(bias) > (float)(1 << 30))
+            return AIPL_ERR_NOT_SUPPORTED;
+
+        tensor->mult[c] = lroundf(scale * (1 << AIPL_TENSOR_Q_BITS));
+        tensor->bias[c] = lroundf(bias) + (1 << (AIPL_TENSOR_Q_BITS - 1));
+    }
+
+    return AIPL_ERR_OK;
+}
+
+static void aipl_tensor_sink_int8(const aipl_argb8888_px_t* px,
+                                  uint32_t x, uint32_t y,
+                                  uint32_t count,
+                                  void* ctx)
+{
+    const aipl_tensor_ctx_t* tensor = ctx;
+    uint32_t step = tensor->px_stride;
+    int8_t* dst = (int8_t*)tensor->data + (y * tensor->width + x) * step;
+
+    for (uint32_t c = 0; c < 3; ++c)
+    {
+        const uint8_t* src = (const uint8_t*)px + tensor->src[c];
+        int8_t* ch = dst + c * tensor->ch_stride;
+        int32_t mult = tensor->mult[c];
+        int32_t bias = tensor->bias[c];
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            int32_t q = (src[i * sizeof(*px)] * mult + bias)
+                        >> AIPL_TENSOR_Q_BITS;
+
+            ch[i * step] = q < INT8_MIN ? INT8_MIN
+                           : q > INT8_MAX ? INT8_MAX : q;
+        }
+    }
+}
+
+static void aipl_tensor_sink_uint8(const aipl_argb8888_px_t* px,
+                                   uint32_t x, uint32_t y,
+                                   uint32_t count,
+                                   void* ctx)
+{
+    const aipl_tensor_ctx_t* tensor = ctx;
+    uint32_t step = tensor->px_stride;
+    uint8_t* dst = tensor->data + (y * tensor->width + x) * step;
+
+    for (uint32_t c = 0; c < 3; ++c)
+    {
+        const uint8_t* src = (const uint8_t*)px + tensor->src[c];
+        uint8_t* ch = dst + c * tensor->ch_stride;
+        int32_t mult = tensor->mult[c];
+        int32_t bias = tensor->bias[c];
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            int32_t q = (src[i * sizeof(*px)] * mult + bias)
+                        >> AIPL_TENSOR_Q_BITS;
+
+            ch[i * step] = q < 0 ? 0 : q > UINT8_MAX ? UINT8_MAX : q;
+        }
+    }
+}
+
+static void aipl_tensor_sink_float32(const aipl_argb8888_px_t* px,
+                                     uint32_t x, uint32_t y,
+                                     uint32_t count,
+                                     void* ctx)
+{
+    const aipl_tensor_ctx_t* tensor = ctx;
+    uint32_t step = tensor->px_stride;
+    float* dst = (float*)tensor->data + (y * tensor->width + x) * step;
+
+    for (uint32_t c = 0; c < 3; ++c)
+    {
+        const uint8_t* src = (const uint8_t*)px + tensor->src[c];
+        float* ch = dst + c * tensor->ch_stride;
+        float mult = tensor->fmult[c];
+        float bias = tensor->fbias[c];
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            ch[i * step] = src[i * sizeof(*px)] * mult + bias;
+        }
+    }
+}
+
+static void aipl_tensor_sink_float16(const aipl_argb8888_px_t* px,
+                                     uint32_t x, uint32_t y,
+                                     uint32_t count,
+                                     void* ctx)
+{
+    const aipl_tensor_ctx_t* tensor = ctx;
+    uint32_t step = tensor->px_stride;
+    uint16_t* dst = (uint16_t*)tensor->data + (y * tensor->width + x) * step;
+
+    for (uint32_t c = 0; c < 3; ++c)
+    {
+        const uint8_t* src = (const uint8_t*)px + tensor->src[c];
+        uint16_t* ch = dst + c * tensor->ch_stride;
+        float mult = tensor->fmult[c];
+        float bias = tensor->fbias[c];
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            ch[i * step] = aipl_tensor_float_to_half(src[i * sizeof(*px)]
+                                                     * mult + bias);
+        }
+    }
+}
+
+static uint16_t aipl_tensor_float_to_half(float f)
+{
+#if defined(__ARM_FP16_FORMAT_IEEE)
+    __fp16 h = f;
+    uint16_t bits;
+    memcpy(&bits, &h, sizeof(bits));
+
+    return bits;
+#else
+    uint32_t u;
+    memcpy(&u, &f, sizeof(u));
+
+    uint16_t sign = (u >> 16) & 0x8000;
+    uint32_t abs = u & 0x7fffffff;
+
+    /* Infinity and NaN */
+    if (abs >= 0x7f800000)
+        return sign | 0x7c00 | (abs > 0x7f800000 ? 0x0200 : 0);
+
+    /* Values rounding above 65504 */
+    if (abs >= 0x477ff000)
+        return sign | 0x7c00;
+
+    uint32_t h;
+    uint32_t rem;
+    uint32_t half;
+
+    if (abs >= 0x38800000)
+    {
+        /* Normal numbers, rebias the exponent */
+        h = (abs - 0x38000000) >> 13;
+        rem = abs & 0x1fff;
+        half = 0x1000;
+    }
+    else
+    {
+        /* Subnormal numbers and zero */
+        uint32_t exp = abs >> 23;
+        if (exp < 102)
+            return sign;
+
+        uint32_t shift = 126 - exp;
+        uint32_t mant = (abs & 0x7fffff) | 0x800000;
+
+        h = mant >> shift;
+        rem = mant & ((1 << shift) - 1);
+        half = 1 << (shift - 1);
+    }
+
+    /* Round to nearest even, carrying into the exponent */
+    if (rem > half || (rem == half && (h & 1)))
+        ++h;
+
+    return sign | h;
+#endif
+}
+
+static bool aipl_tensor_is_planar_uint8(const aipl_tensor_params_t* params)
+{
+    if (params->type != AIPL_TENSOR_UINT8
+        || params->layout != AIPL_TENSOR_CHW)
+        return false;
+
+    for (uint32_t c = 0; c < 3; ++c)
+    {
+        if (params->mean[c] != 0.0f || params->scale[c] != 1.0f
+            || params->zero_point[c] != 0)
+            return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,622 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/******************************************************************************
+ * @file    aipl_tiled_default.c
+ * @brief   Default tiled memory layout function implementations
+ *
+******************************************************************************/
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "aipl_tiled_default.h"
+
+#include <string.h>
+#include <stddef.h>
+
+#include "aipl_config.h"
+#include "aipl_cache.h"
+#include "aipl_utils.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/* AIPL_TILE_SIZE is (1 << AIPL_TILE_SHIFT) */
+#define AIPL_TILE_SHIFT 3
+#define AIPL_TILE_MASK (AIPL_TILE_SIZE - 1)
+#define AIPL_TILE_PIXELS (AIPL_TILE_SIZE * AIPL_TILE_SIZE)
+
+/* Resize source coordinates are in 16.16 fixed point */
+#define AIPL_TILED_FRAC_BITS 16
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/* Source samples of the output pixels of a tile along one axis */
+typedef struct {
+    int32_t i0[AIPL_TILE_SIZE];     /* Nearest or first sample */
+    int32_t i1[AIPL_TILE_SIZE];     /* Second sample */
+    uint32_t frac[AIPL_TILE_SIZE];  /* Weight of the second sample in 1/256 */
+} aipl_tiled_axis_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool aipl_tiled_check_format(aipl_color_format_t format);
+static uint32_t aipl_tiled_size(uint32_t width, uint32_t height,
+                                uint32_t bpp);
+static void aipl_tiled_transform(const uint8_t* src, uint32_t src_tiles,
+                                 uint8_t* dst,
+                                 int32_t dst_width, int32_t dst_height,
+                                 const int32_t m[6], uint32_t bpp);
+static void aipl_tiled_resize(const uint8_t* src, uint32_t src_tiles,
+                              uint32_t width, uint32_t height,
+                              uint8_t* dst,
+                              uint32_t dst_width, uint32_t dst_height,
+                              aipl_color_format_t format,
+                              bool interpolate);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+/* Number of tiles covering the size */
+#define AIPL_TILES(size) (((size) + AIPL_TILE_SIZE - 1) >> AIPL_TILE_SHIFT)
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+aipl_error_t aipl_tiled_from_linear_default(const void* input, void* output,
+                                            uint32_t pitch,
+                                            uint32_t width, uint32_t height,
+                                            aipl_color_format_t format)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    format &= ~AIPL_COLOR_TILED;
+    if (!aipl_tiled_check_format(format))
+        return AIPL_ERR_UNSUPPORTED_FORMAT;
+
+    uint32_t bpp = aipl_color_format_depth(format) / 8;
+    uint32_t tiles = AIPL_TILES(width);
+    const uint8_t* src = input;
+    uint8_t* dst = output;
+
+    for (uint32_t ty = 0; ty < height; ty += AIPL_TILE_SIZE)
+    {
+        uint32_t h = height - ty < AIPL_TILE_SIZE ? height - ty : AIPL_TILE_SIZE;
+
+        for (uint32_t tx = 0; tx < width; tx += AIPL_TILE_SIZE)
+        {
+            uint32_t w = width - tx < AIPL_TILE_SIZE ? width - tx : AIPL_TILE_SIZE;
+            uint8_t* tile = dst + ((ty >> AIPL_TILE_SHIFT) * tiles
+                                   + (tx >> AIPL_TILE_SHIFT))
+                                  * AIPL_TILE_PIXELS * bpp;
+
+            for (uint32_t r = 0; r < h; ++r)
+            {
+                memcpy(tile + r * AIPL_TILE_SIZE * bpp,
+                       src + ((ty + r) * pitch + tx) * bpp,
+                       w * bpp);
+            }
+        }
+    }
+
+    aipl_cpu_cache_clean(output, aipl_tiled_size(width, height, bpp));
+
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_tiled_from_linear_img_default(const aipl_image_t* input,
+                                                aipl_image_t* output)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    if (output->format != (input->format | AIPL_COLOR_TILED)
+        || (input->format & AIPL_COLOR_TILED))
+        return AIPL_ERR_FORMAT_MISMATCH;
+
+    if (input->width != output->width || input->height != output->height)
+        return AIPL_ERR_SIZE_MISMATCH;
+
+    return aipl_tiled_from_linear_default(input->data, output->data,
+                                          input->pitch,
+                                          input->width, input->height,
+                                          input->format);
+}
+
+aipl_error_t aipl_tiled_to_linear_default(const void* input, void* output,
+                                          uint32_t pitch,
+                                          uint32_t width, uint32_t height,
+                                          aipl_color_format_t format)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    format &= ~AIPL_COLOR_TILED;
+    if (!aipl_tiled_check_format(format))
+        return AIPL_ERR_UNSUPPORTED_FORMAT;
+
+    uint32_t bpp = aipl_color_format_depth(format) / 8;
+    uint32_t tiles = AIPL_TILES(width);
+    const uint8_t* src = input;
+    uint8_t* dst = output;
+
+    for (uint32_t ty = 0; ty < height; ty += AIPL_TILE_SIZE)
+    {
+        uint32_t h = height - ty < AIPL_TILE_SIZE ? height - ty : AIPL_TILE_SIZE;
+
+        for (uint32_t tx = 0; tx < width; tx += AIPL_TILE_SIZE)
+        {
+            uint32_t w = width - tx < AIPL_TILE_SIZE ? width - tx : AIPL_TILE_SIZE;
+            const uint8_t* tile = src + ((ty >> AIPL_TILE_SHIFT) * tiles
+                                         + (tx >> AIPL_TILE_SHIFT))
+                                        * AIPL_TILE_PIXELS * bpp;
+
+            for (uint32_t r = 0; r < h; ++r)
+            {
+                memcpy(dst + ((ty + r) * pitch + tx) * bpp,
+                       tile + r * AIPL_TILE_SIZE * bpp,
+                       w * bpp);
+            }
+        }
+    }
+
+    aipl_cpu_cache_clean(output, pitch * height * bpp);
+
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_tiled_to_linear_img_default(const aipl_image_t* input,
+                                              aipl_image_t* output)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    if (input->format != (output->format | AIPL_COLOR_TILED)
+        || (output->format & AIPL_COLOR_TILED))
+        return AIPL_ERR_FORMAT_MISMATCH;
+
+    if (input->width != output->width || input->height != output->height)
+        return AIPL_ERR_SIZE_MISMATCH;
+
+    return aipl_tiled_to_linear_default(input->data, output->data,
+                                        output->pitch,
+                                        input->width, input->height,
+                                        output->format);
+}
+
+aipl_error_t aipl_rotate_tiled_default(const void* input, void* output,
+                                       uint32_t width, uint32_t height,
+                                       aipl_color_format_t format,
+                                       aipl_rotation_t rotation)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    format &= ~AIPL_COLOR_TILED;
+    if (!aipl_tiled_check_format(format))
+        return AIPL_ERR_UNSUPPORTED_FORMAT;
+
+    /* Source coordinates of every output pixel:
+       x = m[0] * x_out + m[1] * y_out + m[2]
+       y = m[3] * x_out + m[4] * y_out + m[5] */
+    int32_t w = width;
+    int32_t h = height;
+    const int32_t rotate_90[6] = { 0, 1, 0, -1, 0, h - 1 };
+    const int32_t rotate_180[6] = { -1, 0, w - 1, 0, -1, h - 1 };
+    const int32_t rotate_270[6] = { 0, -1, w - 1, 1, 0, 0 };
+
+    const int32_t* m;
+    switch (rotation)
+    {
+        case AIPL_ROTATE_90:
+            m = rotate_90;
+            break;
+        case AIPL_ROTATE_180:
+            m = rotate_180;
+            break;
+        case AIPL_ROTATE_270:
+            m = rotate_270;
+            break;
+        default:
+            return AIPL_ERR_NOT_SUPPORTED;
+    }
+
+    bool transpose = rotation != AIPL_ROTATE_180;
+    uint32_t bpp = aipl_color_format_depth(format) / 8;
+    uint32_t output_width = transpose ? height : width;
+    uint32_t output_height = transpose ? width : height;
+
+    aipl_tiled_transform(input, AIPL_TILES(width), output,
+                         output_width, output_height, m, bpp);
+
+    aipl_cpu_cache_clean(output, aipl_tiled_size(output_width, output_height,
+                                                 bpp));
+
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_flip_tiled_default(const void* input, void* output,
+                                     uint32_t width, uint32_t height,
+                                     aipl_color_format_t format,
+                                     bool flip_horizontal, bool flip_vertical)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    format &= ~AIPL_COLOR_TILED;
+    if (!aipl_tiled_check_format(format))
+        return AIPL_ERR_UNSUPPORTED_FORMAT;
+
+    if (!flip_horizontal && !flip_vertical)
+        return AIPL_ERR_NOT_SUPPORTED;
+
+    int32_t m[6] = { 1, 0, 0, 0, 1, 0 };
+    if (flip_horizontal)
+    {
+        m[0] = -1;
+        m[2] = width - 1;
+    }
+    if (flip_vertical)
+    {
+        m[4] = -1;
+        m[5] = height - 1;
+    }
+
+    uint32_t bpp = aipl_color_format_depth(format) / 8;
+
+    aipl_tiled_transform(input, AIPL_TILES(width), output,
+                         width, height, m, bpp);
+
+    aipl_cpu_cache_clean(output, aipl_tiled_size(width, height, bpp));
+
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_resize_tiled_default(const void* input, void* output,
+                                       uint32_t width, uint32_t height,
+                                       aipl_color_format_t format,
+                                       uint32_t output_width,
+                                       uint32_t output_height,
+                                       bool interpolate)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    format &= ~AIPL_COLOR_TILED;
+    if (!aipl_tiled_check_format(format))
+        return AIPL_ERR_UNSUPPORTED_FORMAT;
+
+    if (width == 0 || height == 0)
+        return AIPL_ERR_FRAME_OUT_OF_RANGE;
+
+    aipl_tiled_resize(input, AIPL_TILES(width), width, height,
+                      output, output_width, output_height,
+                      format, interpolate);
+
+    uint32_t bpp = aipl_color_format_depth(format) / 8;
+    aipl_cpu_cache_clean(output, aipl_tiled_size(output_width, output_height,
+                                                 bpp));
+
+    return AIPL_ERR_OK;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static bool aipl_tiled_check_format(aipl_color_format_t format)
+{
+    /* Only single plane formats with whole byte pixels can be tiled */
+    return aipl_color_format_space(format) == AIPL_SPACE_RGB
+           && format != AIPL_COLOR_RGB888P;
+}
+
+static uint32_t aipl_tiled_size(uint32_t width, uint32_t height,
+                                uint32_t bpp)
+{
+    return AIPL_TILES(width) * AIPL_TILES(height) * AIPL_TILE_PIXELS * bpp;
+}
+
+static INLINE uint32_t aipl_tiled_index(int32_t x, int32_t y,
+                                        uint32_t tiles)
+{
+    return (((y >> AIPL_TILE_SHIFT) * tiles + (x >> AIPL_TILE_SHIFT))
+            << (2 * AIPL_TILE_SHIFT))
+           | ((y & AIPL_TILE_MASK) << AIPL_TILE_SHIFT)
+           | (x & AIPL_TILE_MASK);
+}
+
+static INLINE void aipl_tiled_copy_px(uint8_t* dst, const uint8_t* src,
+                                      uint32_t bpp)
+{
+    switch (bpp)
+    {
+        case 1:
+            *dst = *src;
+            break;
+        case 2:
+            *(uint16_t*)dst = *(const uint16_t*)src;
+            break;
+        case 3:
+            dst[0] = src[0];
+            dst[1] = src[1];
+            dst[2] = src[2];
+            break;
+        default:
+            *(uint32_t*)dst = *(const uint32_t*)src;
+            break;
+    }
+}
+
+static INLINE void aipl_tiled_transform_bpp(const uint8_t* src,
+                                            uint32_t src_tiles,
+                                            uint8_t* dst,
+                                            int32_t dst_width,
+                                            int32_t dst_height,
+                                            const int32_t m[6],
+                                            uint32_t bpp)
+{
+    uint32_t dst_tiles = AIPL_TILES(dst_width);
+
+    /* Every output tile is written sequentially and
+       reads from at most four input tiles */
+    for (int32_t ty = 0; ty < dst_height; ty += AIPL_TILE_SIZE)
+    {
+        int32_t h = dst_height - ty < AIPL_TILE_SIZE ? dst_height - ty
+                                                     : AIPL_TILE_SIZE;
+
+        for (int32_t tx = 0; tx < dst_width; tx += AIPL_TILE_SIZE)
+        {
+            int32_t w = dst_width - tx < AIPL_TILE_SIZE ? dst_width - tx
+                                                        : AIPL_TILE_SIZE;
+            uint8_t* tile = dst + ((ty >> AIPL_TILE_SHIFT) * dst_tiles
+                                   + (tx >> AIPL_TILE_SHIFT))
+                                  * AIPL_TILE_PIXELS * bpp;
+
+            for (int32_t r = 0; r < h; ++r)
+            {
+                int32_t y = ty + r;
+                int32_t sx = m[0] * tx + m[1] * y + m[2];
+                int32_t sy = m[3] * tx + m[4] * y + m[5];
+                uint8_t* dst_px = tile + r * AIPL_TILE_SIZE * bpp;
+
+                for (int32_t c = 0; c < w; ++c)
+                {
+                    aipl_tiled_copy_px(dst_px,
+                                       src + aipl_tiled_index(sx, sy, src_tiles)
+                                             * bpp,
+                                       bpp);
+                    dst_px += bpp;
+                    sx += m[0];
+                    sy += m[3];
+                }
+            }
+        }
+    }
+}
+
+static void aipl_tiled_transform(const uint8_t* src, uint32_t src_tiles,
+                                 uint8_t* dst,
+                                 int32_t dst_width, int32_t dst_height,
+                                 const int32_t m[6], uint32_t bpp)
+{
+    /* Constant pixel sizes let the tile loops specialize */
+    switch (bpp)
+    {
+        case 1:
+            aipl_tiled_transform_bpp(src, src_tiles, dst,
+                                     dst_width, dst_height, m, 1);
+            break;
+        case 2:
+            aipl_tiled_transform_bpp(src, src_tiles, dst,
+                                     dst_width, dst_height, m, 2);
+            break;
+        case 3:
+            aipl_tiled_transform_bpp(src, src_tiles, dst,
+                                     dst_width, dst_height, m, 3);
+            break;
+        default:
+            aipl_tiled_transform_bpp(src, src_tiles, dst,
+                                     dst_width, dst_height, m, 4);
+            break;
+    }
+}
+
+static void aipl_tiled_resize_axis(aipl_tiled_axis_t* axis,
+                                   int32_t start, int32_t count,
+                                   uint32_t src_size, uint32_t dst_size,
+                                   bool interpolate)
+{
+    int32_t last = src_size - 1;
+
+    for (int32_t i = 0; i < count; ++i)
+    {
+        /* Pixel centers are aligned: src = (dst + 0.5) * scale - 0.5 */
+        int64_t pos = ((((int64_t)(2 * (start + i) + 1) * src_size)
+                        << AIPL_TILED_FRAC_BITS) / (2 * dst_size))
+                      - (1 << (AIPL_TILED_FRAC_BITS - 1));
+
+        if (!interpolate)
+        {
+            int32_t idx = (pos + (1 << (AIPL_TILED_FRAC_BITS - 1)))
+                          >> AIPL_TILED_FRAC_BITS;
+            axis->i0[i] = idx > last ? last : idx;
+            continue;
+        }
+
+        if (pos < 0)
+            pos = 0;
+        if (pos > ((int64_t)last << AIPL_TILED_FRAC_BITS))
+            pos = (int64_t)last << AIPL_TILED_FRAC_BITS;
+
+        int32_t idx = pos >> AIPL_TILED_FRAC_BITS;
+        axis->i0[i] = idx;
+        axis->i1[i] = idx < last ? idx + 1 : idx;
+        axis->frac[i] = (pos >> (AIPL_TILED_FRAC_BITS - 8)) & 0xff;
+    }
+}
+
+static INLINE void aipl_tiled_resize_tile(const uint8_t* src,
+                                          uint32_t src_tiles,
+                                          uint8_t* tile,
+                                          const aipl_tiled_axis_t* x_axis,
+                                          int32_t w,
+                                          const aipl_tiled_axis_t* y_axis,
+                                          int32_t h,
+                                          bool interpolate,
+                                          uint32_t bpp,
+                                          aipl_color_format_t format)
+{
+    for (int32_t r = 0; r < h; ++r)
+    {
+        uint8_t* dst_px = tile + r * AIPL_TILE_SIZE * bpp;
+        int32_t y0 = y_axis->i0[r];
+
+        if (!interpolate)
+        {
+            for (int32_t c = 0; c < w; ++c)
+            {
+                aipl_tiled_copy_px(dst_px,
+                                   src + aipl_tiled_index(x_axis->i0[c], y0,
+                                                          src_tiles) * bpp,
+                                   bpp);
+                dst_px += bpp;
+            }
+            continue;
+        }
+
+        int32_t y1 = y_axis->i1[r];
+        uint32_t fy = y_axis->frac[r];
+
+        for (int32_t c = 0; c < w; ++c)
+        {
+            int32_t x0 = x_axis->i0[c];
+            int32_t x1 = x_axis->i1[c];
+            const uint8_t* p00 = src + aipl_tiled_index(x0, y0, src_tiles) * bpp;
+            const uint8_t* p01 = src + aipl_tiled_index(x1, y0, src_tiles) * bpp;
+            const uint8_t* p10 = src + aipl_tiled_index(x0, y1, src_tiles) * bpp;
+            const uint8_t* p11 = src + aipl_tiled_index(x1, y1, src_tiles) * bpp;
+
+            if (format == AIPL_COLOR_UNKNOWN)
+            {
+                aipl_bilinear_px(dst_px, p00, p01, p10, p11,
+                                 x_axis->frac[c], fy, bpp);
+            }
+            else
+            {
+                /* Packed channels are interpolated in ARGB8888 */
+                aipl_argb8888_px_t px[4];
+                aipl_argb8888_px_t res;
+                aipl_cnvt_px_16bit_to_argb8888(&px[0], p00, format);
+                aipl_cnvt_px_16bit_to_argb8888(&px[1], p01, format);
+                aipl_cnvt_px_16bit_to_argb8888(&px[2], p10, format);
+                aipl_cnvt_px_16bit_to_argb8888(&px[3], p11, format);
+
+                aipl_bilinear_px((uint8_t*)&res,
+                                 (const uint8_t*)&px[0],
+                                 (const uint8_t*)&px[1],
+                                 (const uint8_t*)&px[2],
+                                 (const uint8_t*)&px[3],
+                                 x_axis->frac[c], fy, 4);
+
+                aipl_cnvt_px_argb8888_to_16bit(dst_px, &res, format);
+            }
+
+            dst_px += bpp;
+        }
+    }
+}
+
+static void aipl_tiled_resize(const uint8_t* src, uint32_t src_tiles,
+                              uint32_t width, uint32_t height,
+                              uint8_t* dst,
+                              uint32_t dst_width, uint32_t dst_height,
+                              aipl_color_format_t format,
+                              bool interpolate)
+{
+    uint32_t bpp = aipl_color_format_depth(format) / 8;
+    uint32_t dst_tiles = AIPL_TILES(dst_width);
+
+    aipl_tiled_axis_t x_axis;
+    aipl_tiled_axis_t y_axis;
+
+    for (uint32_t ty = 0; ty < dst_height; ty += AIPL_TILE_SIZE)
+    {
+        int32_t h = dst_height - ty < AIPL_TILE_SIZE ? dst_height - ty
+                                                     : AIPL_TILE_SIZE;
+        aipl_tiled_resize_axis(&y_axis, ty, h, height, dst_height, interpolate);
+
+        for (uint32_t tx = 0; tx < dst_width; tx += AIPL_TILE_SIZE)
+        {
+            int32_t w = dst_width - tx < AIPL_TILE_SIZE ? dst_width - tx
+                                                        : AIPL_TILE_SIZE;
+            aipl_tiled_resize_axis(&x_axis, tx, w, width, dst_width,
+                                   interpolate);
+
+            uint8_t* tile = dst + ((ty >> AIPL_TILE_SHIFT) * dst_tiles
+                                   + (tx >> AIPL_TILE_SHIFT))
+                                  * AIPL_TILE_PIXELS * bpp;
+
+            /* Constant pixel sizes and formats let the tile loops specialize */
+            switch (format)
+            {
+                case AIPL_COLOR_ALPHA8:
+                    aipl_tiled_resize_tile(src, src_tiles, tile,
+                                           &x_axis, w, &y_axis, h,
+                                           interpolate, 1, AIPL_COLOR_UNKNOWN);
+                    break;
+                case AIPL_COLOR_ARGB8888:
+                case AIPL_COLOR_RGBA8888:
+                    aipl_tiled_resize_tile(src, src_tiles, tile,
+                                           &x_axis, w, &y_axis, h,
+                                           interpolate, 4, AIPL_COLOR_UNKNOWN);
+                    break;
+                case AIPL_COLOR_BGR888:
+                case AIPL_COLOR_RGB888:
+                    aipl_tiled_resize_tile(src, src_tiles, tile,
+                                           &x_axis, w, &y_axis, h,
+                                           interpolate, 3, AIPL_COLOR_UNKNOWN);
+                    break;
+                case AIPL_COLOR_ARGB4444:
+                    aipl_tiled_resize_tile(src, src_tiles, tile,
+                                           &x_axis, w, &y_axis, h,
+                                           interpolate, 2, AIPL_COLOR_ARGB4444);
+                    break;
+                case AIPL_COLOR_ARGB1555:
+                    aipl_tiled_resize_tile(src, src_tiles, tile,
+                                           &x_axis, w, &y_axis, h,
+                                           interpolate, 2, AIPL_COLOR_ARGB1555);
+                    break;
+                case AIPL_COLOR_RGBA4444:
+                    aipl_tiled_resize_tile(src, src_tiles, tile,
+                                           &x_axis, w, &y_axis, h,
+                                           interpolate, 2, AIPL_COLOR_RGBA4444);
+                    break;
+                case AIPL_COLOR_RGBA5551:
+                    aipl_tiled_resize_tile(src, src_tiles, tile,
+                                           &x_axis, w, &y_axis, h,
+                                           interpolate, 2, AIPL_COLOR_RGBA5551);
+                    break;
+                default:
+                    aipl_tiled_resize_tile(src, src_tiles, tile,
+                                           &x_axis, w, &y_axis, h,
+                                           interpolate, 2, AIPL_COLOR_RGB565);
+                    break;
+            }
+        }
+    }
+}
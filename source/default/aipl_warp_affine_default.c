@@ -0,0 +1,390 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/******************************************************************************
+ * @file    aipl_warp_affine_default.c
+ * @brief   Default affine warp function implementations
+ *
+******************************************************************************/
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "aipl_warp_affine_default.h"
+
+#include <string.h>
+#include <stddef.h>
+
+#include "aipl_config.h"
+#include "aipl_cache.h"
+#include "aipl_utils.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/* Source coordinates are walked in 16.16 fixed point */
+#define AIPL_WARP_FRAC_BITS 16
+#define AIPL_WARP_ONE (1 << AIPL_WARP_FRAC_BITS)
+#define AIPL_WARP_HALF (1 << (AIPL_WARP_FRAC_BITS - 1))
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void aipl_warp_affine_clip(int64_t a, int64_t b,
+                                  int64_t lo, int64_t hi,
+                                  int32_t* x_start, int32_t* x_end);
+static void aipl_warp_affine_row(const uint8_t* src,
+                                 int32_t src_pitch,
+                                 int32_t width, int32_t height,
+                                 uint8_t* dst, int32_t count,
+                                 int32_t u, int32_t v,
+                                 int32_t du, int32_t dv,
+                                 aipl_color_format_t format,
+                                 bool interpolate);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+aipl_error_t aipl_warp_affine_default(const void* input, void* output,
+                                      uint32_t pitch,
+                                      uint32_t width, uint32_t height,
+                                      aipl_color_format_t format,
+                                      uint32_t output_width,
+                                      uint32_t output_height,
+                                      const float matrix[6],
+                                      bool interpolate)
+{
+    if (input == NULL || output == NULL || matrix == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    if (aipl_color_format_space(format) != AIPL_SPACE_RGB
+        || format == AIPL_COLOR_RGB888P)
+        return AIPL_ERR_UNSUPPORTED_FORMAT;
+
+    uint32_t bpp = aipl_color_format_depth(format) / 8;
+
+    /* Convert the matrix to fixed point once */
+    int32_t m[6];
+    for (int i = 0; i < 6; ++i)
+    {
+        float val = matrix[i] * AIPL_WARP_ONE;
+        m[i] = (int32_t)(val < 0 ? val - 0.5f : val + 0.5f);
+    }
+
+    /* Source coordinate range that can be sampled without bounds checks */
+    int64_t lo = interpolate ? 0 : -AIPL_WARP_HALF;
+    int64_t u_hi = interpolate ? (int64_t)(width - 1) << AIPL_WARP_FRAC_BITS
+                               : ((int64_t)width << AIPL_WARP_FRAC_BITS)
+                                 - AIPL_WARP_HALF - 1;
+    int64_t v_hi = interpolate ? (int64_t)(height - 1) << AIPL_WARP_FRAC_BITS
+                               : ((int64_t)height << AIPL_WARP_FRAC_BITS)
+                                 - AIPL_WARP_HALF - 1;
+
+    const uint8_t* src = input;
+    uint8_t* dst = output;
+
+    for (int32_t y = 0; y < (int32_t)output_height; ++y)
+    {
+        int64_t u = (int64_t)m[1] * y + m[2];
+        int64_t v = (int64_t)m[4] * y + m[5];
+
+        /* Clip the row to the pixels that map inside the input */
+        int32_t x_start = 0;
+        int32_t x_end = output_width;
+        aipl_warp_affine_clip(u, m[0], lo, u_hi, &x_start, &x_end);
+        aipl_warp_affine_clip(v, m[3], lo, v_hi, &x_start, &x_end);
+
+        if (x_end <= x_start)
+        {
+            memset(dst, 0, output_width * bpp);
+        }
+        else
+        {
+            memset(dst, 0, x_start * bpp);
+
+            aipl_warp_affine_row(src, pitch * bpp, width, height,
+                                 dst + x_start * bpp, x_end - x_start,
+                                 (int32_t)(u + (int64_t)m[0] * x_start),
+                                 (int32_t)(v + (int64_t)m[3] * x_start),
+                                 m[0], m[3],
+                                 format, interpolate);
+
+            memset(dst + x_end * bpp, 0, (output_width - x_end) * bpp);
+        }
+
+        dst += output_width * bpp;
+    }
+
+    aipl_cpu_cache_clean(output, output_width * output_height * bpp);
+
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_warp_affine_img_default(const aipl_image_t* input,
+                                          aipl_image_t* output,
+                                          const float matrix[6],
+                                          bool interpolate)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    if (output->format != input->format)
+        return AIPL_ERR_FORMAT_MISMATCH;
+
+    return aipl_warp_affine_default(input->data, output->data,
+                                    input->pitch,
+                                    input->width, input->height,
+                                    input->format,
+                                    output->width, output->height,
+                                    matrix, interpolate);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static INLINE int64_t aipl_warp_affine_div_floor(int64_t n, int64_t d)
+{
+    int64_t q = n / d;
+    if ((n % d != 0) && ((n < 0) != (d < 0)))
+        --q;
+
+    return q;
+}
+
+static void aipl_warp_affine_clip(int64_t a, int64_t b,
+                                  int64_t lo, int64_t hi,
+                                  int32_t* x_start, int32_t* x_end)
+{
+    int64_t first;
+    int64_t last;
+
+    if (b == 0)
+    {
+        if (a < lo || a > hi)
+            *x_end = *x_start;
+        return;
+    }
+
+    /* lo <= a + b * x <= hi */
+    if (b > 0)
+    {
+        first = -aipl_warp_affine_div_floor(a - lo, b);
+        last = aipl_warp_affine_div_floor(hi - a, b);
+    }
+    else
+    {
+        first = -aipl_warp_affine_div_floor(hi - a, -b);
+        last = aipl_warp_affine_div_floor(a - lo, -b);
+    }
+
+    if (first > *x_start)
+        *x_start = first > *x_end ? *x_end : (int32_t)first;
+    if (last + 1 < *x_end)
+        *x_end = last + 1 < *x_start ? *x_start : (int32_t)(last + 1);
+}
+
+static INLINE void aipl_warp_affine_nearest_row(const uint8_t* src,
+                                                int32_t src_pitch,
+                                                uint8_t* dst, int32_t count,
+                                                int32_t u, int32_t v,
+                                                int32_t du, int32_t dv,
+                                                uint32_t bpp)
+{
+    for (int32_t x = 0; x < count; ++x)
+    {
+        int32_t xi = (u + AIPL_WARP_HALF) >> AIPL_WARP_FRAC_BITS;
+        int32_t yi = (v + AIPL_WARP_HALF) >> AIPL_WARP_FRAC_BITS;
+        const uint8_t* px = src + yi * src_pitch + xi * (int32_t)bpp;
+
+        switch (bpp)
+        {
+            case 1:
+                *dst = *px;
+                break;
+            case 2:
+                *(uint16_t*)dst = *(const uint16_t*)px;
+                break;
+            case 3:
+                dst[0] = px[0];
+                dst[1] = px[1];
+                dst[2] = px[2];
+                break;
+            default:
+                *(uint32_t*)dst = *(const uint32_t*)px;
+                break;
+        }
+
+        dst += bpp;
+        u += du;
+        v += dv;
+    }
+}
+
+static INLINE void aipl_warp_affine_bilinear_row(const uint8_t* src,
+                                                 int32_t src_pitch,
+                                                 int32_t width, int32_t height,
+                                                 uint8_t* dst, int32_t count,
+                                                 int32_t u, int32_t v,
+                                                 int32_t du, int32_t dv,
+                                                 uint32_t bpp)
+{
+    for (int32_t x = 0; x < count; ++x)
+    {
+        int32_t xi = u >> AIPL_WARP_FRAC_BITS;
+        int32_t yi = v >> AIPL_WARP_FRAC_BITS;
+        uint32_t fx = (u >> (AIPL_WARP_FRAC_BITS - 8)) & 0xff;
+        uint32_t fy = (v >> (AIPL_WARP_FRAC_BITS - 8)) & 0xff;
+
+        /* Neighbours past the last row or column have zero weight */
+        int32_t x_step = xi < width - 1 ? (int32_t)bpp : 0;
+        int32_t y_step = yi < height - 1 ? src_pitch : 0;
+
+        const uint8_t* p00 = src + yi * src_pitch + xi * (int32_t)bpp;
+        aipl_bilinear_px(dst, p00, p00 + x_step,
+                         p00 + y_step, p00 + y_step + x_step,
+                         fx, fy, bpp);
+
+        dst += bpp;
+        u += du;
+        v += dv;
+    }
+}
+
+static INLINE void aipl_warp_affine_bilinear_16bit_row(const uint8_t* src,
+                                                       int32_t src_pitch,
+                                                       int32_t width, int32_t height,
+                                                       uint8_t* dst, int32_t count,
+                                                       int32_t u, int32_t v,
+                                                       int32_t du, int32_t dv,
+                                                       aipl_color_format_t format)
+{
+    for (int32_t x = 0; x < count; ++x)
+    {
+        int32_t xi = u >> AIPL_WARP_FRAC_BITS;
+        int32_t yi = v >> AIPL_WARP_FRAC_BITS;
+        uint32_t fx = (u >> (AIPL_WARP_FRAC_BITS - 8)) & 0xff;
+        uint32_t fy = (v >> (AIPL_WARP_FRAC_BITS - 8)) & 0xff;
+
+        int32_t x_step = xi < width - 1 ? 2 : 0;
+        int32_t y_step = yi < height - 1 ? src_pitch : 0;
+
+        /* Packed channels are interpolated in ARGB8888 */
+        const uint8_t* p00 = src + yi * src_pitch + xi * 2;
+        aipl_argb8888_px_t px[4];
+        aipl_argb8888_px_t res;
+        aipl_cnvt_px_16bit_to_argb8888(&px[0], p00, format);
+        aipl_cnvt_px_16bit_to_argb8888(&px[1], p00 + x_step, format);
+        aipl_cnvt_px_16bit_to_argb8888(&px[2], p00 + y_step, format);
+        aipl_cnvt_px_16bit_to_argb8888(&px[3], p00 + y_step + x_step, format);
+
+        aipl_bilinear_px((uint8_t*)&res,
+                         (const uint8_t*)&px[0],
+                         (const uint8_t*)&px[1],
+                         (const uint8_t*)&px[2],
+                         (const uint8_t*)&px[3],
+                         fx, fy, 4);
+
+        aipl_cnvt_px_argb8888_to_16bit(dst, &res, format);
+
+        dst += 2;
+        u += du;
+        v += dv;
+    }
+}
+
+static void aipl_warp_affine_row(const uint8_t* src,
+                                 int32_t src_pitch,
+                                 int32_t width, int32_t height,
+                                 uint8_t* dst, int32_t count,
+                                 int32_t u, int32_t v,
+                                 int32_t du, int32_t dv,
+                                 aipl_color_format_t format,
+                                 bool interpolate)
+{
+    /* Constant pixel sizes and formats let the row loops specialize */
+    if (!interpolate)
+    {
+        switch (aipl_color_format_depth(format))
+        {
+            case 8:
+                aipl_warp_affine_nearest_row(src, src_pitch, dst, count,
+                                             u, v, du, dv, 1);
+                break;
+            case 16:
+                aipl_warp_affine_nearest_row(src, src_pitch, dst, count,
+                                             u, v, du, dv, 2);
+                break;
+            case 24:
+                aipl_warp_affine_nearest_row(src, src_pitch, dst, count,
+                                             u, v, du, dv, 3);
+                break;
+            default:
+                aipl_warp_affine_nearest_row(src, src_pitch, dst, count,
+                                             u, v, du, dv, 4);
+                break;
+        }
+        return;
+    }
+
+    switch (format)
+    {
+        case AIPL_COLOR_ALPHA8:
+            aipl_warp_affine_bilinear_row(src, src_pitch, width, height,
+                                          dst, count, u, v, du, dv, 1);
+            break;
+        case AIPL_COLOR_ARGB8888:
+        case AIPL_COLOR_RGBA8888:
+            aipl_warp_affine_bilinear_row(src, src_pitch, width, height,
+                                          dst, count, u, v, du, dv, 4);
+            break;
+        case AIPL_COLOR_BGR888:
+        case AIPL_COLOR_RGB888:
+            aipl_warp_affine_bilinear_row(src, src_pitch, width, height,
+                                          dst, count, u, v, du, dv, 3);
+            break;
+        case AIPL_COLOR_ARGB4444:
+            aipl_warp_affine_bilinear_16bit_row(src, src_pitch, width, height,
+                                                dst, count, u, v, du, dv,
+                                                AIPL_COLOR_ARGB4444);
+            break;
+        case AIPL_COLOR_ARGB1555:
+            aipl_warp_affine_bilinear_16bit_row(src, src_pitch, width, height,
+                                                dst, count, u, v, du, dv,
+                                                AIPL_COLOR_ARGB1555);
+            break;
+        case AIPL_COLOR_RGBA4444:
+            aipl_warp_affine_bilinear_16bit_row(src, src_pitch, width, height,
+                                                dst, count, u, v, du, dv,
+                                                AIPL_COLOR_RGBA4444);
+            break;
+        case AIPL_COLOR_RGBA5551:
+            aipl_warp_affine_bilinear_16bit_row(src, src_pitch, width, height,
+                                                dst, count, u, v, du, dv,
+                                                AIPL_COLOR_RGBA5551);
+            break;
+        default:
+            aipl_warp_affine_bilinear_16bit_row(src, src_pitch, width, height,
+                                                dst, count, u, v, du, dv,
+                                                AIPL_COLOR_RGB565);
+            break;
+    }
+}
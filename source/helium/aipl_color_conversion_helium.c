@@ -787,6 +787,19 @@ static aipl_error_t aipl_color_convert_alpha8_to_yuv_packed_helium(const uint8_t
                                                             uint32_t width,
                                                             uint32_t height);
 #endif
+static void aipl_color_convert_argb8888_to_yuv_coefs_helium(const void* input,
+                                                            uint32_t pitch,
+                                                            uint32_t width,
+                                                            uint32_t height,
+                                                            uint8_t* y,
+                                                            uint8_t* u,
+                                                            uint8_t* v,
+                                                            uint32_t y_step,
+                                                            uint32_t uv_step,
+                                                            uint32_t uv_pitch,
+                                                            uint32_t x_shift,
+                                                            uint32_t y_shift,
+                                                            const aipl_yuv_coefs_t* coefs);
 
 /**********************
  *  STATIC VARIABLES
@@ -1630,8 +1643,8 @@ aipl_error_t aipl_color_convert_argb8888_to_i422_helium(const void* input,
         }
 
         src = src_ptr + i * pitch * 4;
-        uint8_t* u_dst = u_ptr + i * width / 2;
-        uint8_t* v_dst = v_ptr + i * width / 2;
+        uint8_t* u_dst = u_ptr + i * (width / 2);
+        uint8_t* v_dst = v_ptr + i * (width / 2);
 
         for (int32_t cnt = width / 2; cnt > 0; cnt -= 8)
         {
@@ -2200,8 +2213,8 @@ aipl_error_t aipl_color_convert_argb4444_to_i422_helium(const void* input,
         }
 
         src = src_ptr + i * pitch;
-        uint8_t* u_dst = u_ptr + i * width / 2;
-        uint8_t* v_dst = v_ptr + i * width / 2;
+        uint8_t* u_dst = u_ptr + i * (width / 2);
+        uint8_t* v_dst = v_ptr + i * (width / 2);
 
         for (int32_t cnt = width / 2; cnt > 0; cnt -= 8)
         {
@@ -2698,8 +2711,8 @@ aipl_error_t aipl_color_convert_argb1555_to_i422_helium(const void* input,
         }
 
         src = src_ptr + i * pitch;
-        uint8_t* u_dst = u_ptr + i * width / 2;
-        uint8_t* v_dst = v_ptr + i * width / 2;
+        uint8_t* u_dst = u_ptr + i * (width / 2);
+        uint8_t* v_dst = v_ptr + i * (width / 2);
 
         for (int32_t cnt = width / 2; cnt > 0; cnt -= 8)
         {
@@ -3398,8 +3411,8 @@ aipl_error_t aipl_color_convert_rgba8888_to_i422_helium(const void* input,
         }
 
         src = src_ptr + i * pitch * 4;
-        uint8_t* u_dst = u_ptr + i * width / 2;
-        uint8_t* v_dst = v_ptr + i * width / 2;
+        uint8_t* u_dst = u_ptr + i * (width / 2);
+        uint8_t* v_dst = v_ptr + i * (width / 2);
 
         for (int32_t cnt = width / 2; cnt > 0; cnt -= 8)
         {
@@ -3968,8 +3981,8 @@ aipl_error_t aipl_color_convert_rgba4444_to_i422_helium(const void* input,
         }
 
         src = src_ptr + i * pitch;
-        uint8_t* u_dst = u_ptr + i * width / 2;
-        uint8_t* v_dst = v_ptr + i * width / 2;
+        uint8_t* u_dst = u_ptr + i * (width / 2);
+        uint8_t* v_dst = v_ptr + i * (width / 2);
 
         for (int32_t cnt = width / 2; cnt > 0; cnt -= 8)
         {
@@ -4465,8 +4478,8 @@ aipl_error_t aipl_color_convert_rgba5551_to_i422_helium(const void* input,
         }
 
         src = src_ptr + i * pitch;
-        uint8_t* u_dst = u_ptr + i * width / 2;
-        uint8_t* v_dst = v_ptr + i * width / 2;
+        uint8_t* u_dst = u_ptr + i * (width / 2);
+        uint8_t* v_dst = v_ptr + i * (width / 2);
 
         for (int32_t cnt = width / 2; cnt > 0; cnt -= 8)
         {
@@ -5763,8 +5776,8 @@ aipl_error_t aipl_color_convert_rgb565_to_i422_helium(const void* input,
         }
 
         src = src_ptr + i * pitch;
-        uint8_t* u_dst = u_ptr + i * width / 2;
-        uint8_t* v_dst = v_ptr + i * width / 2;
+        uint8_t* u_dst = u_ptr + i * (width / 2);
+        uint8_t* v_dst = v_ptr + i * (width / 2);
 
         for (int32_t cnt = width / 2; cnt > 0; cnt -= 8)
         {
@@ -6207,9 +6220,9 @@ aipl_error_t aipl_color_convert_yv12_to_i444_helium(const void* input,
     {
         const uint8_t* y_src = y_src_ptr + i * pitch;
         uint8_t* y_dst = y_dst_ptr + i * width;
-        const uint8_t* u_src = u_src_ptr + i / 2 * pitch / 2;
+        const uint8_t* u_src = u_src_ptr + i / 2 * (pitch / 2);
         uint8_t* u_dst = u_dst_ptr + i * width;
-        const uint8_t* v_src = v_src_ptr + i / 2 * pitch / 2;
+        const uint8_t* v_src = v_src_ptr + i / 2 * (pitch / 2);
         uint8_t* v_dst = v_dst_ptr + i * width;
 
         memcpy(y_dst, y_src, width);
@@ -6579,9 +6592,9 @@ aipl_error_t aipl_color_convert_i420_to_i444_helium(const void* input,
     {
         const uint8_t* y_src = y_src_ptr + i * pitch;
         uint8_t* y_dst = y_dst_ptr + i * width;
-        const uint8_t* u_src = u_src_ptr + i / 2 * pitch / 2;
+        const uint8_t* u_src = u_src_ptr + i / 2 * (pitch / 2);
         uint8_t* u_dst = u_dst_ptr + i * width;
-        const uint8_t* v_src = v_src_ptr + i / 2 * pitch / 2;
+        const uint8_t* v_src = v_src_ptr + i / 2 * (pitch / 2);
         uint8_t* v_dst = v_dst_ptr + i * width;
 
         memcpy(y_dst, y_src, width);
@@ -6793,8 +6806,8 @@ aipl_error_t aipl_color_convert_i422_to_argb8888_helium(const void* input,
     for (uint32_t i = 0; i < height; ++i)
     {
         const uint8_t* y_src = y_ptr + i * pitch;
-        const uint8_t* u_src = u_ptr + i * pitch / 2;
-        const uint8_t* v_src = v_ptr + i * pitch / 2;
+        const uint8_t* u_src = u_ptr + i * (pitch / 2);
+        const uint8_t* v_src = v_ptr + i * (pitch / 2);
         uint32_t* dst = dst_ptr + i * width;
 
         for (int32_t cnt = width / 2; cnt > 0; cnt -= 4)
@@ -6849,8 +6862,8 @@ aipl_error_t aipl_color_convert_i422_to_argb4444_helium(const void* input,
     for (uint32_t i = 0; i < height; ++i)
     {
         const uint8_t* y_src = y_ptr + i * pitch;
-        const uint8_t* u_src = u_ptr + i * pitch / 2;
-        const uint8_t* v_src = v_ptr + i * pitch / 2;
+        const uint8_t* u_src = u_ptr + i * (pitch / 2);
+        const uint8_t* v_src = v_ptr + i * (pitch / 2);
         uint16_t* dst = dst_ptr + i * width;
 
         for (int32_t cnt = width / 2; cnt > 0; cnt -= 4)
@@ -6903,8 +6916,8 @@ aipl_error_t aipl_color_convert_i422_to_argb1555_helium(const void* input,
     for (uint32_t i = 0; i < height; ++i)
     {
         const uint8_t* y_src = y_ptr + i * pitch;
-        const uint8_t* u_src = u_ptr + i * pitch / 2;
-        const uint8_t* v_src = v_ptr + i * pitch / 2;
+        const uint8_t* u_src = u_ptr + i * (pitch / 2);
+        const uint8_t* v_src = v_ptr + i * (pitch / 2);
         uint16_t* dst = dst_ptr + i * width;
 
         for (int32_t cnt = width / 2; cnt > 0; cnt -= 4)
@@ -6957,8 +6970,8 @@ aipl_error_t aipl_color_convert_i422_to_rgba8888_helium(const void* input,
     for (uint32_t i = 0; i < height; ++i)
     {
         const uint8_t* y_src = y_ptr + i * pitch;
-        const uint8_t* u_src = u_ptr + i * pitch / 2;
-        const uint8_t* v_src = v_ptr + i * pitch / 2;
+        const uint8_t* u_src = u_ptr + i * (pitch / 2);
+        const uint8_t* v_src = v_ptr + i * (pitch / 2);
         uint32_t* dst = dst_ptr + i * width;
 
         for (int32_t cnt = width / 2; cnt > 0; cnt -= 4)
@@ -7013,8 +7026,8 @@ aipl_error_t aipl_color_convert_i422_to_rgba4444_helium(const void* input,
     for (uint32_t i = 0; i < height; ++i)
     {
         const uint8_t* y_src = y_ptr + i * pitch;
-        const uint8_t* u_src = u_ptr + i * pitch / 2;
-        const uint8_t* v_src = v_ptr + i * pitch / 2;
+        const uint8_t* u_src = u_ptr + i * (pitch / 2);
+        const uint8_t* v_src = v_ptr + i * (pitch / 2);
         uint16_t* dst = dst_ptr + i * width;
 
         for (int32_t cnt = width / 2; cnt > 0; cnt -= 4)
@@ -7067,8 +7080,8 @@ aipl_error_t aipl_color_convert_i422_to_rgba5551_helium(const void* input,
     for (uint32_t i = 0; i < height; ++i)
     {
         const uint8_t* y_src = y_ptr + i * pitch;
-        const uint8_t* u_src = u_ptr + i * pitch / 2;
-        const uint8_t* v_src = v_ptr + i * pitch / 2;
+        const uint8_t* u_src = u_ptr + i * (pitch / 2);
+        const uint8_t* v_src = v_ptr + i * (pitch / 2);
         uint16_t* dst = dst_ptr + i * width;
 
         for (int32_t cnt = width / 2; cnt > 0; cnt -= 4)
@@ -7147,8 +7160,8 @@ aipl_error_t aipl_color_convert_i422_to_rgb565_helium(const void* input,
     for (uint32_t i = 0; i < height; ++i)
     {
         const uint8_t* y_src = y_ptr + i * pitch;
-        const uint8_t* u_src = u_ptr + i * pitch / 2;
-        const uint8_t* v_src = v_ptr + i * pitch / 2;
+        const uint8_t* u_src = u_ptr + i * (pitch / 2);
+        const uint8_t* v_src = v_ptr + i * (pitch / 2);
         uint16_t* dst = dst_ptr + i * width;
 
         for (int32_t cnt = width / 2; cnt > 0; cnt -= 4)
@@ -7208,12 +7221,12 @@ aipl_error_t aipl_color_convert_i422_to_yv12_helium(const void* input,
 
         memcpy(y_dst, y_src, width);
 
-        if (!(i & 1))
+        if (!(i & 1) && i + 1 < height)
         {
-            const uint8_t* u_src = u_src_ptr + i * pitch / 2;
-            uint8_t* u_dst = u_dst_ptr + i * width / 4;
-            const uint8_t* v_src = v_src_ptr + i * pitch / 2;
-            uint8_t* v_dst = v_dst_ptr + i * width / 4;
+            const uint8_t* u_src = u_src_ptr + i * (pitch / 2);
+            uint8_t* u_dst = u_dst_ptr + i / 2 * (width / 2);
+            const uint8_t* v_src = v_src_ptr + i * (pitch / 2);
+            uint8_t* v_dst = v_dst_ptr + i / 2 * (width / 2);
 
             memcpy(u_dst, u_src, width / 2);
             memcpy(v_dst, v_src, width / 2);
@@ -7251,12 +7264,12 @@ aipl_error_t aipl_color_convert_i422_to_i420_helium(const void* input,
 
         memcpy(y_dst, y_src, width);
 
-        if (!(i & 1))
+        if (!(i & 1) && i + 1 < height)
         {
-            const uint8_t* u_src = u_src_ptr + i * pitch / 2;
-            uint8_t* u_dst = u_dst_ptr + i * width / 4;
-            const uint8_t* v_src = v_src_ptr + i * pitch / 2;
-            uint8_t* v_dst = v_dst_ptr + i * width / 4;
+            const uint8_t* u_src = u_src_ptr + i * (pitch / 2);
+            uint8_t* u_dst = u_dst_ptr + i / 2 * (width / 2);
+            const uint8_t* v_src = v_src_ptr + i * (pitch / 2);
+            uint8_t* v_dst = v_dst_ptr + i / 2 * (width / 2);
 
             memcpy(u_dst, u_src, width / 2);
             memcpy(v_dst, v_src, width / 2);
@@ -7291,9 +7304,9 @@ aipl_error_t aipl_color_convert_i422_to_i444_helium(const void* input,
     {
         const uint8_t* y_src = y_src_ptr + i * pitch;
         uint8_t* y_dst = y_dst_ptr + i * width;
-        const uint8_t* u_src = u_src_ptr + i * pitch / 2;
+        const uint8_t* u_src = u_src_ptr + i * (pitch / 2);
         uint8_t* u_dst = u_dst_ptr + i * width;
-        const uint8_t* v_src = v_src_ptr + i * pitch / 2;
+        const uint8_t* v_src = v_src_ptr + i * (pitch / 2);
         uint8_t* v_dst = v_dst_ptr + i * width;
 
         memcpy(y_dst, y_src, width);
@@ -7351,11 +7364,11 @@ aipl_error_t aipl_color_convert_i422_to_nv21_helium(const void* input,
 
         memcpy(y_dst, y_src, width);
 
-        if (!(i & 1))
+        if (!(i & 1) && i + 1 < height)
         {
-            const uint8_t* u_src = u_src_ptr + i * pitch / 2;
+            const uint8_t* u_src = u_src_ptr + i * (pitch / 2);
             uint8_t* u_dst = u_dst_ptr + i / 2 * width;
-            const uint8_t* v_src = v_src_ptr + i * pitch / 2;
+            const uint8_t* v_src = v_src_ptr + i * (pitch / 2);
             uint8_t* v_dst = v_dst_ptr + i / 2 * width;
 
             for (int32_t cnt = width / 2; cnt > 0; cnt -= 16)
@@ -7409,11 +7422,11 @@ aipl_error_t aipl_color_convert_i422_to_nv12_helium(const void* input,
 
         memcpy(y_dst, y_src, width);
 
-        if (!(i & 1))
+        if (!(i & 1) && i + 1 < height)
         {
-            const uint8_t* u_src = u_src_ptr + i * pitch / 2;
+            const uint8_t* u_src = u_src_ptr + i * (pitch / 2);
             uint8_t* u_dst = u_dst_ptr + i / 2 * width;
-            const uint8_t* v_src = v_src_ptr + i * pitch / 2;
+            const uint8_t* v_src = v_src_ptr + i * (pitch / 2);
             uint8_t* v_dst = v_dst_ptr + i / 2 * width;
 
             for (int32_t cnt = width / 2; cnt > 0; cnt -= 16)
@@ -7986,12 +7999,12 @@ aipl_error_t aipl_color_convert_i444_to_yv12_helium(const void* input,
 
         memcpy(y_dst, y_src, width);
 
-        if (!(i & 1))
+        if (!(i & 1) && i + 1 < height)
         {
             const uint8_t* u_src = u_src_ptr + i * pitch;
-            uint8_t* u_dst = u_dst_ptr + i * width / 4;
+            uint8_t* u_dst = u_dst_ptr + i / 2 * (width / 2);
             const uint8_t* v_src = v_src_ptr + i * pitch;
-            uint8_t* v_dst = v_dst_ptr + i * width / 4;
+            uint8_t* v_dst = v_dst_ptr + i / 2 * (width / 2);
 
             int32_t cnt = width / 2;
             while (cnt > 0)
@@ -8046,12 +8059,12 @@ aipl_error_t aipl_color_convert_i444_to_i420_helium(const void* input,
 
         memcpy(y_dst, y_src, width);
 
-        if (!(i & 1))
+        if (!(i & 1) && i + 1 < height)
         {
             const uint8_t* u_src = u_src_ptr + i * pitch;
-            uint8_t* u_dst = u_dst_ptr + i * width / 4;
+            uint8_t* u_dst = u_dst_ptr + i / 2 * (width / 2);
             const uint8_t* v_src = v_src_ptr + i * pitch;
-            uint8_t* v_dst = v_dst_ptr + i * width / 4;
+            uint8_t* v_dst = v_dst_ptr + i / 2 * (width / 2);
 
             int32_t cnt = width / 2;
             while (cnt > 0)
@@ -8104,9 +8117,9 @@ aipl_error_t aipl_color_convert_i444_to_i422_helium(const void* input,
         const uint8_t* y_src = y_src_ptr + i * pitch;
         uint8_t* y_dst = y_dst_ptr + i * width;
         const uint8_t* u_src = u_src_ptr + i * pitch;
-        uint8_t* u_dst = u_dst_ptr + i * width / 2;
+        uint8_t* u_dst = u_dst_ptr + i * (width / 2);
         const uint8_t* v_src = v_src_ptr + i * pitch;
-        uint8_t* v_dst = v_dst_ptr + i * width / 2;
+        uint8_t* v_dst = v_dst_ptr + i * (width / 2);
 
         memcpy(y_dst, y_src, width);
 
@@ -8163,7 +8176,7 @@ aipl_error_t aipl_color_convert_i444_to_nv21_helium(const void* input,
 
         memcpy(y_dst, y_src, width);
 
-        if (!(i & 1))
+        if (!(i & 1) && i + 1 < height)
         {
             const uint8_t* u_src = u_src_ptr + i * pitch;
             uint8_t* u_dst = u_dst_ptr + i / 2 * width;
@@ -8209,7 +8222,7 @@ aipl_error_t aipl_color_convert_i444_to_nv12_helium(const void* input,
 
         memcpy(y_dst, y_src, width);
 
-        if (!(i & 1))
+        if (!(i & 1) && i + 1 < height)
         {
             const uint8_t* u_src = u_src_ptr + i * pitch;
             uint8_t* u_dst = u_dst_ptr + i / 2 * width;
@@ -8558,9 +8571,9 @@ aipl_error_t aipl_color_convert_nv12_to_i422_helium(const void* input,
         const uint8_t* y_src = y_src_ptr + i * pitch;
         uint8_t* y_dst = y_dst_ptr + i * width;
         const uint8_t* u_src = u_src_ptr + i / 2 * pitch;
-        uint8_t* u_dst = u_dst_ptr + i * width / 2;
+        uint8_t* u_dst = u_dst_ptr + i * (width / 2);
         const uint8_t* v_src = v_src_ptr + i / 2 * pitch;
-        uint8_t* v_dst = v_dst_ptr + i * width / 2;
+        uint8_t* v_dst = v_dst_ptr + i * (width / 2);
 
         memcpy(y_dst, y_src, width);
 
@@ -8922,9 +8935,9 @@ aipl_error_t aipl_color_convert_nv21_to_i422_helium(const void* input,
         const uint8_t* y_src = y_src_ptr + i * pitch;
         uint8_t* y_dst = y_dst_ptr + i * width;
         const uint8_t* u_src = u_src_ptr + i / 2 * pitch;
-        uint8_t* u_dst = u_dst_ptr + i * width / 2;
+        uint8_t* u_dst = u_dst_ptr + i * (width / 2);
         const uint8_t* v_src = v_src_ptr + i / 2 * pitch;
-        uint8_t* v_dst = v_dst_ptr + i * width / 2;
+        uint8_t* v_dst = v_dst_ptr + i * (width / 2);
 
         memcpy(y_dst, y_src, width);
 
@@ -9330,9 +9343,9 @@ aipl_error_t aipl_color_convert_yuy2_to_i422_helium(const void* input,
         }
 
         const uint8_t* u_src = u_src_ptr + i * pitch * 2;
-        uint8_t* u_dst = u_dst_ptr + i * width / 2;
+        uint8_t* u_dst = u_dst_ptr + i * (width / 2);
         const uint8_t* v_src = v_src_ptr + i * pitch * 2;
-        uint8_t* v_dst = v_dst_ptr + i * width / 2;
+        uint8_t* v_dst = v_dst_ptr + i * (width / 2);
 
         cnt = width / 2;
         while (cnt > 0)
@@ -9860,9 +9873,9 @@ aipl_error_t aipl_color_convert_uyvy_to_i422_helium(const void* input,
         }
 
         const uint8_t* u_src = u_src_ptr + i * pitch * 2;
-        uint8_t* u_dst = u_dst_ptr + i * width / 2;
+        uint8_t* u_dst = u_dst_ptr + i * (width / 2);
         const uint8_t* v_src = v_src_ptr + i * pitch * 2;
-        uint8_t* v_dst = v_dst_ptr + i * width / 2;
+        uint8_t* v_dst = v_dst_ptr + i * (width / 2);
 
         cnt = width / 2;
         while (cnt > 0)
@@ -11328,8 +11341,8 @@ static aipl_error_t aipl_color_convert_24bit_to_i422_helium(const void* input,
         }
 
         src = src_ptr + i * pitch * 3;
-        uint8_t* u_dst = u_ptr + i * width / 2;
-        uint8_t* v_dst = v_ptr + i * width / 2;
+        uint8_t* u_dst = u_ptr + i * (width / 2);
+        uint8_t* v_dst = v_ptr + i * (width / 2);
 
         for (int32_t cnt = width / 2; cnt > 0; cnt -= 8)
         {
@@ -11470,8 +11483,8 @@ static aipl_error_t aipl_color_convert_argb8888_to_yuv_planar_helium(const void*
     for (uint32_t i = 0; i < height; i += 2)
     {
         const uint8_t* src = src_ptr + i * pitch * 4;
-        uint8_t* u_dst = u_ptr + i / 2 * width / 2;
-        uint8_t* v_dst = v_ptr + i / 2 * width / 2;
+        uint8_t* u_dst = u_ptr + i / 2 * (width / 2);
+        uint8_t* v_dst = v_ptr + i / 2 * (width / 2);
 
         for (int32_t cnt = width / 2; cnt > 0; cnt -= 8)
         {
@@ -11692,11 +11705,11 @@ static aipl_error_t aipl_color_convert_argb4444_to_yuv_planar_helium(const void*
         }
     }
 
-    for (uint32_t i = 0; i < height; i += 2)
+    for (uint32_t i = 0; i + 1 < height; i += 2)
     {
         const uint16_t* src = src_ptr + i * pitch;
-        uint8_t* u_dst = u_ptr + i / 2 * width / 2;
-        uint8_t* v_dst = v_ptr + i / 2 * width / 2;
+        uint8_t* u_dst = u_ptr + i / 2 * (width / 2);
+        uint8_t* v_dst = v_ptr + i / 2 * (width / 2);
 
         for (int32_t cnt = width / 2; cnt > 0; cnt -= 8)
         {
@@ -11758,7 +11771,7 @@ static aipl_error_t aipl_color_convert_argb4444_to_yuv_semi_planar_helium(const
         }
     }
 
-    for (uint32_t i = 0; i < height; i += 2)
+    for (uint32_t i = 0; i + 1 < height; i += 2)
     {
         const uint16_t* src = src_ptr + i * pitch;
         uint8_t* u_dst = u_ptr + i * width / 2;
@@ -11887,11 +11900,11 @@ static aipl_error_t aipl_color_convert_argb1555_to_yuv_planar_helium(const void*
         }
     }
 
-    for (uint32_t i = 0; i < height; i += 2)
+    for (uint32_t i = 0; i + 1 < height; i += 2)
     {
         const uint16_t* src = src_ptr + i * pitch;
-        uint8_t* u_dst = u_ptr + i / 2 * width / 2;
-        uint8_t* v_dst = v_ptr + i / 2 * width / 2;
+        uint8_t* u_dst = u_ptr + i / 2 * (width / 2);
+        uint8_t* v_dst = v_ptr + i / 2 * (width / 2);
 
         for (int32_t cnt = width / 2; cnt > 0; cnt -= 8)
         {
@@ -11953,7 +11966,7 @@ static aipl_error_t aipl_color_convert_argb1555_to_yuv_semi_planar_helium(const
         }
     }
 
-    for (uint32_t i = 0; i < height; i += 2)
+    for (uint32_t i = 0; i + 1 < height; i += 2)
     {
         const uint16_t* src = src_ptr + i * pitch;
         uint8_t* u_dst = u_ptr + i * width / 2;
@@ -12097,8 +12110,8 @@ static aipl_error_t aipl_color_convert_rgba8888_to_yuv_planar_helium(const void*
     for (uint32_t i = 0; i < height; i += 2)
     {
         const uint8_t* src = src_ptr + i * pitch * 4;
-        uint8_t* u_dst = u_ptr + i / 2 * width / 2;
-        uint8_t* v_dst = v_ptr + i / 2 * width / 2;
+        uint8_t* u_dst = u_ptr + i / 2 * (width / 2);
+        uint8_t* v_dst = v_ptr + i / 2 * (width / 2);
 
         for (int32_t cnt = width / 2; cnt > 0; cnt -= 8)
         {
@@ -12319,11 +12332,11 @@ static aipl_error_t aipl_color_convert_rgba4444_to_yuv_planar_helium(const void*
         }
     }
 
-    for (uint32_t i = 0; i < height; i += 2)
+    for (uint32_t i = 0; i + 1 < height; i += 2)
     {
         const uint16_t* src = src_ptr + i * pitch;
-        uint8_t* u_dst = u_ptr + i / 2 * width / 2;
-        uint8_t* v_dst = v_ptr + i / 2 * width / 2;
+        uint8_t* u_dst = u_ptr + i / 2 * (width / 2);
+        uint8_t* v_dst = v_ptr + i / 2 * (width / 2);
 
         for (int32_t cnt = width / 2; cnt > 0; cnt -= 8)
         {
@@ -12385,7 +12398,7 @@ static aipl_error_t aipl_color_convert_rgba4444_to_yuv_semi_planar_helium(const
         }
     }
 
-    for (uint32_t i = 0; i < height; i += 2)
+    for (uint32_t i = 0; i + 1 < height; i += 2)
     {
         const uint16_t* src = src_ptr + i * pitch;
         uint8_t* u_dst = u_ptr + i * width / 2;
@@ -12514,11 +12527,11 @@ static aipl_error_t aipl_color_convert_rgba5551_to_yuv_planar_helium(const void*
         }
     }
 
-    for (uint32_t i = 0; i < height; i += 2)
+    for (uint32_t i = 0; i + 1 < height; i += 2)
     {
         const uint16_t* src = src_ptr + i * pitch;
-        uint8_t* u_dst = u_ptr + i / 2 * width / 2;
-        uint8_t* v_dst = v_ptr + i / 2 * width / 2;
+        uint8_t* u_dst = u_ptr + i / 2 * (width / 2);
+        uint8_t* v_dst = v_ptr + i / 2 * (width / 2);
 
         for (int32_t cnt = width / 2; cnt > 0; cnt -= 8)
         {
@@ -12580,7 +12593,7 @@ static aipl_error_t aipl_color_convert_rgba5551_to_yuv_semi_planar_helium(const
         }
     }
 
-    for (uint32_t i = 0; i < height; i += 2)
+    for (uint32_t i = 0; i + 1 < height; i += 2)
     {
         const uint16_t* src = src_ptr + i * pitch;
         uint8_t* u_dst = u_ptr + i * width / 2;
@@ -12717,8 +12730,8 @@ static aipl_error_t aipl_color_convert_24bit_to_yuv_planar_helium(const void* in
     for (uint32_t i = 0; i < height; i += 2)
     {
         const uint8_t* src = src_ptr + i * pitch * 3;
-        uint8_t* u_dst = u_ptr + i / 2 * width / 2;
-        uint8_t* v_dst = v_ptr + i / 2 * width / 2;
+        uint8_t* u_dst = u_ptr + i / 2 * (width / 2);
+        uint8_t* v_dst = v_ptr + i / 2 * (width / 2);
 
         for (int32_t cnt = width / 2; cnt > 0; cnt -= 8)
         {
@@ -12951,8 +12964,8 @@ static aipl_error_t aipl_color_convert_i422_to_24bit_helium(const void* input,
     for (uint32_t i = 0; i < height; ++i)
     {
         const uint8_t* y_src = y_ptr + i * pitch;
-        const uint8_t* u_src = u_ptr + i * pitch / 2;
-        const uint8_t* v_src = v_ptr + i * pitch / 2;
+        const uint8_t* u_src = u_ptr + i * (pitch / 2);
+        const uint8_t* v_src = v_ptr + i * (pitch / 2);
         uint8_t* dst = dst_ptr + i * width * 3;
 
         for (int32_t cnt = width / 2; cnt > 0; cnt -= 4)
@@ -13089,11 +13102,11 @@ static aipl_error_t aipl_color_convert_rgb565_to_yuv_planar_helium(const void* i
         }
     }
 
-    for (uint32_t i = 0; i < height; i += 2)
+    for (uint32_t i = 0; i + 1 < height; i += 2)
     {
         const uint16_t* src = src_ptr + i * pitch;
-        uint8_t* u_dst = u_ptr + i / 2 * width / 2;
-        uint8_t* v_dst = v_ptr + i / 2 * width / 2;
+        uint8_t* u_dst = u_ptr + i / 2 * (width / 2);
+        uint8_t* v_dst = v_ptr + i / 2 * (width / 2);
 
         for (int32_t cnt = width / 2; cnt > 0; cnt -= 8)
         {
@@ -13155,7 +13168,7 @@ static aipl_error_t aipl_color_convert_rgb565_to_yuv_semi_planar_helium(const vo
         }
     }
 
-    for (uint32_t i = 0; i < height; i += 2)
+    for (uint32_t i = 0; i + 1 < height; i += 2)
     {
         const uint16_t* src = src_ptr + i * pitch;
         uint8_t* u_dst = u_ptr + i * width / 2;
@@ -13304,8 +13317,8 @@ static aipl_error_t aipl_color_convert_yuv_planar_to_argb8888_helium(const uint8
     {
         const uint8_t* y_src0 = y_ptr + i * pitch;
         const uint8_t* y_src1 = y_src0 + pitch;
-        const uint8_t* u_src = u_ptr + i / 2 * pitch / 2;
-        const uint8_t* v_src = v_ptr + i / 2 * pitch / 2;
+        const uint8_t* u_src = u_ptr + i / 2 * (pitch / 2);
+        const uint8_t* v_src = v_ptr + i / 2 * (pitch / 2);
         uint32_t* dst0 = dst_ptr + i * width;
         uint32_t* dst1 = dst0 + width;
 
@@ -13481,8 +13494,8 @@ static aipl_error_t aipl_color_convert_yuv_planar_to_argb4444_helium(const uint8
     {
         const uint8_t* y_src0 = y_ptr + i * pitch;
         const uint8_t* y_src1 = y_src0 + pitch;
-        const uint8_t* u_src = u_ptr + i / 2 * pitch / 2;
-        const uint8_t* v_src = v_ptr + i / 2 * pitch / 2;
+        const uint8_t* u_src = u_ptr + i / 2 * (pitch / 2);
+        const uint8_t* v_src = v_ptr + i / 2 * (pitch / 2);
         uint16_t* dst0 = dst_ptr + i * width;
         uint16_t* dst1 = dst0 + width;
 
@@ -13648,8 +13661,8 @@ static aipl_error_t aipl_color_convert_yuv_planar_to_argb1555_helium(const uint8
     {
         const uint8_t* y_src0 = y_ptr + i * pitch;
         const uint8_t* y_src1 = y_src0 + pitch;
-        const uint8_t* u_src = u_ptr + i / 2 * pitch / 2;
-        const uint8_t* v_src = v_ptr + i / 2 * pitch / 2;
+        const uint8_t* u_src = u_ptr + i / 2 * (pitch / 2);
+        const uint8_t* v_src = v_ptr + i / 2 * (pitch / 2);
         uint16_t* dst0 = dst_ptr + i * width;
         uint16_t* dst1 = dst0 + width;
 
@@ -13815,8 +13828,8 @@ static aipl_error_t aipl_color_convert_yuv_planar_to_rgba8888_helium(const uint8
     {
         const uint8_t* y_src0 = y_ptr + i * pitch;
         const uint8_t* y_src1 = y_src0 + pitch;
-        const uint8_t* u_src = u_ptr + i / 2 * pitch / 2;
-        const uint8_t* v_src = v_ptr + i / 2 * pitch / 2;
+        const uint8_t* u_src = u_ptr + i / 2 * (pitch / 2);
+        const uint8_t* v_src = v_ptr + i / 2 * (pitch / 2);
         uint32_t* dst0 = dst_ptr + i * width;
         uint32_t* dst1 = dst0 + width;
 
@@ -13992,8 +14005,8 @@ static aipl_error_t aipl_color_convert_yuv_planar_to_rgba4444_helium(const uint8
     {
         const uint8_t* y_src0 = y_ptr + i * pitch;
         const uint8_t* y_src1 = y_src0 + pitch;
-        const uint8_t* u_src = u_ptr + i / 2 * pitch / 2;
-        const uint8_t* v_src = v_ptr + i / 2 * pitch / 2;
+        const uint8_t* u_src = u_ptr + i / 2 * (pitch / 2);
+        const uint8_t* v_src = v_ptr + i / 2 * (pitch / 2);
         uint16_t* dst0 = dst_ptr + i * width;
         uint16_t* dst1 = dst0 + width;
 
@@ -14159,8 +14172,8 @@ static aipl_error_t aipl_color_convert_yuv_planar_to_rgba5551_helium(const uint8
     {
         const uint8_t* y_src0 = y_ptr + i * pitch;
         const uint8_t* y_src1 = y_src0 + pitch;
-        const uint8_t* u_src = u_ptr + i / 2 * pitch / 2;
-        const uint8_t* v_src = v_ptr + i / 2 * pitch / 2;
+        const uint8_t* u_src = u_ptr + i / 2 * (pitch / 2);
+        const uint8_t* v_src = v_ptr + i / 2 * (pitch / 2);
         uint16_t* dst0 = dst_ptr + i * width;
         uint16_t* dst1 = dst0 + width;
 
@@ -14329,8 +14342,8 @@ static aipl_error_t aipl_color_convert_yuv_planar_to_24bit_helium(const uint8_t*
     {
         const uint8_t* y_src0 = y_ptr + i * pitch;
         const uint8_t* y_src1 = y_src0 + pitch;
-        const uint8_t* u_src = u_ptr + i / 2 * pitch / 2;
-        const uint8_t* v_src = v_ptr + i / 2 * pitch / 2;
+        const uint8_t* u_src = u_ptr + i / 2 * (pitch / 2);
+        const uint8_t* v_src = v_ptr + i / 2 * (pitch / 2);
         uint8_t* dst0 = dst_ptr + i * width * 3;
         uint8_t* dst1 = dst0 + width * 3;
 
@@ -14524,8 +14537,8 @@ static aipl_error_t aipl_color_convert_yuv_planar_to_rgb565_helium(const uint8_t
     {
         const uint8_t* y_src0 = y_ptr + i * pitch;
         const uint8_t* y_src1 = y_src0 + pitch;
-        const uint8_t* u_src = u_ptr + i / 2 * pitch / 2;
-        const uint8_t* v_src = v_ptr + i / 2 * pitch / 2;
+        const uint8_t* u_src = u_ptr + i / 2 * (pitch / 2);
+        const uint8_t* v_src = v_ptr + i / 2 * (pitch / 2);
         uint16_t* dst0 = dst_ptr + i * width;
         uint16_t* dst1 = dst0 + width;
 
@@ -14696,11 +14709,11 @@ static aipl_error_t aipl_color_convert_yuv_planar_to_semi_helium(const uint8_t*
 
         memcpy(y_d, y_s, width);
 
-        if (!(i & 1))
+        if (!(i & 1) && i + 1 < height)
         {
-            const uint8_t* u_s = u_src + i / 2 * pitch / 2;
+            const uint8_t* u_s = u_src + i / 2 * (pitch / 2);
             uint8_t* u_d = u_dst + i / 2 * width;
-            const uint8_t* v_s = v_src + i / 2 * pitch / 2;
+            const uint8_t* v_s = v_src + i / 2 * (pitch / 2);
             uint8_t* v_d = v_dst + i / 2 * width;
 
             for (int32_t cnt = width / 2; cnt > 0; cnt -= 16)
@@ -14748,12 +14761,12 @@ static aipl_error_t aipl_color_convert_yuv_semi_to_planar_helium(const uint8_t*
 
         memcpy(y_d, y_s, width);
 
-        if (!(i & 1))
+        if (!(i & 1) && i + 1 < height)
         {
             const uint8_t* u_s = u_src + i / 2 * pitch;
-            uint8_t* u_d = u_dst + i / 2 * width / 2;
+            uint8_t* u_d = u_dst + i / 2 * (width / 2);
             const uint8_t* v_s = v_src + i / 2 * pitch;
-            uint8_t* v_d = v_dst + i / 2 * width / 2;
+            uint8_t* v_d = v_dst + i / 2 * (width / 2);
 
             int32_t cnt = width / 2;
             while (cnt > 0)
@@ -14817,12 +14830,12 @@ static aipl_error_t aipl_color_convert_yuv_packed_to_planar_helium(const uint8_t
             cnt -= 16;
         }
 
-        if (!(i & 1))
+        if (!(i & 1) && i + 1 < height)
         {
             const uint8_t* u_s = u_src + i * pitch * 2;
-            uint8_t* u_d = u_dst + i / 2 * width / 2;
+            uint8_t* u_d = u_dst + i / 2 * (width / 2);
             const uint8_t* v_s = v_src + i * pitch * 2;
-            uint8_t* v_d = v_dst + i / 2 * width / 2;
+            uint8_t* v_d = v_dst + i / 2 * (width / 2);
 
             cnt = width / 2;
             while (cnt > 0)
@@ -14884,7 +14897,7 @@ static aipl_error_t aipl_color_convert_yuv_packed_to_semi_helium(const uint8_t*
             cnt -= 16;
         }
 
-        if (!(i & 1))
+        if (!(i & 1) && i + 1 < height)
         {
             const uint8_t* u_s = u_src + i * pitch * 2;
             uint8_t* u_d = u_dst + i / 2 * width;
@@ -15101,4 +15114,336 @@ aipl_error_t aipl_color_convert_rgb888p_to_rgb565_helium(const void* input,
 #endif
 #endif
 
+aipl_error_t aipl_color_convert_y16_to_i400_helium(const void* input,
+                                                   void* output,
+                                                   uint32_t pitch,
+                                                   uint32_t width,
+                                                   uint32_t height,
+                                                   uint8_t shift)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    if (shift > 15)
+        return AIPL_ERR_NOT_SUPPORTED;
+
+    const uint16_t* src_ptr = input;
+    uint8_t* dst_ptr = output;
+
+    for (uint32_t i = 0; i < height; ++i)
+    {
+        const uint16_t* src = src_ptr + i * pitch;
+        uint8_t* dst = dst_ptr + i * width;
+
+        for (int32_t cnt = width; cnt > 0; cnt -= 8)
+        {
+            mve_pred16_t tail_p = vctp16q(cnt);
+
+            uint16x8_t val = vldrhq_z_u16(src, tail_p);
+            val = vshlq_r(val, -shift);
+            val = vminq(val, vdupq_n_u16(0xff));
+
+            vstrbq_p(dst, val, tail_p);
+
+            src += 8;
+            dst += 8;
+        }
+    }
+
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_color_convert_y16_lut_helium(const void* input,
+                                               void* output,
+                                               uint32_t pitch,
+                                               uint32_t width,
+                                               uint32_t height,
+                                               const uint8_t* lut,
+                                               uint8_t shift)
+{
+    if (input == NULL || output == NULL || lut == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    if (shift > 15)
+        return AIPL_ERR_NOT_SUPPORTED;
+
+    const uint16_t* src_ptr = input;
+    uint8_t* dst_ptr = output;
+
+    for (uint32_t i = 0; i < height; ++i)
+    {
+        const uint16_t* src = src_ptr + i * pitch;
+        uint8_t* dst = dst_ptr + i * width;
+
+        for (int32_t cnt = width; cnt > 0; cnt -= 8)
+        {
+            mve_pred16_t tail_p = vctp16q(cnt);
+
+            uint16x8_t idx = vldrhq_z_u16(src, tail_p);
+            idx = vshlq_r(idx, -shift);
+
+            uint16x8_t val = vldrbq_gather_offset_z_u16(lut, idx, tail_p);
+
+            vstrbq_p(dst, val, tail_p);
+
+            src += 8;
+            dst += 8;
+        }
+    }
+
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_color_convert_i400_to_y16_helium(const void* input,
+                                                   void* output,
+                                                   uint32_t pitch,
+                                                   uint32_t width,
+                                                   uint32_t height,
+                                                   uint8_t shift)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    if (shift > 8)
+        return AIPL_ERR_NOT_SUPPORTED;
+
+    const uint8_t* src_ptr = input;
+    uint16_t* dst_ptr = output;
+
+    for (uint32_t i = 0; i < height; ++i)
+    {
+        const uint8_t* src = src_ptr + i * pitch;
+        uint16_t* dst = dst_ptr + i * width;
+
+        for (int32_t cnt = width; cnt > 0; cnt -= 8)
+        {
+            mve_pred16_t tail_p = vctp16q(cnt);
+
+            uint16x8_t val = vldrbq_z_u16(src, tail_p);
+            val = vorrq(vshlq_r(val, shift), vshlq_r(val, shift - 8));
+
+            vstrhq_p(dst, val, tail_p);
+
+            src += 8;
+            dst += 8;
+        }
+    }
+
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_color_convert_colorimetry_helium(const void* input,
+                                                   void* output,
+                                                   uint32_t pitch,
+                                                   uint32_t width,
+                                                   uint32_t height,
+                                                   aipl_color_format_t input_format,
+                                                   aipl_color_format_t output_format,
+                                                   const aipl_yuv_coefs_t* coefs)
+{
+    if (input == NULL || output == NULL || coefs == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    if (input_format != AIPL_COLOR_ARGB8888)
+        return AIPL_ERR_NOT_SUPPORTED;
+
+    /* Chroma planes of whole blocks, laid out
+       like those of the dedicated converters */
+    uint8_t* y = output;
+    uint32_t size = width * height;
+    uint32_t uv_pitch = width / 2;
+
+    switch (output_format)
+    {
+        case AIPL_COLOR_I400:
+            aipl_color_convert_argb8888_to_yuv_coefs_helium(input, pitch,
+                                                            width, height,
+                                                            y, NULL, NULL,
+                                                            1, 0, 0, 0, 0,
+                                                            coefs);
+            break;
+        case AIPL_COLOR_YV12:
+            aipl_color_convert_argb8888_to_yuv_coefs_helium(input, pitch,
+                                                            width, height,
+                                                            y, y + size + size / 4,
+                                                            y + size,
+                                                            1, 1, uv_pitch, 1, 1,
+                                                            coefs);
+            break;
+        case AIPL_COLOR_I420:
+            aipl_color_convert_argb8888_to_yuv_coefs_helium(input, pitch,
+                                                            width, height,
+                                                            y, y + size,
+                                                            y + size + size / 4,
+                                                            1, 1, uv_pitch, 1, 1,
+                                                            coefs);
+            break;
+        case AIPL_COLOR_I422:
+            aipl_color_convert_argb8888_to_yuv_coefs_helium(input, pitch,
+                                                            width, height,
+                                                            y, y + size,
+                                                            y + size + size / 2,
+                                                            1, 1, uv_pitch, 1, 0,
+                                                            coefs);
+            break;
+        case AIPL_COLOR_I444:
+            aipl_color_convert_argb8888_to_yuv_coefs_helium(input, pitch,
+                                                            width, height,
+                                                            y, y + size,
+                                                            y + size * 2,
+                                                            1, 1, width, 0, 0,
+                                                            coefs);
+            break;
+        case AIPL_COLOR_NV12:
+            aipl_color_convert_argb8888_to_yuv_coefs_helium(input, pitch,
+                                                            width, height,
+                                                            y, y + size,
+                                                            y + size + 1,
+                                                            1, 2, width, 1, 1,
+                                                            coefs);
+            break;
+        case AIPL_COLOR_NV21:
+            aipl_color_convert_argb8888_to_yuv_coefs_helium(input, pitch,
+                                                            width, height,
+                                                            y, y + size + 1,
+                                                            y + size,
+                                                            1, 2, width, 1, 1,
+                                                            coefs);
+            break;
+        case AIPL_COLOR_YUY2:
+            aipl_color_convert_argb8888_to_yuv_coefs_helium(input, pitch,
+                                                            width, height,
+                                                            y, y + 1, y + 3,
+                                                            2, 4, width * 2, 1, 0,
+                                                            coefs);
+            break;
+        case AIPL_COLOR_UYVY:
+            aipl_color_convert_argb8888_to_yuv_coefs_helium(input, pitch,
+                                                            width, height,
+                                                            y + 1, y, y + 2,
+                                                            2, 4, width * 2, 1, 0,
+                                                            coefs);
+            break;
+
+        default:
+            return AIPL_ERR_NOT_SUPPORTED;
+    }
+
+    return AIPL_ERR_OK;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static void aipl_color_convert_argb8888_to_yuv_coefs_helium(const void* input,
+                                                            uint32_t pitch,
+                                                            uint32_t width,
+                                                            uint32_t height,
+                                                            uint8_t* y,
+                                                            uint8_t* u,
+                                                            uint8_t* v,
+                                                            uint32_t y_step,
+                                                            uint32_t uv_step,
+                                                            uint32_t uv_pitch,
+                                                            uint32_t x_shift,
+                                                            uint32_t y_shift,
+                                                            const aipl_yuv_coefs_t* coefs)
+{
+    const aipl_yuv_coefs_t yuv = *coefs;
+    const uint8_t* src_ptr = input;
+
+    /* Even and odd pixels are converted separately. Subsampled
+       chroma is the rounded average of the pixels of a whole block
+       like in the generic engine, a trailing odd row or column has
+       none. Lanes are masked to 8 bits as the negative chroma terms
+       wrap around in 16 bits */
+    uint16x8_t y_offsets = AIPL_OFFSETS_U16(y_step * 2, 1);
+    uint16x8_t uv_offsets = AIPL_OFFSETS_U16(uv_step << (1 - x_shift), 1);
+    uint32_t block_rows = 1 + y_shift;
+    int32_t block_shift = x_shift + y_shift;
+
+    for (uint32_t i = 0; i < height; i += block_rows)
+    {
+        uint32_t rows = height - i < block_rows ? height - i : block_rows;
+        uint32_t uv_offset = (i >> y_shift) * uv_pitch;
+
+        for (uint32_t j = 0; j < width; j += 16)
+        {
+            mve_pred16_t evn_p = vctp16q((width - j + 1) / 2);
+            mve_pred16_t odd_p = vctp16q((width - j) / 2);
+
+            uint16x8_t u_sum = vdupq_n_u16(0);
+            uint16x8_t v_sum = vdupq_n_u16(0);
+
+            for (uint32_t r = 0; r < rows; ++r)
+            {
+                const uint8_t* src = src_ptr + ((i + r) * pitch + j) * 4;
+                uint8_t* y_dst = y + ((i + r) * width + j) * y_step;
+
+                aipl_mve_rgb_x8_t rgb0;
+                aipl_mve_rgb_x8_t rgb1;
+                aipl_mve_ldr_8px_offset_xrgb8888(&rgb0, src, 2, evn_p);
+                aipl_mve_ldr_8px_offset_xrgb8888(&rgb1, src + 4, 2, odd_p);
+
+                uint16x8_t y_val0;
+                uint16x8_t y_val1;
+                aipl_mve_cnvt_8px_xrgb8888_to_yuv_y_coefs(&y_val0, rgb0, &yuv);
+                aipl_mve_cnvt_8px_xrgb8888_to_yuv_y_coefs(&y_val1, rgb1, &yuv);
+
+                vstrbq_scatter_offset_p(y_dst, y_offsets, y_val0, evn_p);
+                vstrbq_scatter_offset_p(y_dst + y_step, y_offsets,
+                                        y_val1, odd_p);
+
+                if (u == NULL)
+                    continue;
+
+                uint16x8_t u_val0;
+                uint16x8_t v_val0;
+                uint16x8_t u_val1;
+                uint16x8_t v_val1;
+                aipl_mve_cnvt_8px_xrgb8888_to_yuv_u_coefs(&u_val0, rgb0, &yuv);
+                aipl_mve_cnvt_8px_xrgb8888_to_yuv_v_coefs(&v_val0, rgb0, &yuv);
+                aipl_mve_cnvt_8px_xrgb8888_to_yuv_u_coefs(&u_val1, rgb1, &yuv);
+                aipl_mve_cnvt_8px_xrgb8888_to_yuv_v_coefs(&v_val1, rgb1, &yuv);
+
+                u_val0 = vandq(u_val0, vdupq_n_u16(0xff));
+                v_val0 = vandq(v_val0, vdupq_n_u16(0xff));
+                u_val1 = vandq(u_val1, vdupq_n_u16(0xff));
+                v_val1 = vandq(v_val1, vdupq_n_u16(0xff));
+
+                if (x_shift == 0)
+                {
+                    uint8_t* u_px = u + uv_offset + j * uv_step;
+                    uint8_t* v_px = v + uv_offset + j * uv_step;
+
+                    vstrbq_scatter_offset_p(u_px, uv_offsets, u_val0, evn_p);
+                    vstrbq_scatter_offset_p(v_px, uv_offsets, v_val0, evn_p);
+                    vstrbq_scatter_offset_p(u_px + uv_step, uv_offsets,
+                                            u_val1, odd_p);
+                    vstrbq_scatter_offset_p(v_px + uv_step, uv_offsets,
+                                            v_val1, odd_p);
+                    continue;
+                }
+
+                u_sum = vaddq(u_sum, vaddq(u_val0, u_val1));
+                v_sum = vaddq(v_sum, vaddq(v_val0, v_val1));
+            }
+
+            if (u == NULL || x_shift == 0 || rows < block_rows)
+                continue;
+
+            /* Only lanes of whole pixel pairs are stored */
+            uint16x8_t round = vdupq_n_u16(1 << (block_shift - 1));
+            u_sum = vshlq_r(vaddq(u_sum, round), -block_shift);
+            v_sum = vshlq_r(vaddq(v_sum, round), -block_shift);
+
+            uint8_t* u_px = u + uv_offset + (j >> 1) * uv_step;
+            uint8_t* v_px = v + uv_offset + (j >> 1) * uv_step;
+
+            vstrbq_scatter_offset_p(u_px, uv_offsets, u_sum, odd_p);
+            vstrbq_scatter_offset_p(v_px, uv_offsets, v_sum, odd_p);
+        }
+    }
+}
+
 #endif /* AIPL_HELIUM_ACCELERATION */
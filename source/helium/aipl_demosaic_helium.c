@@ -24,6 +24,7 @@
 #include <string.h>
 
 #include "aipl_mve_utils.h"
+#include "aipl_demosaic_default.h"
 
 /*********************
  *      DEFINES
@@ -31,9 +32,34 @@
 
 #ifdef AIPL_HELIUM_ACCELERATION
 
+/* Largest run of pixels requested by the demosaicing encoder */
+#define AIPL_DEMOSAIC_CHUNK 32
+
 /**********************
  *      TYPEDEFS
  **********************/
+/* 16-bit raw image demosaicing state */
+typedef struct {
+    const uint8_t* input;
+    uint32_t stride;            /* Row size in bytes */
+    uint32_t height;
+    aipl_bayer_tile_t tile;     /* Filter phase only */
+    uint8_t shift;              /* Rounding shift of 16-bit samples */
+} aipl_demosaic_16bit_ctx_t;
+
+/* Corrected raw image demosaicing state */
+typedef struct {
+    const uint8_t* input;
+    uint32_t pitch;
+    uint32_t width;
+    uint32_t height;
+    uint8_t red_row;
+    uint8_t red_col;
+    const aipl_raw_correction_t* corr;
+    uint32_t x_step;            /* Gain grid points per sample in 16.16 */
+    uint32_t y_step;
+    uint8_t white;              /* Largest corrected sample */
+} aipl_demosaic_corrected_ctx_t;
 
 /**********************
  *  STATIC PROTOTYPES
@@ -47,6 +73,121 @@ static INLINE void aipl_bayer_to_rgb_x16(aipl_mve_rgb_x16_t* rgb,
                                          aipl_bayer_tile_t* tile,
                                          uint32_t idx,
                                          mve_pred16_t pred);
+static INLINE void aipl_bayer16_to_rgb_x8(aipl_mve_rgb_x8_t* rgb0,
+                                          aipl_mve_rgb_x8_t* rgb1,
+                                          const aipl_bayer_tile_t* tile,
+                                          uint32_t idx,
+                                          mve_pred16_t pred);
+static void aipl_demosaic_16bit_source(aipl_argb8888_px_t* px,
+                                       uint32_t x, uint32_t y,
+                                       uint32_t count,
+                                       void* ctx);
+static uint8_t aipl_raw_white_level(const uint16_t* gains,
+                                    bool clip_highlights);
+static void aipl_raw_correct_row(uint8_t* dst,
+                                 const aipl_demosaic_corrected_ctx_t* ctx,
+                                 uint32_t row, uint32_t x, uint32_t count);
+static void aipl_demosaic_corrected_source(aipl_argb8888_px_t* px,
+                                           uint32_t x, uint32_t y,
+                                           uint32_t count,
+                                           void* ctx);
+static INLINE void aipl_bayer16_to_rgb_x8(aipl_mve_rgb_x8_t* rgb0,
+                                          aipl_mve_rgb_x8_t* rgb1,
+                                          const aipl_bayer_tile_t* tile,
+                                          uint32_t idx,
+                                          mve_pred16_t pred)
+{
+    const uint16_t* red_src = (const uint16_t*)tile->red_src + idx;
+    const uint16_t* blue_src = (const uint16_t*)tile->blue_src + idx;
+
+    /* Every other sample, one lane per pair of output pixels */
+    uint16x8_t offsets = vidupq_n_u16(0, 2);
+
+    uint32_t red_col = tile->red_col;
+    uint32_t blue_col = tile->blue_col;
+    uint32_t red_col_2dx = red_col << 1;
+    uint32_t blue_col_2dx = blue_col << 1;
+
+    rgb0->r = vldrhq_gather_shifted_offset_z(red_src + red_col,
+                                             offsets, pred);
+    rgb0->g = vhaddq(vldrhq_gather_shifted_offset_z(red_src + blue_col,
+                                                    offsets, pred),
+                     vldrhq_gather_shifted_offset_z(blue_src + red_col,
+                                                    offsets, pred));
+    rgb0->b = vldrhq_gather_shifted_offset_z(blue_src + blue_col,
+                                             offsets, pred);
+
+    rgb1->r = vldrhq_gather_shifted_offset_z(red_src + red_col + blue_col_2dx,
+                                             offsets, pred);
+    rgb1->g = vhaddq(vldrhq_gather_shifted_offset_z(red_src + blue_col
+                                                    + red_col_2dx,
+                                                    offsets, pred),
+                     vldrhq_gather_shifted_offset_z(blue_src + red_col
+                                                    + blue_col_2dx,
+                                                    offsets, pred));
+    rgb1->b = vldrhq_gather_shifted_offset_z(blue_src + blue_col + red_col_2dx,
+                                             offsets, pred);
+}
+
+static void aipl_demosaic_16bit_source(aipl_argb8888_px_t* px,
+                                       uint32_t x, uint32_t y,
+                                       uint32_t count,
+                                       void* ctx)
+{
+    const aipl_demosaic_16bit_ctx_t* raw = ctx;
+
+    /* The last row repeats the one above it */
+    uint32_t i = y < raw->height - 1 ? y : raw->height - 2;
+
+    aipl_bayer_tile_t tile = raw->tile;
+    tile.red_src = raw->input + (i + ((i + tile.red_row) & 1)) * raw->stride;
+    tile.blue_src = raw->input + (i + ((i + tile.blue_row) & 1)) * raw->stride;
+
+    int32_t shift = -raw->shift;
+    uint16x8_t max = vdupq_n_u16(255);
+    uint16x8_t alpha = vdupq_n_u16(0xff);
+
+    /* Byte offsets of every other ARGB8888 pixel */
+    uint16x8_t offsets = vidupq_n_u16(0, 8);
+
+    uint8_t* dst = (uint8_t*)px;
+
+    int32_t cnt = (count + 1) / 2;
+    uint32_t j = 0;
+    for (; cnt > 0; cnt -= 8, j += 16, dst += 64)
+    {
+        mve_pred16_t tail_p = vctp16q(cnt);
+
+        aipl_mve_rgb_x8_t rgb0;
+        aipl_mve_rgb_x8_t rgb1;
+
+        aipl_bayer16_to_rgb_x8(&rgb0, &rgb1, &tile, x + j, tail_p);
+
+        /* Round to 8 bits, the largest samples saturate */
+        vstrbq_scatter_offset_p(dst, offsets,
+                                vminq(vrshlq(rgb0.b, shift), max), tail_p);
+        vstrbq_scatter_offset_p(dst + 1, offsets,
+                                vminq(vrshlq(rgb0.g, shift), max), tail_p);
+        vstrbq_scatter_offset_p(dst + 2, offsets,
+                                vminq(vrshlq(rgb0.r, shift), max), tail_p);
+        vstrbq_scatter_offset_p(dst + 3, offsets, alpha, tail_p);
+        vstrbq_scatter_offset_p(dst + 4, offsets,
+                                vminq(vrshlq(rgb1.b, shift), max), tail_p);
+        vstrbq_scatter_offset_p(dst + 5, offsets,
+                                vminq(vrshlq(rgb1.g, shift), max), tail_p);
+        vstrbq_scatter_offset_p(dst + 6, offsets,
+                                vminq(vrshlq(rgb1.r, shift), max), tail_p);
+        vstrbq_scatter_offset_p(dst + 7, offsets, alpha, tail_p);
+    }
+}
+
+static aipl_error_t aipl_demosaic_yuv_luma(const void* input,
+                                           uint8_t* y,
+                                           uint32_t pitch,
+                                           uint32_t width,
+                                           uint32_t height,
+                                           aipl_bayer_filter_t filter,
+                                           const aipl_yuv_coefs_t* coefs);
 static aipl_error_t aipl_demosaic_yuv_planar(const void* input,
                                              uint8_t* y,
                                              uint8_t* u,
@@ -54,7 +195,8 @@ static aipl_error_t aipl_demosaic_yuv_planar(const void* input,
                                              uint32_t pitch,
                                              uint32_t width,
                                              uint32_t height,
-                                             aipl_bayer_filter_t filter);
+                                             aipl_bayer_filter_t filter,
+                                             const aipl_yuv_coefs_t* coefs);
 static aipl_error_t aipl_demosaic_yuv_semi_planar(const void* input,
                                                   uint8_t* y,
                                                   uint8_t* u,
@@ -62,7 +204,8 @@ static aipl_error_t aipl_demosaic_yuv_semi_planar(const void* input,
                                                   uint32_t pitch,
                                                   uint32_t width,
                                                   uint32_t height,
-                                                  aipl_bayer_filter_t filter);
+                                                  aipl_bayer_filter_t filter,
+                                                  const aipl_yuv_coefs_t* coefs);
 static aipl_error_t aipl_demosaic_yuv_packed(const void* input,
                                              uint8_t* y,
                                              uint8_t* u,
@@ -70,7 +213,26 @@ static aipl_error_t aipl_demosaic_yuv_packed(const void* input,
                                              uint32_t pitch,
                                              uint32_t width,
                                              uint32_t height,
-                                             aipl_bayer_filter_t filter);
+                                             aipl_bayer_filter_t filter,
+                                             const aipl_yuv_coefs_t* coefs);
+static aipl_error_t aipl_demosaic_yuv_422(const void* input,
+                                          uint8_t* y,
+                                          uint8_t* u,
+                                          uint8_t* v,
+                                          uint32_t pitch,
+                                          uint32_t width,
+                                          uint32_t height,
+                                          aipl_bayer_filter_t filter,
+                                          const aipl_yuv_coefs_t* coefs);
+static aipl_error_t aipl_demosaic_yuv_444(const void* input,
+                                          uint8_t* y,
+                                          uint8_t* u,
+                                          uint8_t* v,
+                                          uint32_t pitch,
+                                          uint32_t width,
+                                          uint32_t height,
+                                          aipl_bayer_filter_t filter,
+                                          const aipl_yuv_coefs_t* coefs);
 
  /**********************
  *  STATIC VARIABLES
@@ -119,6 +281,9 @@ aipl_error_t aipl_demosaic_helium(const void *input, void *output,
         case AIPL_COLOR_BGR888:
             return aipl_demosaic_bgr888_helium(input, output, pitch,
                                                width, height, filter);
+        case AIPL_COLOR_RGB888P:
+            return aipl_demosaic_rgb888p_helium(input, output, pitch,
+                                                width, height, filter);
         case AIPL_COLOR_RGB565:
             return aipl_demosaic_rgb565_helium(input, output, pitch,
                                                width, height, filter);
@@ -177,48 +342,12 @@ aipl_error_t aipl_demosaic_alpha8_helium(const void* input,
                                          uint32_t height,
                                          aipl_bayer_filter_t filter)
 {
-    if (input == NULL || output == NULL)
-    {
-        return AIPL_ERR_NULL_POINTER;
-    }
-
-    aipl_bayer_tile_t tile = aipl_bayer_tile(input, pitch, filter);
+    const aipl_yuv_coefs_t* coefs =
+        aipl_colorimetry_coefs(AIPL_COLORIMETRY_BT601_LIMITED);
 
-    for (uint32_t i = 0; i < height - 1; ++i)
-    {
-        uint8_t* dst = (uint8_t*)output + i * width;
-
-        int32_t cnt = width / 2;
-        uint32_t j = 0;
-        for (; cnt > 0; cnt -= 8, j += 16)
-        {
-            mve_pred16_t tail_p = vctp16q(cnt);
-
-            aipl_mve_rgb_x8_t rgb0;
-            aipl_mve_rgb_x8_t rgb1;
-
-            aipl_bayer_to_rgb_x8(&rgb0, &rgb1, &tile, j, tail_p);
-
-            uint16x8_t alpha0;
-            uint16x8_t alpha1;
-
-            aipl_mve_cnvt_8px_xrgb8888_to_yuv_y(&alpha0, rgb0);
-            aipl_mve_cnvt_8px_xrgb8888_to_yuv_y(&alpha1, rgb1);
-
-            uint8x16_t alpha = vmovntq(vreinterpretq_u8(alpha0), alpha1);
-
-            vstrbq_p(dst + j, alpha, tail_p);
-        }
-
-        tile.red_src += (i + tile.blue_row) % 2 * pitch * 2;
-        tile.blue_src += (i + tile.red_row) % 2 * pitch * 2;
-    }
-
-    memcpy((uint8_t*)output + (height - 1) * width,
-           (uint8_t*)output + (height - 2) * width,
-           width);
-
-    return AIPL_ERR_OK;
+    return aipl_demosaic_colorimetry_helium(input, output, pitch,
+                                            width, height, filter,
+                                            AIPL_COLOR_ALPHA8, coefs);
 }
 
 aipl_error_t aipl_demosaic_argb8888_helium(const void* input,
@@ -559,6 +688,92 @@ aipl_error_t aipl_demosaic_bgr888_helium(const void* input,
     return AIPL_ERR_OK;
 }
 
+aipl_error_t aipl_demosaic_rgb888p_helium(const void* input,
+                                          void* output,
+                                          uint32_t pitch,
+                                          uint32_t width,
+                                          uint32_t height,
+                                          aipl_bayer_filter_t filter)
+{
+    if (output == NULL)
+    {
+        return AIPL_ERR_NULL_POINTER;
+    }
+
+    uint8_t* red = output;
+    uint8_t* green = red + width * height;
+    uint8_t* blue = green + width * height;
+
+    return aipl_demosaic_planar_helium(input, red, green, blue,
+                                       pitch, NULL,
+                                       width, height, filter);
+}
+
+aipl_error_t aipl_demosaic_planar_helium(const void* input,
+                                         void* red, void* green, void* blue,
+                                         uint32_t pitch,
+                                         const uint32_t plane_pitch[3],
+                                         uint32_t width, uint32_t height,
+                                         aipl_bayer_filter_t filter)
+{
+    if (input == NULL || red == NULL || green == NULL || blue == NULL)
+    {
+        return AIPL_ERR_NULL_POINTER;
+    }
+
+    uint32_t red_pitch = width;
+    uint32_t green_pitch = width;
+    uint32_t blue_pitch = width;
+
+    if (plane_pitch != NULL)
+    {
+        red_pitch = plane_pitch[0];
+        green_pitch = plane_pitch[1];
+        blue_pitch = plane_pitch[2];
+    }
+
+    if (red_pitch < width || green_pitch < width || blue_pitch < width)
+    {
+        return AIPL_ERR_FRAME_OUT_OF_RANGE;
+    }
+
+    aipl_bayer_tile_t tile = aipl_bayer_tile(input, pitch, filter);
+
+    for (uint32_t i = 0; i < height - 1; ++i)
+    {
+        uint8_t* dst_r = (uint8_t*)red + i * red_pitch;
+        uint8_t* dst_g = (uint8_t*)green + i * green_pitch;
+        uint8_t* dst_b = (uint8_t*)blue + i * blue_pitch;
+
+        int32_t cnt = width / 2;
+        uint32_t j = 0;
+        for (; cnt > 0; cnt -= 8, j += 16)
+        {
+            mve_pred16_t tail_p = vctp16q(cnt);
+
+            aipl_mve_rgb_x16_t rgb;
+
+            aipl_bayer_to_rgb_x16(&rgb, &tile, j, tail_p);
+
+            vstrbq_p(dst_r + j, rgb.r, tail_p);
+            vstrbq_p(dst_g + j, rgb.g, tail_p);
+            vstrbq_p(dst_b + j, rgb.b, tail_p);
+        }
+
+        tile.red_src += (i + tile.blue_row) % 2 * pitch * 2;
+        tile.blue_src += (i + tile.red_row) % 2 * pitch * 2;
+    }
+
+    memcpy((uint8_t*)red + (height - 1) * red_pitch,
+           (uint8_t*)red + (height - 2) * red_pitch, width);
+    memcpy((uint8_t*)green + (height - 1) * green_pitch,
+           (uint8_t*)green + (height - 2) * green_pitch, width);
+    memcpy((uint8_t*)blue + (height - 1) * blue_pitch,
+           (uint8_t*)blue + (height - 2) * blue_pitch, width);
+
+    return AIPL_ERR_OK;
+}
+
 aipl_error_t aipl_demosaic_rgb565_helium(const void* input,
                                          void* output,
                                          uint32_t pitch,
@@ -606,13 +821,12 @@ aipl_error_t aipl_demosaic_yv12_helium(const void* input, void* output,
                                        uint32_t width, uint32_t height,
                                        aipl_bayer_filter_t filter)
 {
-    uint8_t* y = output;
-    uint8_t* v = y + width * height;
-    uint8_t* u = v + width * height / 4;
-
-    return aipl_demosaic_yuv_planar(input, y, u, v, pitch,
-                                          width, height, filter);
+    const aipl_yuv_coefs_t* coefs =
+        aipl_colorimetry_coefs(AIPL_COLORIMETRY_BT601_LIMITED);
 
+    return aipl_demosaic_colorimetry_helium(input, output, pitch,
+                                            width, height, filter,
+                                            AIPL_COLOR_YV12, coefs);
 }
 
 aipl_error_t aipl_demosaic_i420_helium(const void* input, void* output,
@@ -620,13 +834,12 @@ aipl_error_t aipl_demosaic_i420_helium(const void* input, void* output,
                                        uint32_t width, uint32_t height,
                                        aipl_bayer_filter_t filter)
 {
-    uint8_t* y = output;
-    uint8_t* u = y + width * height;
-    uint8_t* v = u + width * height / 4;
-
-    return aipl_demosaic_yuv_planar(input, y, u, v, pitch,
-                                          width, height, filter);
+    const aipl_yuv_coefs_t* coefs =
+        aipl_colorimetry_coefs(AIPL_COLORIMETRY_BT601_LIMITED);
 
+    return aipl_demosaic_colorimetry_helium(input, output, pitch,
+                                            width, height, filter,
+                                            AIPL_COLOR_I420, coefs);
 }
 
 aipl_error_t aipl_demosaic_i422_helium(const void* input, void* output,
@@ -634,90 +847,304 @@ aipl_error_t aipl_demosaic_i422_helium(const void* input, void* output,
                                        uint32_t width, uint32_t height,
                                        aipl_bayer_filter_t filter)
 {
-    if (input == NULL || output == NULL)
+    const aipl_yuv_coefs_t* coefs =
+        aipl_colorimetry_coefs(AIPL_COLORIMETRY_BT601_LIMITED);
+
+    return aipl_demosaic_colorimetry_helium(input, output, pitch,
+                                            width, height, filter,
+                                            AIPL_COLOR_I422, coefs);
+}
+
+aipl_error_t aipl_demosaic_i444_helium(const void* input, void* output,
+                                       uint32_t pitch,
+                                       uint32_t width, uint32_t height,
+                                       aipl_bayer_filter_t filter)
+{
+    const aipl_yuv_coefs_t* coefs =
+        aipl_colorimetry_coefs(AIPL_COLORIMETRY_BT601_LIMITED);
+
+    return aipl_demosaic_colorimetry_helium(input, output, pitch,
+                                            width, height, filter,
+                                            AIPL_COLOR_I444, coefs);
+}
+
+aipl_error_t aipl_demosaic_i400_helium(const void* input, void* output,
+                                       uint32_t pitch,
+                                       uint32_t width, uint32_t height,
+                                       aipl_bayer_filter_t filter)
+{
+    const aipl_yuv_coefs_t* coefs =
+        aipl_colorimetry_coefs(AIPL_COLORIMETRY_BT601_LIMITED);
+
+    return aipl_demosaic_colorimetry_helium(input, output, pitch,
+                                            width, height, filter,
+                                            AIPL_COLOR_I400, coefs);
+}
+
+aipl_error_t aipl_demosaic_nv12_helium(const void* input, void* output,
+                                       uint32_t pitch,
+                                       uint32_t width, uint32_t height,
+                                       aipl_bayer_filter_t filter)
+{
+    const aipl_yuv_coefs_t* coefs =
+        aipl_colorimetry_coefs(AIPL_COLORIMETRY_BT601_LIMITED);
+
+    return aipl_demosaic_colorimetry_helium(input, output, pitch,
+                                            width, height, filter,
+                                            AIPL_COLOR_NV12, coefs);
+}
+
+aipl_error_t aipl_demosaic_nv21_helium(const void* input, void* output,
+                                       uint32_t pitch,
+                                       uint32_t width, uint32_t height,
+                                       aipl_bayer_filter_t filter)
+{
+    const aipl_yuv_coefs_t* coefs =
+        aipl_colorimetry_coefs(AIPL_COLORIMETRY_BT601_LIMITED);
+
+    return aipl_demosaic_colorimetry_helium(input, output, pitch,
+                                            width, height, filter,
+                                            AIPL_COLOR_NV21, coefs);
+}
+
+aipl_error_t aipl_demosaic_yuy2_helium(const void* input, void* output,
+                                       uint32_t pitch,
+                                       uint32_t width, uint32_t height,
+                                       aipl_bayer_filter_t filter)
+{
+    const aipl_yuv_coefs_t* coefs =
+        aipl_colorimetry_coefs(AIPL_COLORIMETRY_BT601_LIMITED);
+
+    return aipl_demosaic_colorimetry_helium(input, output, pitch,
+                                            width, height, filter,
+                                            AIPL_COLOR_YUY2, coefs);
+}
+
+aipl_error_t aipl_demosaic_uyvy_helium(const void* input, void* output,
+                                       uint32_t pitch,
+                                       uint32_t width, uint32_t height,
+                                       aipl_bayer_filter_t filter)
+{
+    const aipl_yuv_coefs_t* coefs =
+        aipl_colorimetry_coefs(AIPL_COLORIMETRY_BT601_LIMITED);
+
+    return aipl_demosaic_colorimetry_helium(input, output, pitch,
+                                            width, height, filter,
+                                            AIPL_COLOR_UYVY, coefs);
+}
+
+aipl_error_t aipl_demosaic_colorimetry_helium(const void* input, void* output,
+                                              uint32_t pitch,
+                                              uint32_t width, uint32_t height,
+                                              aipl_bayer_filter_t filter,
+                                              aipl_color_format_t format,
+                                              const aipl_yuv_coefs_t* coefs)
+{
+    if (input == NULL || output == NULL || coefs == NULL)
     {
         return AIPL_ERR_NULL_POINTER;
     }
 
     uint8_t* y = output;
-    uint8_t* u = y + width * height;
-    uint8_t* v = u + width * height / 2;
-
-    aipl_bayer_tile_t tile = aipl_bayer_tile(input, pitch, filter);
+    uint32_t size = width * height;
 
-    for (uint32_t i = 0; i < height - 1; ++i)
+    switch (format)
     {
-        uint8_t* y_dst = y + i * width;
-        uint8_t* u_dst = u + i * width / 2;
-        uint8_t* v_dst = v + i * width / 2;
+        case AIPL_COLOR_ALPHA8:
+        case AIPL_COLOR_I400:
+            return aipl_demosaic_yuv_luma(input, y, pitch,
+                                          width, height, filter, coefs);
+        case AIPL_COLOR_YV12:
+            return aipl_demosaic_yuv_planar(input, y,
+                                            y + size + size / 4, y + size,
+                                            pitch, width, height,
+                                            filter, coefs);
+        case AIPL_COLOR_I420:
+            return aipl_demosaic_yuv_planar(input, y,
+                                            y + size, y + size + size / 4,
+                                            pitch, width, height,
+                                            filter, coefs);
+        case AIPL_COLOR_I422:
+            return aipl_demosaic_yuv_422(input, y,
+                                         y + size, y + size + size / 2,
+                                         pitch, width, height,
+                                         filter, coefs);
+        case AIPL_COLOR_I444:
+            return aipl_demosaic_yuv_444(input, y,
+                                         y + size, y + size * 2,
+                                         pitch, width, height,
+                                         filter, coefs);
+        case AIPL_COLOR_NV12:
+            return aipl_demosaic_yuv_semi_planar(input, y,
+                                                 y + size, y + size + 1,
+                                                 pitch, width, height,
+                                                 filter, coefs);
+        case AIPL_COLOR_NV21:
+            return aipl_demosaic_yuv_semi_planar(input, y,
+                                                 y + size + 1, y + size,
+                                                 pitch, width, height,
+                                                 filter, coefs);
+        case AIPL_COLOR_YUY2:
+            return aipl_demosaic_yuv_packed(input, y, y + 1, y + 3,
+                                            pitch, width, height,
+                                            filter, coefs);
+        case AIPL_COLOR_UYVY:
+            return aipl_demosaic_yuv_packed(input, y + 1, y, y + 2,
+                                            pitch, width, height,
+                                            filter, coefs);
 
-        int32_t cnt = width / 2;
-        uint32_t j = 0;
-        for (; cnt > 0; cnt -= 8, j += 16)
-        {
-            mve_pred16_t tail_p = vctp16q(cnt);
+        default:
+            return aipl_demosaic_helium(input, output, pitch,
+                                        width, height, filter, format);
+    }
+}
 
-            aipl_mve_rgb_x8_t rgb0;
-            aipl_mve_rgb_x8_t rgb1;
+aipl_error_t aipl_demosaic_16bit_helium(const void* input, void* output,
+                                        uint32_t pitch,
+                                        uint32_t width, uint32_t height,
+                                        aipl_bayer_filter_t filter,
+                                        uint8_t bits,
+                                        aipl_color_format_t format)
+{
+    if (bits < 8 || bits > 16)
+    {
+        return AIPL_ERR_NOT_SUPPORTED;
+    }
 
-            aipl_bayer_to_rgb_x8(&rgb0, &rgb1, &tile, j, tail_p);
+    if (input == NULL || output == NULL)
+    {
+        return AIPL_ERR_NULL_POINTER;
+    }
 
-            uint16x8_t y_val0, y_val1;
+    aipl_demosaic_16bit_ctx_t ctx = {
+        .input = input,
+        .stride = pitch * 2,
+        .height = height,
+        .tile = aipl_bayer_tile(input, 0, filter),
+        .shift = bits - 8,
+    };
 
-            aipl_mve_cnvt_8px_xrgb8888_to_yuv_y(&y_val0, rgb0);
-            aipl_mve_cnvt_8px_xrgb8888_to_yuv_y(&y_val1, rgb1);
+    const aipl_yuv_coefs_t* coefs =
+        aipl_colorimetry_coefs(AIPL_COLORIMETRY_BT601_LIMITED);
 
-            uint8x16_t y_val = vmovntq(vreinterpretq_u8(y_val0), y_val1);
+    return aipl_demosaic_encode_default(output, width, height, format, coefs,
+                                        aipl_demosaic_16bit_source, &ctx);
+}
 
-            uint16x8_t u_val, v_val;
+aipl_error_t aipl_demosaic_corrected_helium(const void* input, void* output,
+                                            uint32_t pitch,
+                                            uint32_t width, uint32_t height,
+                                            aipl_bayer_filter_t filter,
+                                            const aipl_raw_correction_t* correction,
+                                            aipl_color_format_t format)
+{
+    if (input == NULL || output == NULL || correction == NULL)
+    {
+        return AIPL_ERR_NULL_POINTER;
+    }
 
-            aipl_mve_cnvt_8px_xrgb8888_to_yuv_u(&u_val, rgb0);
-            aipl_mve_cnvt_8px_xrgb8888_to_yuv_v(&v_val, rgb0);
+    if (width < 2 || height < 2)
+    {
+        return AIPL_ERR_FRAME_OUT_OF_RANGE;
+    }
 
-            vstrbq_p(u_dst + j / 2, u_val, tail_p);
-            vstrbq_p(v_dst + j / 2, v_val, tail_p);
+    if (correction->gains != NULL
+        && (correction->grid_width < 2 || correction->grid_height < 2))
+    {
+        return AIPL_ERR_NOT_SUPPORTED;
+    }
 
-            vstrbq_p(y_dst + j, y_val, tail_p);
-        }
+    aipl_bayer_tile_t tile = aipl_bayer_tile(input, 0, filter);
+
+    aipl_demosaic_corrected_ctx_t ctx = {
+        .input = input,
+        .pitch = pitch,
+        .width = width,
+        .height = height,
+        .red_row = tile.red_row,
+        .red_col = tile.red_col,
+        .corr = correction,
+        .x_step = ((correction->grid_width - 1) << 16) / (width - 1),
+        .y_step = ((correction->grid_height - 1) << 16) / (height - 1),
+        .white = aipl_raw_white_level(correction->channel_gains,
+                                      correction->clip_highlights),
+    };
+
+    const aipl_yuv_coefs_t* coefs =
+        aipl_colorimetry_coefs(AIPL_COLORIMETRY_BT601_LIMITED);
+
+    return aipl_demosaic_encode_default(output, width, height, format, coefs,
+                                        aipl_demosaic_corrected_source, &ctx);
+}
 
-        tile.red_src += (i + tile.blue_row) % 2 * pitch * 2;
-        tile.blue_src += (i + tile.red_row) % 2 * pitch * 2;
+aipl_error_t aipl_raw_white_balance_helium(const void* input, void* output,
+                                           uint32_t pitch,
+                                           uint32_t width, uint32_t height,
+                                           const uint16_t* gains,
+                                           bool clip_highlights)
+{
+    if (input == NULL || output == NULL || gains == NULL)
+    {
+        return AIPL_ERR_NULL_POINTER;
     }
 
-    memcpy(y + (height - 1) * width,
-           y + (height - 2) * width,
-           width);
-    memcpy(u + (height - 1) * width / 2,
-           u + (height - 2) * width / 2,
-           width / 2);
-    memcpy(v + (height - 1) * width / 2,
-           v + (height - 2) * width / 2,
-           width / 2);
+    uint16x8_t white_v = vdupq_n_u16(aipl_raw_white_level(gains,
+                                                          clip_highlights));
+
+    for (uint32_t i = 0; i < height; ++i)
+    {
+        const uint8_t* src = (const uint8_t*)input + i * pitch;
+        uint8_t* dst = (uint8_t*)output + i * width;
+
+        /* Even and odd columns are the bottom and top byte lanes */
+        uint16x8_t gain_even = vdupq_n_u16(gains[(i & 1) * 2]);
+        uint16x8_t gain_odd = vdupq_n_u16(gains[(i & 1) * 2 + 1]);
+
+        int32_t cnt = width;
+        for (; cnt > 0; cnt -= 16, src += 16, dst += 16)
+        {
+            mve_pred16_t tail_p = vctp8q(cnt);
+
+            uint8x16_t px = vldrbq_z_u8(src, tail_p);
+
+            /* Samples in 12.4 fixed point give a rounded 4.12 product */
+            uint16x8_t even = vrmulhq(vshllbq(px, 16 - AIPL_RAW_GAIN_BITS),
+                                      gain_even);
+            uint16x8_t odd = vrmulhq(vshlltq(px, 16 - AIPL_RAW_GAIN_BITS),
+                                     gain_odd);
+
+            even = vminq(even, white_v);
+            odd = vminq(odd, white_v);
+
+            uint8x16_t res = vqmovnbq(vuninitializedq_u8(), even);
+            res = vqmovntq(res, odd);
+
+            vstrbq_p(dst, res, tail_p);
+        }
+    }
 
     return AIPL_ERR_OK;
 }
 
-aipl_error_t aipl_demosaic_i444_helium(const void* input, void* output,
-                                       uint32_t pitch,
-                                       uint32_t width, uint32_t height,
-                                       aipl_bayer_filter_t filter)
+aipl_error_t aipl_demosaic_16bit_rgb16_helium(const void* input, void* output,
+                                              uint32_t pitch,
+                                              uint32_t width, uint32_t height,
+                                              aipl_bayer_filter_t filter)
 {
     if (input == NULL || output == NULL)
     {
         return AIPL_ERR_NULL_POINTER;
     }
 
-    uint8_t* y = output;
-    uint8_t* u = y + width * height;
-    uint8_t* v = u + width * height;
+    /* Tile pointers step over 16-bit samples */
+    aipl_bayer_tile_t tile = aipl_bayer_tile(input, pitch * 2, filter);
 
-    aipl_bayer_tile_t tile = aipl_bayer_tile(input, pitch, filter);
+    /* Every other pixel of the interleaved output */
+    uint16x8_t offsets = AIPL_OFFSETS_U16(6, 1);
 
     for (uint32_t i = 0; i < height - 1; ++i)
     {
-        uint8_t* y_dst = y + i * width;
-        uint8_t* u_dst = u + i * width;
-        uint8_t* v_dst = v + i * width;
+        uint16_t* dst = (uint16_t*)output + i * width * 3;
 
         int32_t cnt = width / 2;
         uint32_t j = 0;
@@ -728,112 +1155,204 @@ aipl_error_t aipl_demosaic_i444_helium(const void* input, void* output,
             aipl_mve_rgb_x8_t rgb0;
             aipl_mve_rgb_x8_t rgb1;
 
-            aipl_bayer_to_rgb_x8(&rgb0, &rgb1, &tile, j, tail_p);
-
-            uint16x8_t y_val0, y_val1;
+            aipl_bayer16_to_rgb_x8(&rgb0, &rgb1, &tile, j, tail_p);
 
-            aipl_mve_cnvt_8px_xrgb8888_to_yuv_y(&y_val0, rgb0);
-            aipl_mve_cnvt_8px_xrgb8888_to_yuv_y(&y_val1, rgb1);
+            uint16_t* px = dst + j * 3;
+            vstrhq_scatter_shifted_offset_p(px, offsets, rgb0.r, tail_p);
+            vstrhq_scatter_shifted_offset_p(px + 1, offsets, rgb0.g, tail_p);
+            vstrhq_scatter_shifted_offset_p(px + 2, offsets, rgb0.b, tail_p);
+            vstrhq_scatter_shifted_offset_p(px + 3, offsets, rgb1.r, tail_p);
+            vstrhq_scatter_shifted_offset_p(px + 4, offsets, rgb1.g, tail_p);
+            vstrhq_scatter_shifted_offset_p(px + 5, offsets, rgb1.b, tail_p);
+        }
 
-            uint8x16_t y_val = vmovntq(vreinterpretq_u8(y_val0), y_val1);
+        tile.red_src += (i + tile.blue_row) % 2 * pitch * 4;
+        tile.blue_src += (i + tile.red_row) % 2 * pitch * 4;
+    }
 
-            uint16x8_t u_val0, u_val1, v_val0, v_val1;
+    memcpy((uint16_t*)output + (height - 1) * width * 3,
+           (uint16_t*)output + (height - 2) * width * 3,
+           width * 3 * sizeof(uint16_t));
 
-            aipl_mve_cnvt_8px_xrgb8888_to_yuv_u(&u_val0, rgb0);
-            aipl_mve_cnvt_8px_xrgb8888_to_yuv_u(&u_val1, rgb1);
-            aipl_mve_cnvt_8px_xrgb8888_to_yuv_v(&v_val0, rgb0);
-            aipl_mve_cnvt_8px_xrgb8888_to_yuv_v(&v_val1, rgb1);
+    return AIPL_ERR_OK;
+}
 
-            uint8x16_t u_val = vmovntq(vreinterpretq_u8(u_val0), u_val1);
-            uint8x16_t v_val = vmovntq(vreinterpretq_u8(v_val0), v_val1);
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static uint8_t aipl_raw_white_level(const uint16_t* gains,
+                                    bool clip_highlights)
+{
+    if (gains == NULL || !clip_highlights)
+    {
+        return 255;
+    }
 
-            vstrbq_p(u_dst + j, u_val, tail_p);
-            vstrbq_p(v_dst + j, v_val, tail_p);
-            vstrbq_p(y_dst + j, y_val, tail_p);
-        }
+    /* Level reached by a saturated sample of the weakest channel */
+    uint32_t min = gains[0];
 
-        tile.red_src += (i + tile.blue_row) % 2 * pitch * 2;
-        tile.blue_src += (i + tile.red_row) % 2 * pitch * 2;
+    for (uint32_t c = 1; c < 4; ++c)
+    {
+        min = gains[c] < min ? gains[c] : min;
     }
 
-    memcpy(y + (height - 1) * width,
-           y + (height - 2) * width,
-           width);
-    memcpy(u + (height - 1) * width,
-           u + (height - 2) * width,
-           width);
-    memcpy(v + (height - 1) * width,
-           v + (height - 2) * width,
-           width);
+    uint32_t level = (255 * min + (1 << (AIPL_RAW_GAIN_BITS - 1)))
+                     >> AIPL_RAW_GAIN_BITS;
 
-    return AIPL_ERR_OK;
+    return level > 255 ? 255 : level;
 }
 
-aipl_error_t aipl_demosaic_i400_helium(const void* input, void* output,
-                                       uint32_t pitch,
-                                       uint32_t width, uint32_t height,
-                                       aipl_bayer_filter_t filter)
+static void aipl_raw_correct_row(uint8_t* dst,
+                                 const aipl_demosaic_corrected_ctx_t* ctx,
+                                 uint32_t row, uint32_t x, uint32_t count)
 {
-    return aipl_demosaic_alpha8_helium(input, output, pitch,
-                                       width, height, filter);
+    const aipl_raw_correction_t* corr = ctx->corr;
+    const uint8_t* src = ctx->input + row * ctx->pitch + x;
+    const uint8_t* black = corr->black_level;
+    const uint16_t* channel_gains = corr->channel_gains;
+    uint32_t ch_row = (row & 1) << 1;
 
-}
+    const uint32_t one = 1 << AIPL_RAW_GAIN_BITS;
 
-aipl_error_t aipl_demosaic_nv12_helium(const void* input, void* output,
-                                       uint32_t pitch,
-                                       uint32_t width, uint32_t height,
-                                       aipl_bayer_filter_t filter)
-{
-    uint8_t* y = output;
-    uint8_t* u = y + width * height;
-    uint8_t* v = u + 1;
+    if (corr->gains == NULL)
+    {
+        /* Even and odd columns of the run are the bottom and top byte lanes */
+        uint32_t ch_even = ch_row | (x & 1);
+        uint32_t ch_odd = ch_even ^ 1;
+
+        uint8x16_t black_v = vreinterpretq_u8_u16(
+            vdupq_n_u16(black[ch_even] | (black[ch_odd] << 8)));
+        uint16x8_t gain_even = vdupq_n_u16(channel_gains != NULL
+                                           ? channel_gains[ch_even] : one);
+        uint16x8_t gain_odd = vdupq_n_u16(channel_gains != NULL
+                                          ? channel_gains[ch_odd] : one);
+        uint16x8_t white_v = vdupq_n_u16(ctx->white);
+
+        int32_t cnt = count;
+        for (; cnt > 0; cnt -= 16, src += 16, dst += 16)
+        {
+            mve_pred16_t tail_p = vctp8q(cnt);
 
-    return aipl_demosaic_yuv_semi_planar(input, y, u, v, pitch,
-                                         width, height, filter);
-}
+            uint8x16_t px = vqsubq(vldrbq_z_u8(src, tail_p), black_v);
 
-aipl_error_t aipl_demosaic_nv21_helium(const void* input, void* output,
-                                       uint32_t pitch,
-                                       uint32_t width, uint32_t height,
-                                       aipl_bayer_filter_t filter)
-{
-    uint8_t* y = output;
-    uint8_t* v = y + width * height;
-    uint8_t* u = v + 1;
+            /* Samples in 12.4 fixed point give a rounded 4.12 product */
+            uint16x8_t even = vrmulhq(vshllbq(px, 16 - AIPL_RAW_GAIN_BITS),
+                                      gain_even);
+            uint16x8_t odd = vrmulhq(vshlltq(px, 16 - AIPL_RAW_GAIN_BITS),
+                                     gain_odd);
 
-    return aipl_demosaic_yuv_semi_planar(input, y, u, v, pitch,
-                                         width, height, filter);
-}
+            even = vminq(even, white_v);
+            odd = vminq(odd, white_v);
 
-aipl_error_t aipl_demosaic_yuy2_helium(const void* input, void* output,
-                                       uint32_t pitch,
-                                       uint32_t width, uint32_t height,
-                                       aipl_bayer_filter_t filter)
-{
-    uint8_t* y = output;
-    uint8_t* u = y + 1;
-    uint8_t* v = u + 2;
+            uint8x16_t res = vqmovnbq(vuninitializedq_u8(), even);
+            res = vqmovntq(res, odd);
+
+            vstrbq_p(dst, res, tail_p);
+        }
+
+        return;
+    }
 
-    return aipl_demosaic_yuv_packed(input, y, u, v, pitch,
-                                    width, height, filter);
+    /* Gain grid rows around the sample row */
+    uint32_t pos_y = row * ctx->y_step;
+    uint32_t gy = pos_y >> 16;
+    gy = gy < corr->grid_height - 1u ? gy : corr->grid_height - 2u;
+    uint32_t fy = (pos_y - (gy << 16)) >> (16 - AIPL_RAW_GAIN_BITS);
+
+    const uint16_t* top = corr->gains + gy * corr->grid_width * 4;
+    const uint16_t* bottom = top + corr->grid_width * 4;
+
+    /* Runs advance by whole quads, so the lane channels stay the same */
+    uint32x4_t ch = vorrq(vandq(vidupq_n_u32(x, 1), vdupq_n_u32(1)),
+                          vdupq_n_u32(ch_row));
+    uint32x4_t black_v = vldrbq_gather_offset_u32(black, ch);
+    uint32x4_t channel_gain = channel_gains != NULL
+                              ? vldrhq_gather_shifted_offset_u32(channel_gains,
+                                                                 ch)
+                              : vdupq_n_u32(one);
+    uint32x4_t grid_max = vdupq_n_u32(corr->grid_width - 2u);
+    uint32x4_t white_v = vdupq_n_u32(ctx->white);
+
+    int32_t cnt = count;
+    for (uint32_t j = 0; cnt > 0; cnt -= 4, j += 4)
+    {
+        mve_pred16_t tail_p = vctp32q(cnt);
+
+        uint32x4_t pos_x = vmulq_n_u32(vidupq_n_u32(x + j, 1), ctx->x_step);
+        uint32x4_t gx = vminq(vshrq(pos_x, 16), grid_max);
+        uint32x4_t fx = vshrq(vsubq(pos_x, vshlq_n(gx, 16)),
+                              16 - AIPL_RAW_GAIN_BITS);
+        uint32x4_t wx = vsubq(vdupq_n_u32(one), fx);
+        uint32x4_t idx = vaddq(vshlq_n(gx, 2), ch);
+
+        uint32x4_t t0 = vldrhq_gather_shifted_offset_z_u32(top, idx, tail_p);
+        uint32x4_t t4 = vldrhq_gather_shifted_offset_z_u32(top + 4, idx,
+                                                           tail_p);
+        uint32x4_t b0 = vldrhq_gather_shifted_offset_z_u32(bottom, idx,
+                                                           tail_p);
+        uint32x4_t b4 = vldrhq_gather_shifted_offset_z_u32(bottom + 4, idx,
+                                                           tail_p);
+
+        uint32x4_t gain_t = vrshrq(vaddq(vmulq(t0, wx), vmulq(t4, fx)),
+                                   AIPL_RAW_GAIN_BITS);
+        uint32x4_t gain_b = vrshrq(vaddq(vmulq(b0, wx), vmulq(b4, fx)),
+                                   AIPL_RAW_GAIN_BITS);
+        uint32x4_t gain = vrshrq(vaddq(vmulq_n_u32(gain_t, one - fy),
+                                       vmulq_n_u32(gain_b, fy)),
+                                 AIPL_RAW_GAIN_BITS);
+        gain = vrshrq(vmulq(gain, channel_gain), AIPL_RAW_GAIN_BITS);
+
+        uint32x4_t val = vqsubq(vldrbq_z_u32(src + j, tail_p), black_v);
+        val = vrshrq(vmulq(val, gain), AIPL_RAW_GAIN_BITS);
+        val = vminq(val, white_v);
+
+        vstrbq_p(dst + j, val, tail_p);
+    }
 }
 
-aipl_error_t aipl_demosaic_uyvy_helium(const void* input, void* output,
-                                       uint32_t pitch,
-                                       uint32_t width, uint32_t height,
-                                       aipl_bayer_filter_t filter)
+static void aipl_demosaic_corrected_source(aipl_argb8888_px_t* px,
+                                           uint32_t x, uint32_t y,
+                                           uint32_t count,
+                                           void* ctx)
 {
-    uint8_t* u = output;
-    uint8_t* y = u + 1;
-    uint8_t* v = u + 2;
+    const aipl_demosaic_corrected_ctx_t* cc = ctx;
+
+    /* The last row repeats the one above it */
+    uint32_t i = y < cc->height - 1 ? y : cc->height - 2;
+    uint32_t red_y = (i + cc->red_row) & 1;
 
-    return aipl_demosaic_yuv_packed(input, y, u, v, pitch,
-                                    width, height, filter);
+    /* Corrected samples of both window rows, one column past the run */
+    uint8_t rows[2][AIPL_DEMOSAIC_CHUNK + 1];
+
+    for (uint32_t k = 0; k < count; k += AIPL_DEMOSAIC_CHUNK)
+    {
+        uint32_t n = count - k < AIPL_DEMOSAIC_CHUNK ? count - k
+                                                     : AIPL_DEMOSAIC_CHUNK;
+
+        /* The last column repeats the one before it */
+        uint32_t first = x + k < cc->width - 1 ? x + k : cc->width - 2;
+        uint32_t last = x + k + n < cc->width ? x + k + n : cc->width - 1;
+
+        aipl_raw_correct_row(rows[0], cc, i, first, last - first + 1);
+        aipl_raw_correct_row(rows[1], cc, i + 1, first, last - first + 1);
+
+        for (uint32_t j = 0; j < n; ++j)
+        {
+            uint32_t c = x + k + j < cc->width - 1 ? x + k + j
+                                                   : cc->width - 2;
+            uint32_t red_x = (c + cc->red_col) & 1;
+
+            const uint8_t* red_src = rows[red_y] + c - first;
+            const uint8_t* blue_src = rows[red_y ^ 1] + c - first;
+
+            px[k + j].r = red_src[red_x];
+            px[k + j].g = (red_src[red_x ^ 1] + blue_src[red_x]) >> 1;
+            px[k + j].b = blue_src[red_x ^ 1];
+            px[k + j].a = 0xff;
+        }
+    }
 }
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
 static INLINE void aipl_bayer_to_rgb_x8(aipl_mve_rgb_x8_t* rgb0,
                                         aipl_mve_rgb_x8_t* rgb1,
                                         aipl_bayer_tile_t* tile,
@@ -917,6 +1436,59 @@ static INLINE void aipl_bayer_to_rgb_x16(aipl_mve_rgb_x16_t* rgb,
     rgb->g = vhaddq(gr, gb);
 }
 
+static aipl_error_t aipl_demosaic_yuv_luma(const void* input,
+                                           uint8_t* y,
+                                           uint32_t pitch,
+                                           uint32_t width,
+                                           uint32_t height,
+                                           aipl_bayer_filter_t filter,
+                                           const aipl_yuv_coefs_t* coefs)
+{
+    if (input == NULL || y == NULL)
+    {
+        return AIPL_ERR_NULL_POINTER;
+    }
+
+    aipl_bayer_tile_t tile = aipl_bayer_tile(input, pitch, filter);
+    const aipl_yuv_coefs_t yuv = *coefs;
+
+    for (uint32_t i = 0; i < height - 1; ++i)
+    {
+        uint8_t* dst = y + i * width;
+
+        int32_t cnt = width / 2;
+        uint32_t j = 0;
+        for (; cnt > 0; cnt -= 8, j += 16)
+        {
+            mve_pred16_t tail_p = vctp16q(cnt);
+
+            aipl_mve_rgb_x8_t rgb0;
+            aipl_mve_rgb_x8_t rgb1;
+
+            aipl_bayer_to_rgb_x8(&rgb0, &rgb1, &tile, j, tail_p);
+
+            uint16x8_t y_val0;
+            uint16x8_t y_val1;
+
+            aipl_mve_cnvt_8px_xrgb8888_to_yuv_y_coefs(&y_val0, rgb0, &yuv);
+            aipl_mve_cnvt_8px_xrgb8888_to_yuv_y_coefs(&y_val1, rgb1, &yuv);
+
+            uint8x16_t y_val = vmovntq(vreinterpretq_u8(y_val0), y_val1);
+
+            vstrbq_p(dst + j, y_val, tail_p);
+        }
+
+        tile.red_src += (i + tile.blue_row) % 2 * pitch * 2;
+        tile.blue_src += (i + tile.red_row) % 2 * pitch * 2;
+    }
+
+    memcpy(y + (height - 1) * width,
+           y + (height - 2) * width,
+           width);
+
+    return AIPL_ERR_OK;
+}
+
 static aipl_error_t aipl_demosaic_yuv_planar(const void* input,
                                              uint8_t* y,
                                              uint8_t* u,
@@ -924,7 +1496,8 @@ static aipl_error_t aipl_demosaic_yuv_planar(const void* input,
                                              uint32_t pitch,
                                              uint32_t width,
                                              uint32_t height,
-                                             aipl_bayer_filter_t filter)
+                                             aipl_bayer_filter_t filter,
+                                             const aipl_yuv_coefs_t* coefs)
 {
     if (input == NULL || y == NULL || u == NULL || v == NULL)
     {
@@ -932,6 +1505,7 @@ static aipl_error_t aipl_demosaic_yuv_planar(const void* input,
     }
 
     aipl_bayer_tile_t tile = aipl_bayer_tile(input, pitch, filter);
+    const aipl_yuv_coefs_t yuv = *coefs;
 
     for (uint32_t i = 0; i < height - 1; ++i)
     {
@@ -952,8 +1526,8 @@ static aipl_error_t aipl_demosaic_yuv_planar(const void* input,
 
             uint16x8_t y_val0, y_val1;
 
-            aipl_mve_cnvt_8px_xrgb8888_to_yuv_y(&y_val0, rgb0);
-            aipl_mve_cnvt_8px_xrgb8888_to_yuv_y(&y_val1, rgb1);
+            aipl_mve_cnvt_8px_xrgb8888_to_yuv_y_coefs(&y_val0, rgb0, &yuv);
+            aipl_mve_cnvt_8px_xrgb8888_to_yuv_y_coefs(&y_val1, rgb1, &yuv);
 
             uint8x16_t y_val = vmovntq(vreinterpretq_u8(y_val0), y_val1);
 
@@ -961,8 +1535,8 @@ static aipl_error_t aipl_demosaic_yuv_planar(const void* input,
             {
                 uint16x8_t u_val, v_val;
 
-                aipl_mve_cnvt_8px_xrgb8888_to_yuv_u(&u_val, rgb0);
-                aipl_mve_cnvt_8px_xrgb8888_to_yuv_v(&v_val, rgb0);
+                aipl_mve_cnvt_8px_xrgb8888_to_yuv_u_coefs(&u_val, rgb0, &yuv);
+                aipl_mve_cnvt_8px_xrgb8888_to_yuv_v_coefs(&v_val, rgb0, &yuv);
 
                 vstrbq_p(u_dst + j / 2, u_val, tail_p);
                 vstrbq_p(v_dst + j / 2, v_val, tail_p);
@@ -989,7 +1563,8 @@ static aipl_error_t aipl_demosaic_yuv_semi_planar(const void* input,
                                                   uint32_t pitch,
                                                   uint32_t width,
                                                   uint32_t height,
-                                                  aipl_bayer_filter_t filter)
+                                                  aipl_bayer_filter_t filter,
+                                                  const aipl_yuv_coefs_t* coefs)
 {
     if (input == NULL || y == NULL || u == NULL || v == NULL)
     {
@@ -997,6 +1572,7 @@ static aipl_error_t aipl_demosaic_yuv_semi_planar(const void* input,
     }
 
     aipl_bayer_tile_t tile = aipl_bayer_tile(input, pitch, filter);
+    const aipl_yuv_coefs_t yuv = *coefs;
 
     for (uint32_t i = 0; i < height - 1; ++i)
     {
@@ -1017,8 +1593,8 @@ static aipl_error_t aipl_demosaic_yuv_semi_planar(const void* input,
 
             uint16x8_t y_val0, y_val1;
 
-            aipl_mve_cnvt_8px_xrgb8888_to_yuv_y(&y_val0, rgb0);
-            aipl_mve_cnvt_8px_xrgb8888_to_yuv_y(&y_val1, rgb1);
+            aipl_mve_cnvt_8px_xrgb8888_to_yuv_y_coefs(&y_val0, rgb0, &yuv);
+            aipl_mve_cnvt_8px_xrgb8888_to_yuv_y_coefs(&y_val1, rgb1, &yuv);
 
             uint8x16_t y_val = vmovntq(vreinterpretq_u8(y_val0), y_val1);
 
@@ -1026,8 +1602,8 @@ static aipl_error_t aipl_demosaic_yuv_semi_planar(const void* input,
             {
                 uint16x8_t u_val, v_val;
 
-                aipl_mve_cnvt_8px_xrgb8888_to_yuv_u(&u_val, rgb0);
-                aipl_mve_cnvt_8px_xrgb8888_to_yuv_v(&v_val, rgb0);
+                aipl_mve_cnvt_8px_xrgb8888_to_yuv_u_coefs(&u_val, rgb0, &yuv);
+                aipl_mve_cnvt_8px_xrgb8888_to_yuv_v_coefs(&v_val, rgb0, &yuv);
 
                 vstrbq_scatter_offset_p(u_dst + j, AIPL_2_BYTE_OFFSETS_U16, u_val, tail_p);
                 vstrbq_scatter_offset_p(v_dst + j, AIPL_2_BYTE_OFFSETS_U16, v_val, tail_p);
@@ -1057,7 +1633,8 @@ static aipl_error_t aipl_demosaic_yuv_packed(const void* input,
                                              uint32_t pitch,
                                              uint32_t width,
                                              uint32_t height,
-                                             aipl_bayer_filter_t filter)
+                                             aipl_bayer_filter_t filter,
+                                             const aipl_yuv_coefs_t* coefs)
 {
     if (input == NULL || y == NULL || u == NULL || v == NULL)
     {
@@ -1065,6 +1642,7 @@ static aipl_error_t aipl_demosaic_yuv_packed(const void* input,
     }
 
     aipl_bayer_tile_t tile = aipl_bayer_tile(input, pitch, filter);
+    const aipl_yuv_coefs_t yuv = *coefs;
 
     for (uint32_t i = 0; i < height - 1; ++i)
     {
@@ -1085,15 +1663,15 @@ static aipl_error_t aipl_demosaic_yuv_packed(const void* input,
 
             uint16x8_t y_val0, y_val1;
 
-            aipl_mve_cnvt_8px_xrgb8888_to_yuv_y(&y_val0, rgb0);
-            aipl_mve_cnvt_8px_xrgb8888_to_yuv_y(&y_val1, rgb1);
+            aipl_mve_cnvt_8px_xrgb8888_to_yuv_y_coefs(&y_val0, rgb0, &yuv);
+            aipl_mve_cnvt_8px_xrgb8888_to_yuv_y_coefs(&y_val1, rgb1, &yuv);
 
             uint8x16_t y_val = vmovntq(vreinterpretq_u8(y_val0), y_val1);
 
             uint16x8_t u_val, v_val;
 
-            aipl_mve_cnvt_8px_xrgb8888_to_yuv_u(&u_val, rgb0);
-            aipl_mve_cnvt_8px_xrgb8888_to_yuv_v(&v_val, rgb0);
+            aipl_mve_cnvt_8px_xrgb8888_to_yuv_u_coefs(&u_val, rgb0, &yuv);
+            aipl_mve_cnvt_8px_xrgb8888_to_yuv_v_coefs(&v_val, rgb0, &yuv);
 
             vstrbq_scatter_offset_p(y_dst + j * 2, AIPL_2_BYTE_OFFSETS_U8, y_val, tail_p);
             vstrbq_scatter_offset_p(u_dst + j * 2, AIPL_4_BYTE_OFFSETS_U16, u_val, tail_p);
@@ -1112,4 +1690,148 @@ static aipl_error_t aipl_demosaic_yuv_packed(const void* input,
     return AIPL_ERR_OK;
 }
 
+static aipl_error_t aipl_demosaic_yuv_422(const void* input,
+                                          uint8_t* y,
+                                          uint8_t* u,
+                                          uint8_t* v,
+                                          uint32_t pitch,
+                                          uint32_t width,
+                                          uint32_t height,
+                                          aipl_bayer_filter_t filter,
+                                          const aipl_yuv_coefs_t* coefs)
+{
+    if (input == NULL || y == NULL || u == NULL || v == NULL)
+    {
+        return AIPL_ERR_NULL_POINTER;
+    }
+
+    aipl_bayer_tile_t tile = aipl_bayer_tile(input, pitch, filter);
+    const aipl_yuv_coefs_t yuv = *coefs;
+
+    for (uint32_t i = 0; i < height - 1; ++i)
+    {
+        uint8_t* y_dst = y + i * width;
+        uint8_t* u_dst = u + i * width / 2;
+        uint8_t* v_dst = v + i * width / 2;
+
+        int32_t cnt = width / 2;
+        uint32_t j = 0;
+        for (; cnt > 0; cnt -= 8, j += 16)
+        {
+            mve_pred16_t tail_p = vctp16q(cnt);
+
+            aipl_mve_rgb_x8_t rgb0;
+            aipl_mve_rgb_x8_t rgb1;
+
+            aipl_bayer_to_rgb_x8(&rgb0, &rgb1, &tile, j, tail_p);
+
+            uint16x8_t y_val0, y_val1;
+
+            aipl_mve_cnvt_8px_xrgb8888_to_yuv_y_coefs(&y_val0, rgb0, &yuv);
+            aipl_mve_cnvt_8px_xrgb8888_to_yuv_y_coefs(&y_val1, rgb1, &yuv);
+
+            uint8x16_t y_val = vmovntq(vreinterpretq_u8(y_val0), y_val1);
+
+            uint16x8_t u_val, v_val;
+
+            aipl_mve_cnvt_8px_xrgb8888_to_yuv_u_coefs(&u_val, rgb0, &yuv);
+            aipl_mve_cnvt_8px_xrgb8888_to_yuv_v_coefs(&v_val, rgb0, &yuv);
+
+            vstrbq_p(u_dst + j / 2, u_val, tail_p);
+            vstrbq_p(v_dst + j / 2, v_val, tail_p);
+
+            vstrbq_p(y_dst + j, y_val, tail_p);
+        }
+
+        tile.red_src += (i + tile.blue_row) % 2 * pitch * 2;
+        tile.blue_src += (i + tile.red_row) % 2 * pitch * 2;
+    }
+
+    memcpy(y + (height - 1) * width,
+           y + (height - 2) * width,
+           width);
+    memcpy(u + (height - 1) * width / 2,
+           u + (height - 2) * width / 2,
+           width / 2);
+    memcpy(v + (height - 1) * width / 2,
+           v + (height - 2) * width / 2,
+           width / 2);
+
+    return AIPL_ERR_OK;
+}
+
+static aipl_error_t aipl_demosaic_yuv_444(const void* input,
+                                          uint8_t* y,
+                                          uint8_t* u,
+                                          uint8_t* v,
+                                          uint32_t pitch,
+                                          uint32_t width,
+                                          uint32_t height,
+                                          aipl_bayer_filter_t filter,
+                                          const aipl_yuv_coefs_t* coefs)
+{
+    if (input == NULL || y == NULL || u == NULL || v == NULL)
+    {
+        return AIPL_ERR_NULL_POINTER;
+    }
+
+    aipl_bayer_tile_t tile = aipl_bayer_tile(input, pitch, filter);
+    const aipl_yuv_coefs_t yuv = *coefs;
+
+    for (uint32_t i = 0; i < height - 1; ++i)
+    {
+        uint8_t* y_dst = y + i * width;
+        uint8_t* u_dst = u + i * width;
+        uint8_t* v_dst = v + i * width;
+
+        int32_t cnt = width / 2;
+        uint32_t j = 0;
+        for (; cnt > 0; cnt -= 8, j += 16)
+        {
+            mve_pred16_t tail_p = vctp16q(cnt);
+
+            aipl_mve_rgb_x8_t rgb0;
+            aipl_mve_rgb_x8_t rgb1;
+
+            aipl_bayer_to_rgb_x8(&rgb0, &rgb1, &tile, j, tail_p);
+
+            uint16x8_t y_val0, y_val1;
+
+            aipl_mve_cnvt_8px_xrgb8888_to_yuv_y_coefs(&y_val0, rgb0, &yuv);
+            aipl_mve_cnvt_8px_xrgb8888_to_yuv_y_coefs(&y_val1, rgb1, &yuv);
+
+            uint8x16_t y_val = vmovntq(vreinterpretq_u8(y_val0), y_val1);
+
+            uint16x8_t u_val0, u_val1, v_val0, v_val1;
+
+            aipl_mve_cnvt_8px_xrgb8888_to_yuv_u_coefs(&u_val0, rgb0, &yuv);
+            aipl_mve_cnvt_8px_xrgb8888_to_yuv_u_coefs(&u_val1, rgb1, &yuv);
+            aipl_mve_cnvt_8px_xrgb8888_to_yuv_v_coefs(&v_val0, rgb0, &yuv);
+            aipl_mve_cnvt_8px_xrgb8888_to_yuv_v_coefs(&v_val1, rgb1, &yuv);
+
+            uint8x16_t u_val = vmovntq(vreinterpretq_u8(u_val0), u_val1);
+            uint8x16_t v_val = vmovntq(vreinterpretq_u8(v_val0), v_val1);
+
+            vstrbq_p(u_dst + j, u_val, tail_p);
+            vstrbq_p(v_dst + j, v_val, tail_p);
+            vstrbq_p(y_dst + j, y_val, tail_p);
+        }
+
+        tile.red_src += (i + tile.blue_row) % 2 * pitch * 2;
+        tile.blue_src += (i + tile.red_row) % 2 * pitch * 2;
+    }
+
+    memcpy(y + (height - 1) * width,
+           y + (height - 2) * width,
+           width);
+    memcpy(u + (height - 1) * width,
+           u + (height - 2) * width,
+           width);
+    memcpy(v + (height - 1) * width,
+           v + (height - 2) * width,
+           width);
+
+    return AIPL_ERR_OK;
+}
+
 #endif /* AIPL_HELIUM_ACCELERATION */
@@ -70,7 +70,7 @@ aipl_error_t aipl_flip_helium(const void* input, void* output,
     if (input == NULL || output == NULL)
         return AIPL_ERR_NULL_POINTER;
 
-    if (format >= AIPL_COLOR_YV12)
+    if (aipl_color_format_space(format) != AIPL_SPACE_RGB)
         return AIPL_ERR_UNSUPPORTED_FORMAT;
 
     const uint8_t* src = input;
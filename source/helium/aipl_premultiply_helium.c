@@ -0,0 +1,268 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/******************************************************************************
+ * @file    aipl_premultiply_helium.c
+ * @brief   Helium accelerated premultiplied alpha function implementations
+ *
+******************************************************************************/
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "aipl_premultiply_helium.h"
+
+#include <stddef.h>
+
+#include "aipl_mve_utils.h"
+#include "aipl_utils.h"
+
+#ifdef AIPL_HELIUM_ACCELERATION
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void aipl_premultiply_32bit_helium(const void* input, void* output,
+                                          uint32_t pitch,
+                                          uint32_t width, uint32_t height,
+                                          uint8_t a_shift, uint8_t c_shift);
+static void aipl_premultiply_16bit_helium(const void* input, void* output,
+                                          uint32_t pitch,
+                                          uint32_t width, uint32_t height,
+                                          uint8_t a_shift, uint8_t c_shift);
+static void aipl_unpremultiply_32bit_helium(const void* input, void* output,
+                                            uint32_t pitch,
+                                            uint32_t width, uint32_t height,
+                                            uint8_t a_shift, uint8_t c_shift);
+static void aipl_unpremultiply_16bit_helium(const void* input, void* output,
+                                            uint32_t pitch,
+                                            uint32_t width, uint32_t height,
+                                            uint8_t a_shift, uint8_t c_shift);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+aipl_error_t aipl_premultiply_argb8888_helium(const void* input, void* output,
+                                              uint32_t pitch,
+                                              uint32_t width, uint32_t height)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    aipl_premultiply_32bit_helium(input, output, pitch, width, height,
+                                  24, 0);
+
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_premultiply_rgba8888_helium(const void* input, void* output,
+                                              uint32_t pitch,
+                                              uint32_t width, uint32_t height)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    aipl_premultiply_32bit_helium(input, output, pitch, width, height,
+                                  0, 8);
+
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_premultiply_argb4444_helium(const void* input, void* output,
+                                              uint32_t pitch,
+                                              uint32_t width, uint32_t height)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    aipl_premultiply_16bit_helium(input, output, pitch, width, height,
+                                  12, 0);
+
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_unpremultiply_pargb8888_helium(const void* input, void* output,
+                                                 uint32_t pitch,
+                                                 uint32_t width, uint32_t height)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    aipl_unpremultiply_32bit_helium(input, output, pitch, width, height,
+                                    24, 0);
+
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_unpremultiply_prgba8888_helium(const void* input, void* output,
+                                                 uint32_t pitch,
+                                                 uint32_t width, uint32_t height)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    aipl_unpremultiply_32bit_helium(input, output, pitch, width, height,
+                                    0, 8);
+
+    return AIPL_ERR_OK;
+}
+
+aipl_error_t aipl_unpremultiply_pargb4444_helium(const void* input, void* output,
+                                                 uint32_t pitch,
+                                                 uint32_t width, uint32_t height)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    aipl_unpremultiply_16bit_helium(input, output, pitch, width, height,
+                                    12, 0);
+
+    return AIPL_ERR_OK;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void aipl_premultiply_32bit_helium(const void* input, void* output,
+                                          uint32_t pitch,
+                                          uint32_t width, uint32_t height,
+                                          uint8_t a_shift, uint8_t c_shift)
+{
+    const uint32_t* src_ptr = input;
+    uint32_t* dst_ptr = output;
+
+    for (uint32_t i = 0; i < height; ++i)
+    {
+        const uint32_t* src = src_ptr + (i * pitch);
+        uint32_t* dst = dst_ptr + (i * width);
+
+        for (int32_t cnt = width; cnt > 0; cnt -= 4)
+        {
+            mve_pred16_t tail_p = vctp32q(cnt);
+
+            uint32x4_t px = vld1q_z(src, tail_p);
+
+            aipl_mve_premultiply_x4(&px, a_shift, c_shift, 8);
+
+            vst1q_p(dst, px, tail_p);
+
+            src += 4;
+            dst += 4;
+        }
+    }
+}
+
+static void aipl_premultiply_16bit_helium(const void* input, void* output,
+                                          uint32_t pitch,
+                                          uint32_t width, uint32_t height,
+                                          uint8_t a_shift, uint8_t c_shift)
+{
+    const uint16_t* src_ptr = input;
+    uint16_t* dst_ptr = output;
+
+    for (uint32_t i = 0; i < height; ++i)
+    {
+        const uint16_t* src = src_ptr + (i * pitch);
+        uint16_t* dst = dst_ptr + (i * width);
+
+        for (int32_t cnt = width; cnt > 0; cnt -= 4)
+        {
+            mve_pred16_t tail_p = vctp32q(cnt);
+
+            uint32x4_t px = vldrhq_z_u32(src, tail_p);
+
+            aipl_mve_premultiply_x4(&px, a_shift, c_shift, 4);
+
+            vstrhq_p_u32(dst, px, tail_p);
+
+            src += 4;
+            dst += 4;
+        }
+    }
+}
+
+static void aipl_unpremultiply_32bit_helium(const void* input, void* output,
+                                            uint32_t pitch,
+                                            uint32_t width, uint32_t height,
+                                            uint8_t a_shift, uint8_t c_shift)
+{
+    const uint32_t* src_ptr = input;
+    uint32_t* dst_ptr = output;
+
+    for (uint32_t i = 0; i < height; ++i)
+    {
+        const uint32_t* src = src_ptr + (i * pitch);
+        uint32_t* dst = dst_ptr + (i * width);
+
+        for (int32_t cnt = width; cnt > 0; cnt -= 4)
+        {
+            mve_pred16_t tail_p = vctp32q(cnt);
+
+            uint32x4_t px = vld1q_z(src, tail_p);
+
+            aipl_mve_unpremultiply_x4(&px, aipl_unpremultiply_lut,
+                                      a_shift, c_shift, 8);
+
+            vst1q_p(dst, px, tail_p);
+
+            src += 4;
+            dst += 4;
+        }
+    }
+}
+
+static void aipl_unpremultiply_16bit_helium(const void* input, void* output,
+                                            uint32_t pitch,
+                                            uint32_t width, uint32_t height,
+                                            uint8_t a_shift, uint8_t c_shift)
+{
+    const uint16_t* src_ptr = input;
+    uint16_t* dst_ptr = output;
+
+    for (uint32_t i = 0; i < height; ++i)
+    {
+        const uint16_t* src = src_ptr + (i * pitch);
+        uint16_t* dst = dst_ptr + (i * width);
+
+        for (int32_t cnt = width; cnt > 0; cnt -= 4)
+        {
+            mve_pred16_t tail_p = vctp32q(cnt);
+
+            uint32x4_t px = vldrhq_z_u32(src, tail_p);
+
+            aipl_mve_unpremultiply_x4(&px, aipl_unpremultiply_lut,
+                                      a_shift, c_shift, 4);
+
+            vstrhq_p_u32(dst, px, tail_p);
+
+            src += 4;
+            dst += 4;
+        }
+    }
+}
+
+#endif
@@ -44,7 +44,7 @@ static aipl_error_t aipl_resize_sw_8bit_channels(const void* input, void* output
                                                  int input_pitch,
                                                  int input_width, int input_height,
                                                  int output_width, int output_height,
-                                                 aipl_color_format_t format);
+                                                 uint32_t pixel_size_B);
 static aipl_error_t aipl_resize_sw_argb1555(const void* input, void* output,
                                             int input_pitch,
                                             int input_width, int input_height,
@@ -53,6 +53,17 @@ static aipl_error_t aipl_resize_sw_rgba5551(const void* input, void* output,
                                             int input_pitch,
                                             int input_width, int input_height,
                                             int output_width, int output_height);
+static aipl_error_t aipl_resize_sw_y16(const void* input, void* output,
+                                       int input_pitch,
+                                       int input_width, int input_height,
+                                       int output_width, int output_height);
+static aipl_error_t aipl_resize_sw_semi_planar_422(const void* input,
+                                                   void* output,
+                                                   int input_pitch,
+                                                   int input_width,
+                                                   int input_height,
+                                                   int output_width,
+                                                   int output_height);
 #if !defined(AIPL_DAVE2D_ACCELERATION) || defined(AIPL_INCLUDE_ALL_HELIUM)
 static aipl_error_t aipl_resize_sw_4bit_channels(const void* input, void* output,
                                                  int input_pitch,
@@ -92,12 +103,21 @@ aipl_error_t aipl_resize_helium(const void* input, void* output,
         /* RGB color formats */
         case AIPL_COLOR_ARGB8888:
         case AIPL_COLOR_RGBA8888:
+        case AIPL_COLOR_BGRA8888:
+        case AIPL_COLOR_ABGR8888:
+        case AIPL_COLOR_XRGB8888:
+        case AIPL_COLOR_PARGB8888:
+        case AIPL_COLOR_PRGBA8888:
         case AIPL_COLOR_RGB888:
         case AIPL_COLOR_BGR888:
+        {
+            uint32_t pixel_size_B = aipl_color_format_depth(format) / 8;
+
             return aipl_resize_sw_8bit_channels(input, output, pitch,
                                                 width, height,
                                                 output_width, output_height,
-                                                format);
+                                                pixel_size_B);
+        }
         case AIPL_COLOR_ARGB1555:
             return aipl_resize_sw_argb1555(input, output, pitch,
                                            width, height,
@@ -109,6 +129,7 @@ aipl_error_t aipl_resize_helium(const void* input, void* output,
 #if !defined(AIPL_DAVE2D_ACCELERATION) || defined(AIPL_INCLUDE_ALL_HELIUM)
         case AIPL_COLOR_ARGB4444:
         case AIPL_COLOR_RGBA4444:
+        case AIPL_COLOR_PARGB4444:
             return aipl_resize_sw_4bit_channels(input, output, pitch,
                                                 width, height,
                                                 output_width, output_height);
@@ -118,6 +139,17 @@ aipl_error_t aipl_resize_helium(const void* input, void* output,
                                          output_width, output_height);
 #endif
 
+        /* YUV color formats */
+        case AIPL_COLOR_Y16:
+            return aipl_resize_sw_y16(input, output, pitch,
+                                      width, height,
+                                      output_width, output_height);
+        case AIPL_COLOR_NV16:
+        case AIPL_COLOR_NV61:
+            return aipl_resize_sw_semi_planar_422(input, output, pitch,
+                                                  width, height,
+                                                  output_width, output_height);
+
         default:
             return AIPL_ERR_UNSUPPORTED_FORMAT;
     }
@@ -150,13 +182,11 @@ static aipl_error_t aipl_resize_sw_8bit_channels(const void* input, void* output
                                                  int input_pitch,
                                                  int input_width, int input_height,
                                                  int output_width, int output_height,
-                                                 aipl_color_format_t format)
+                                                 uint32_t pixel_size_B)
 {
     if (input == NULL || output == NULL)
         return AIPL_ERR_NULL_POINTER;
 
-    const uint32_t pixel_size_B = aipl_color_format_depth(format)/8;
-
     const uint8_t* srcImage = (const uint8_t*)input;
     uint8_t* dstImage = (uint8_t*)output;
 
@@ -631,4 +661,118 @@ static aipl_error_t aipl_resize_sw_rgb565(const void* input, void* output,
 }
 #endif
 
+static aipl_error_t aipl_resize_sw_y16(const void* input, void* output,
+                                       int input_pitch,
+                                       int input_width, int input_height,
+                                       int output_width, int output_height)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    const uint16_t* srcImage = (const uint16_t*)input;
+    uint16_t* dstImage = (uint16_t*)output;
+
+    uint32_t src_x_accum, src_y_accum; // accumulators and fractions for scaling the image
+    uint32_t y_frac, ny_frac;
+    int x, y, ty;
+
+    if (input_height < 2) {
+        return AIPL_ERR_FRAME_OUT_OF_RANGE;
+    }
+
+#undef FRAC_BITS
+#define FRAC_BITS 14
+    const int FRAC_VAL = (1 << FRAC_BITS);
+    const int FRAC_MASK = (FRAC_VAL - 1);
+
+    // start at 1/2 pixel in to account for integer downsampling which might miss pixels
+    src_y_accum = FRAC_VAL / 2;
+    const uint32_t src_x_frac = (input_width * FRAC_VAL) / output_width;
+    const uint32_t src_y_frac = (input_height * FRAC_VAL) / output_height;
+
+    const uint16_t *s;
+    uint16_t *d;
+
+    for (y = 0; y < output_height; y++) {
+        // do indexing computations
+        ty = src_y_accum >> FRAC_BITS; // src y
+        y_frac = src_y_accum & FRAC_MASK;
+        ny_frac = FRAC_VAL - y_frac; // y fraction and 1.0 - y fraction
+        src_y_accum += src_y_frac;
+
+        s = &srcImage[ty * input_pitch];
+        d = &dstImage[y * output_width];
+        // start at 1/2 pixel in to account for integer downsampling which might miss pixels
+        src_x_accum = FRAC_VAL / 2;
+
+        // 16-bit samples times the 14-bit fractions need 32-bit lanes
+        for (x = 0; x < output_width; x += 4)
+        {
+            mve_pred16_t tail_p = vctp32q(output_width - x);
+
+            uint32x4_t offsets = vidupq_u32((uint32_t)0, 1);
+            offsets = vmulq(offsets, src_x_frac);
+            uint32x4_t tx = vaddq(vdupq_n_u32(src_x_accum), offsets);
+            uint32x4_t x_frac = vandq(tx, vdupq_n_u32(FRAC_MASK));
+            uint32x4_t nx_frac = vsubq(vdupq_n_u32(FRAC_VAL), x_frac);
+            uint32x4_t tx00 = vshlq_n(vshrq(tx, FRAC_BITS), 1);
+            uint32x4_t tx10 = vaddq(tx00, vdupq_n_u32(2));
+            uint32x4_t tx01 = vaddq(tx00, vdupq_n_u32(input_pitch * 2));
+            uint32x4_t tx11 = vaddq(tx01, vdupq_n_u32(2));
+
+            uint32x4_t p00 = vldrhq_gather_offset_z_u32(s, tx00, tail_p);
+            uint32x4_t p10 = vldrhq_gather_offset_z_u32(s, tx10, tail_p);
+            uint32x4_t p01 = vldrhq_gather_offset_z_u32(s, tx01, tail_p);
+            uint32x4_t p11 = vldrhq_gather_offset_z_u32(s, tx11, tail_p);
+
+            INTERPOLATE_CHANNEL_MVE(p00, p10, nx_frac, x_frac);
+            INTERPOLATE_CHANNEL_MVE(p01, p11, nx_frac, x_frac);
+            p00 = vmulq(p00, ny_frac);
+            p00 = vmlaq_n_u32(p00, p01, y_frac);
+            p00 = vrshrq(p00, FRAC_BITS);
+
+            vstrhq_p_u32(d, p00, tail_p);
+
+            d += 4;
+            src_x_accum += src_x_frac * 4;
+        }
+    }
+    return AIPL_ERR_OK;
+}
+
+static aipl_error_t aipl_resize_sw_semi_planar_422(const void* input,
+                                                   void* output,
+                                                   int input_pitch,
+                                                   int input_width,
+                                                   int input_height,
+                                                   int output_width,
+                                                   int output_height)
+{
+    if (input == NULL || output == NULL)
+        return AIPL_ERR_NULL_POINTER;
+
+    // Chroma pairs can't be split horizontally
+    if ((input_pitch & 1) || (input_width & 1) || (output_width & 1))
+        return AIPL_ERR_FRAME_OUT_OF_RANGE;
+
+    const uint8_t* src = (const uint8_t*)input;
+    uint8_t* dst = (uint8_t*)output;
+
+    // Luma is resized as a single channel plane
+    aipl_error_t ret = aipl_resize_sw_8bit_channels(src, dst, input_pitch,
+                                                    input_width, input_height,
+                                                    output_width, output_height,
+                                                    1);
+    if (ret != AIPL_ERR_OK)
+        return ret;
+
+    // Full height interleaved chroma is resized as a two channel plane
+    return aipl_resize_sw_8bit_channels(src + input_pitch * input_height,
+                                        dst + output_width * output_height,
+                                        input_pitch / 2,
+                                        input_width / 2, input_height,
+                                        output_width / 2, output_height,
+                                        2);
+}
+
 #endif
@@ -58,7 +58,7 @@
     if (input == NULL || output == NULL)
         return AIPL_ERR_NULL_POINTER;
 
-    if (format >= AIPL_COLOR_YV12)
+    if (aipl_color_format_space(format) != AIPL_SPACE_RGB)
         return AIPL_ERR_UNSUPPORTED_FORMAT;
 
     const int rgbBytes = aipl_color_format_depth(format)/8;
@@ -0,0 +1,80 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/******************************************************************************
+ * @file    aipl_test.c
+ * @brief   Validation test support functions
+ *
+******************************************************************************/
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "aipl_test.h"
+
+#include "aipl_cache.h"
+#include "aipl_config.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+uint32_t aipl_test_failures;
+
+void aipl_test_fill(void* buf, uint32_t size, uint32_t seed)
+{
+    uint8_t* dst = buf;
+    uint32_t state = seed * 2654435761u + 1;
+
+    for (uint32_t i = 0; i < size; ++i)
+    {
+        /* Numerical Recipes LCG, top byte only */
+        state = state * 1664525u + 1013904223u;
+        dst[i] = state >> 24;
+    }
+}
+
+#if defined(AIPL_TESTS_HOST) && AIPL_CUSTOM_CACHE
+/* Host memory is coherent, the cache functions have nothing to do */
+void aipl_cpu_cache_clean(const void* ptr, uint32_t size)
+{
+    (void)ptr;
+    (void)size;
+}
+
+void aipl_cpu_cache_invalidate(const void* ptr, uint32_t size)
+{
+    (void)ptr;
+    (void)size;
+}
+#endif
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
@@ -0,0 +1,92 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/******************************************************************************
+ * @file    aipl_test.h
+ * @brief   Minimal check macros shared by the validation tests
+ *
+******************************************************************************/
+
+#ifndef AIPL_TEST_H
+#define AIPL_TEST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+#include <stdio.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+/* Number of failed checks of the running test */
+extern uint32_t aipl_test_failures;
+
+/**
+ * Fill a buffer with a reproducible pseudo-random byte pattern
+ *
+ * @param buf   buffer pointer
+ * @param size  buffer size
+ * @param seed  pattern seed
+ */
+void aipl_test_fill(void* buf, uint32_t size, uint32_t seed);
+
+/**********************
+ *      MACROS
+ **********************/
+/* Record a failure with its location when the condition is false */
+#define AIPL_TEST_CHECK(cond) \
+    do \
+    { \
+        if (!(cond)) \
+        { \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            ++aipl_test_failures; \
+        } \
+    } while (0)
+
+/* Check two integer values and print both on mismatch */
+#define AIPL_TEST_CHECK_EQ(actual, expected) \
+    do \
+    { \
+        long aipl_test_a = (long)(actual); \
+        long aipl_test_e = (long)(expected); \
+        if (aipl_test_a != aipl_test_e) \
+        { \
+            printf("%s:%d: %s is %ld, expected %ld\n", __FILE__, __LINE__, \
+                   #actual, aipl_test_a, aipl_test_e); \
+            ++aipl_test_failures; \
+        } \
+    } while (0)
+
+/* Print the test result and turn it into the process exit code */
+#define AIPL_TEST_RESULT(name) \
+    (printf("%s: %s (%u failed checks)\n", name, \
+            aipl_test_failures ? "FAILED" : "PASSED", \
+            (unsigned)aipl_test_failures), \
+     aipl_test_failures ? 1 : 0)
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif  /* AIPL_TEST_H */
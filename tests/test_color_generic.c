@@ -0,0 +1,390 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/******************************************************************************
+ * @file    test_color_generic.c
+ * @brief   Generic color conversion engine chroma subsampling validation
+ *
+ * Subsampled chroma is checked against the average of the full resolution
+ * I444 chroma of its block. Odd image sizes must keep the plane layout of
+ * the dedicated converters and stay within the size aipl_image allocates.
+ * RGB converted to YUV and back must stay within 2 levels for every
+ * colorimetry. Multi-output conversion is checked against single
+ * conversions
+ *
+******************************************************************************/
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <string.h>
+
+#include "aipl_color_conversion.h"
+#include "aipl_config.h"
+#include "aipl_video_alloc.h"
+#include "aipl_test.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define TEST_GUARD          16
+#define TEST_GUARD_VALUE    0xa5
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    uint32_t width;
+    uint32_t height;
+} test_size_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if AIPL_CONVERT_GENERIC
+static uint8_t test_chroma_average(const uint8_t* plane, uint32_t width,
+                                   uint32_t height, uint32_t x, uint32_t y,
+                                   uint32_t x_shift, uint32_t y_shift);
+
+static void test_generic_size(const test_size_t* size);
+
+static void test_check_guard(const uint8_t* guard, uint32_t size);
+
+static void test_dedicated_size(const test_size_t* size);
+
+static void test_colorimetry_round_trip(void);
+#endif
+
+static void test_multi(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if AIPL_CONVERT_GENERIC
+static const test_size_t test_sizes[] = {
+    { 8, 4 },
+    { 5, 3 },
+    { 37, 7 },
+    { 1, 1 },
+};
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+int main(void)
+{
+#if AIPL_CONVERT_GENERIC
+    for (uint32_t s = 0; s < sizeof(test_sizes) / sizeof(test_sizes[0]); ++s)
+    {
+        test_generic_size(&test_sizes[s]);
+        test_dedicated_size(&test_sizes[s]);
+    }
+
+    test_colorimetry_round_trip();
+#endif
+
+    test_multi();
+
+    return AIPL_TEST_RESULT("test_color_generic");
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+#if AIPL_CONVERT_GENERIC
+static uint8_t test_chroma_average(const uint8_t* plane, uint32_t width,
+                                   uint32_t height, uint32_t x, uint32_t y,
+                                   uint32_t x_shift, uint32_t y_shift)
+{
+    uint32_t sum = 0;
+    uint32_t n = 0;
+
+    for (uint32_t j = y << y_shift; j < ((y + 1) << y_shift) && j < height; ++j)
+    {
+        for (uint32_t i = x << x_shift; i < ((x + 1) << x_shift) && i < width; ++i)
+        {
+            sum += plane[j * width + i];
+            ++n;
+        }
+    }
+
+    return (sum + n / 2) / n;
+}
+
+static void test_generic_size(const test_size_t* size)
+{
+    uint32_t w = size->width;
+    uint32_t h = size->height;
+    uint32_t uv_w = w / 2;
+    uint32_t uv_h = h / 2;
+    uint32_t buf_size = w * h * 2 + TEST_GUARD;
+
+    uint8_t* input = aipl_video_alloc(w * h * 4);
+    uint8_t* i444 = aipl_video_alloc(w * h * 3);
+    uint8_t* output = aipl_video_alloc(buf_size);
+
+    aipl_test_fill(input, w * h * 4, w * h);
+
+    AIPL_TEST_CHECK_EQ(aipl_color_convert_generic(input, i444, w, w, h,
+                                                  AIPL_COLOR_ARGB8888,
+                                                  AIPL_COLOR_I444),
+                       AIPL_ERR_OK);
+    const uint8_t* u444 = i444 + w * h;
+    const uint8_t* v444 = u444 + w * h;
+
+    /* I420: planes of whole 2x2 blocks, V a quarter of
+       the luma size after U like aipl_image allocates them */
+    memset(output, TEST_GUARD_VALUE, buf_size);
+    AIPL_TEST_CHECK_EQ(aipl_color_convert_generic(input, output, w, w, h,
+                                                  AIPL_COLOR_ARGB8888,
+                                                  AIPL_COLOR_I420),
+                       AIPL_ERR_OK);
+    AIPL_TEST_CHECK(memcmp(output, i444, w * h) == 0);
+    test_check_guard(output + w * h * 3 / 2, buf_size - w * h * 3 / 2);
+
+    for (uint32_t y = 0; y < uv_h; ++y)
+    {
+        for (uint32_t x = 0; x < uv_w; ++x)
+        {
+            const uint8_t* u = output + w * h + y * uv_w + x;
+            const uint8_t* v = output + w * h + w * h / 4 + y * uv_w + x;
+
+            AIPL_TEST_CHECK_EQ(*u, test_chroma_average(u444, w, h, x, y, 1, 1));
+            AIPL_TEST_CHECK_EQ(*v, test_chroma_average(v444, w, h, x, y, 1, 1));
+        }
+    }
+
+    /* NV12: interleaved chroma rows of the luma row size */
+    memset(output, TEST_GUARD_VALUE, buf_size);
+    AIPL_TEST_CHECK_EQ(aipl_color_convert_generic(input, output, w, w, h,
+                                                  AIPL_COLOR_ARGB8888,
+                                                  AIPL_COLOR_NV12),
+                       AIPL_ERR_OK);
+    test_check_guard(output + w * h * 3 / 2, buf_size - w * h * 3 / 2);
+
+    for (uint32_t y = 0; y < uv_h; ++y)
+    {
+        for (uint32_t x = 0; x < uv_w; ++x)
+        {
+            const uint8_t* uv = output + w * h + y * w + x * 2;
+
+            AIPL_TEST_CHECK_EQ(uv[0], test_chroma_average(u444, w, h, x, y, 1, 1));
+            AIPL_TEST_CHECK_EQ(uv[1], test_chroma_average(v444, w, h, x, y, 1, 1));
+        }
+    }
+
+    /* YUY2: two bytes per pixel, whole macropixels carry chroma */
+    memset(output, TEST_GUARD_VALUE, buf_size);
+    AIPL_TEST_CHECK_EQ(aipl_color_convert_generic(input, output, w, w, h,
+                                                  AIPL_COLOR_ARGB8888,
+                                                  AIPL_COLOR_YUY2),
+                       AIPL_ERR_OK);
+    test_check_guard(output + w * h * 2, TEST_GUARD);
+
+    for (uint32_t y = 0; y < h; ++y)
+    {
+        for (uint32_t x = 0; x < w; ++x)
+        {
+            AIPL_TEST_CHECK_EQ(output[(y * w + x) * 2], i444[y * w + x]);
+        }
+
+        for (uint32_t x = 0; x < uv_w; ++x)
+        {
+            const uint8_t* px = output + (y * w + x * 2) * 2;
+
+            AIPL_TEST_CHECK_EQ(px[1], test_chroma_average(u444, w, h, x, y, 1, 0));
+            AIPL_TEST_CHECK_EQ(px[3], test_chroma_average(v444, w, h, x, y, 1, 0));
+        }
+    }
+
+    aipl_video_free(input);
+    aipl_video_free(i444);
+    aipl_video_free(output);
+}
+
+static void test_check_guard(const uint8_t* guard, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; ++i)
+    {
+        if (guard[i] != TEST_GUARD_VALUE)
+        {
+            printf("write past the end of the image at %u\n", (unsigned)i);
+            ++aipl_test_failures;
+            return;
+        }
+    }
+}
+
+static void test_dedicated_size(const test_size_t* size)
+{
+    static const aipl_color_format_t formats[] = {
+        AIPL_COLOR_I420, AIPL_COLOR_YV12, AIPL_COLOR_I422, AIPL_COLOR_NV12
+    };
+    uint32_t w = size->width;
+    uint32_t h = size->height;
+    uint32_t buf_size = w * h * 2 + TEST_GUARD;
+
+    uint32_t* input = aipl_video_alloc(w * h * 4);
+    uint8_t* expected = aipl_video_alloc(buf_size);
+    uint8_t* output = aipl_video_alloc(buf_size);
+
+    /* One color per 2x2 block, so that the averaged chroma of the
+       engine and the sampled chroma of the dedicated converters agree */
+    for (uint32_t y = 0; y < h; ++y)
+    {
+        for (uint32_t x = 0; x < w; ++x)
+        {
+            input[y * w + x] = 0xff000000u
+                               | ((x / 2 * 53 + y / 2 * 31) & 0xff) << 16
+                               | ((x / 2 * 97 + 40) & 0xff) << 8
+                               | ((y / 2 * 71 + 200) & 0xff);
+        }
+    }
+
+    for (uint32_t f = 0; f < sizeof(formats) / sizeof(formats[0]); ++f)
+    {
+        uint32_t out_size = w * h * aipl_color_format_depth(formats[f]) / 8;
+
+        memset(expected, TEST_GUARD_VALUE, buf_size);
+        memset(output, TEST_GUARD_VALUE, buf_size);
+
+        AIPL_TEST_CHECK_EQ(aipl_color_convert(input, expected, w, w, h,
+                                              AIPL_COLOR_ARGB8888,
+                                              formats[f]),
+                           AIPL_ERR_OK);
+        AIPL_TEST_CHECK_EQ(aipl_color_convert_generic(input, output, w, w, h,
+                                                      AIPL_COLOR_ARGB8888,
+                                                      formats[f]),
+                           AIPL_ERR_OK);
+
+        if (memcmp(output, expected, buf_size) != 0)
+        {
+            printf("%ux%u %s layout differs from the dedicated converter\n",
+                   (unsigned)w, (unsigned)h,
+                   aipl_color_format_str(formats[f]));
+            ++aipl_test_failures;
+        }
+        test_check_guard(output + out_size, buf_size - out_size);
+    }
+
+    aipl_video_free(input);
+    aipl_video_free(expected);
+    aipl_video_free(output);
+}
+
+static void test_colorimetry_round_trip(void)
+{
+    const uint32_t w = 256;
+    const uint32_t h = 16;
+
+    uint8_t* input = aipl_video_alloc(w * h * 4);
+    uint8_t* yuv = aipl_video_alloc(w * h * 3);
+    uint8_t* output = aipl_video_alloc(w * h * 4);
+
+    /* Steps coprime to 256 cover every level of each channel */
+    for (uint32_t i = 0; i < w * h; ++i)
+    {
+        input[i * 4] = i * 37;
+        input[i * 4 + 1] = i * 91;
+        input[i * 4 + 2] = i * 13 + 7;
+        input[i * 4 + 3] = 0xff;
+    }
+
+    for (uint32_t c = 0; c < AIPL_COLORIMETRY_NUM; ++c)
+    {
+        uint32_t max_error = 0;
+
+        AIPL_TEST_CHECK_EQ(aipl_color_convert_colorimetry(input, yuv, w, w, h,
+                                                          AIPL_COLOR_ARGB8888,
+                                                          AIPL_COLOR_I444, c),
+                           AIPL_ERR_OK);
+        AIPL_TEST_CHECK_EQ(aipl_color_convert_colorimetry(yuv, output, w, w, h,
+                                                          AIPL_COLOR_I444,
+                                                          AIPL_COLOR_ARGB8888, c),
+                           AIPL_ERR_OK);
+
+        for (uint32_t i = 0; i < w * h * 4; ++i)
+        {
+            /* Alpha is not carried by YUV */
+            if ((i & 3) == 3)
+                continue;
+
+            uint32_t error = input[i] > output[i] ? input[i] - output[i]
+                                                  : output[i] - input[i];
+            if (error > max_error)
+                max_error = error;
+        }
+
+        if (max_error > 2)
+        {
+            printf("colorimetry %u round trip error %u\n",
+                   (unsigned)c, (unsigned)max_error);
+            ++aipl_test_failures;
+        }
+    }
+
+    aipl_video_free(input);
+    aipl_video_free(yuv);
+    aipl_video_free(output);
+}
+#endif
+
+static void test_multi(void)
+{
+    static const aipl_color_format_t formats[] = {
+        AIPL_COLOR_I420, AIPL_COLOR_RGB565, AIPL_COLOR_I400, AIPL_COLOR_YUY2
+    };
+    const uint32_t w = 38;
+    const uint32_t h = 6;
+    const uint32_t num = sizeof(formats) / sizeof(formats[0]);
+
+    uint8_t* input = aipl_video_alloc(w * h * 4);
+    uint8_t* expected = aipl_video_alloc(w * h * 2);
+    aipl_color_output_t outputs[sizeof(formats) / sizeof(formats[0])];
+
+    aipl_test_fill(input, w * h * 4, 7);
+
+    for (uint32_t o = 0; o < num; ++o)
+    {
+        outputs[o].data = aipl_video_alloc(w * h * 2);
+        outputs[o].format = formats[o];
+    }
+
+    AIPL_TEST_CHECK_EQ(aipl_color_convert_multi(input, w, w, h,
+                                                AIPL_COLOR_ARGB8888,
+                                                outputs, num),
+                       AIPL_ERR_OK);
+
+    for (uint32_t o = 0; o < num; ++o)
+    {
+        uint32_t size = w * h * aipl_color_format_depth(formats[o]) / 8;
+
+        AIPL_TEST_CHECK_EQ(aipl_color_convert(input, expected, w, w, h,
+                                              AIPL_COLOR_ARGB8888,
+                                              formats[o]),
+                           AIPL_ERR_OK);
+        if (memcmp(outputs[o].data, expected, size) != 0)
+        {
+            printf("multi-output %s differs from single conversion\n",
+                   aipl_color_format_str(formats[o]));
+            ++aipl_test_failures;
+        }
+
+        aipl_video_free(outputs[o].data);
+    }
+
+    aipl_video_free(input);
+    aipl_video_free(expected);
+}
@@ -0,0 +1,592 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/******************************************************************************
+ * @file    test_demosaic.c
+ * @brief   Demosaicing known-answer validation on small synthetic RGGB frames
+ *
+ * Defective pixel correction is checked on a flat frame with a hot and a dead
+ * sample. Area and bilinear resizing are checked against hand computed
+ * values of a frame with per-quad gradients. The ROI is checked with an odd
+ * left and top, which starts on the opposite filter phase. Statistics are
+ * checked on a frame with a horizontal green ramp. Planar output with a
+ * different pitch per plane is checked against RGB888P. Raw correction is
+ * checked with a gain grid of one point per column and with clipped
+ * channel gains
+ *
+******************************************************************************/
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <string.h>
+
+#include "aipl_demosaic.h"
+#include "aipl_utils.h"
+#include "aipl_video_alloc.h"
+#include "aipl_test.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define TEST_WIDTH  8
+#define TEST_HEIGHT 4
+#define TEST_PITCH  10
+
+/* aipl_demosaic() reads one sample past the last raw row */
+#define TEST_RAW_SIZE   (TEST_WIDTH * TEST_HEIGHT + 1)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void test_set_quad(uint8_t* raw, uint32_t pitch,
+                          uint32_t qx, uint32_t qy,
+                          uint8_t r, uint8_t g1, uint8_t g2, uint8_t b);
+
+static void test_fill_flat(uint8_t* raw, uint32_t pitch,
+                           uint32_t width, uint32_t height);
+
+static void test_fill_gradient(uint8_t* raw);
+
+static void test_check_px(const aipl_argb8888_px_t* px,
+                          uint8_t r, uint8_t g, uint8_t b);
+
+static void test_dpc(void);
+
+static void test_resize(void);
+
+static void test_roi(void);
+
+static void test_stats(void);
+
+static void test_planar(void);
+
+static void test_corrected(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+int main(void)
+{
+    test_dpc();
+    test_resize();
+    test_roi();
+    test_stats();
+    test_planar();
+    test_corrected();
+
+    return AIPL_TEST_RESULT("test_demosaic");
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static void test_set_quad(uint8_t* raw, uint32_t pitch,
+                          uint32_t qx, uint32_t qy,
+                          uint8_t r, uint8_t g1, uint8_t g2, uint8_t b)
+{
+    uint8_t* red_row = raw + 2 * qy * pitch + 2 * qx;
+    uint8_t* blue_row = red_row + pitch;
+
+    red_row[0] = r;
+    red_row[1] = g1;
+    blue_row[0] = g2;
+    blue_row[1] = b;
+}
+
+static void test_fill_flat(uint8_t* raw, uint32_t pitch,
+                           uint32_t width, uint32_t height)
+{
+    for (uint32_t qy = 0; qy < height / 2; ++qy)
+    {
+        for (uint32_t qx = 0; qx < width / 2; ++qx)
+        {
+            test_set_quad(raw, pitch, qx, qy, 100, 60, 60, 20);
+        }
+    }
+}
+
+/*
+ * 4x2 quads with R = 20 + 20 * qx + 100 * qy, G1 = 30 + 10 * qx,
+ * G2 = G1 + 2 and B = 200 - 30 * qx - 50 * qy
+ */
+static void test_fill_gradient(uint8_t* raw)
+{
+    for (uint32_t qy = 0; qy < TEST_HEIGHT / 2; ++qy)
+    {
+        for (uint32_t qx = 0; qx < TEST_WIDTH / 2; ++qx)
+        {
+            test_set_quad(raw, TEST_WIDTH, qx, qy,
+                          20 + 20 * qx + 100 * qy, 30 + 10 * qx,
+                          32 + 10 * qx, 200 - 30 * qx - 50 * qy);
+        }
+    }
+}
+
+static void test_check_px(const aipl_argb8888_px_t* px,
+                          uint8_t r, uint8_t g, uint8_t b)
+{
+    AIPL_TEST_CHECK_EQ(px->r, r);
+    AIPL_TEST_CHECK_EQ(px->g, g);
+    AIPL_TEST_CHECK_EQ(px->b, b);
+}
+
+static void test_dpc(void)
+{
+    static const aipl_demosaic_mode_t modes[] = {
+        AIPL_DEMOSAIC_QUAD, AIPL_DEMOSAIC_BILINEAR, AIPL_DEMOSAIC_MHC
+    };
+    const uint32_t w = 8;
+    const uint32_t h = 8;
+
+    uint8_t* raw = aipl_video_alloc(w * h);
+    aipl_argb8888_px_t* output = aipl_video_alloc(w * h * 4);
+
+    /* A hot green and a dead red sample are replaced by their neighbors */
+    for (uint32_t m = 0; m < sizeof(modes) / sizeof(modes[0]); ++m)
+    {
+        test_fill_flat(raw, w, w, h);
+        raw[2 * w + 3] = 250;
+        raw[4 * w + 4] = 0;
+
+        memset(output, 0, w * h * 4);
+        AIPL_TEST_CHECK_EQ(aipl_demosaic_dpc(raw, output, w, w, h,
+                                             AIPL_BAYER_RGGB, modes[m], 16,
+                                             AIPL_COLOR_ARGB8888),
+                           AIPL_ERR_OK);
+
+        for (uint32_t i = 0; i < w * h; ++i)
+        {
+            test_check_px(&output[i], 100, 60, 20);
+        }
+    }
+
+    /*
+     * A green sample within the threshold is kept. Each 2x2 window that
+     * contains it averages it with one flat green sample, the mirrored
+     * last row included
+     */
+    test_fill_flat(raw, w, w, h);
+    raw[6 * w + 1] = 70;
+
+    memset(output, 0, w * h * 4);
+    AIPL_TEST_CHECK_EQ(aipl_demosaic_dpc(raw, output, w, w, h,
+                                         AIPL_BAYER_RGGB, AIPL_DEMOSAIC_QUAD,
+                                         16, AIPL_COLOR_ARGB8888),
+                       AIPL_ERR_OK);
+
+    for (uint32_t y = 0; y < h; ++y)
+    {
+        for (uint32_t x = 0; x < w; ++x)
+        {
+            uint8_t g = (x <= 1 && y >= 5) ? 65 : 60;
+
+            test_check_px(&output[y * w + x], 100, g, 20);
+        }
+    }
+
+    aipl_video_free(raw);
+    aipl_video_free(output);
+}
+
+static void test_resize(void)
+{
+    /* Bilinear 2x upscale in x, quad centers in y */
+    static const uint8_t bilinear_r[2][8] = {
+        {  20,  25,  35,  45,  55,  65,  75,  80 },
+        { 120, 125, 135, 145, 155, 165, 175, 180 },
+    };
+    static const uint8_t bilinear_g[8] = {
+        31, 34, 39, 44, 49, 54, 59, 61
+    };
+    static const uint8_t bilinear_b[2][8] = {
+        { 200, 193, 178, 163, 148, 133, 118, 110 },
+        { 150, 143, 128, 113,  98,  83,  68,  60 },
+    };
+
+    uint8_t* raw = aipl_video_alloc(TEST_WIDTH * TEST_HEIGHT);
+    aipl_argb8888_px_t* output = aipl_video_alloc(8 * 2 * 4);
+
+    test_fill_gradient(raw);
+
+    /* Area 2x downscale of the 4x2 quads averages 2x2 quads */
+    memset(output, 0, 8 * 2 * 4);
+    AIPL_TEST_CHECK_EQ(aipl_demosaic_resize(raw, output, TEST_WIDTH,
+                                            TEST_WIDTH, TEST_HEIGHT,
+                                            AIPL_BAYER_RGGB,
+                                            AIPL_COLOR_ARGB8888, 2, 1,
+                                            AIPL_DEMOSAIC_SCALE_AREA),
+                       AIPL_ERR_OK);
+    test_check_px(&output[0], 80, 36, 160);
+    test_check_px(&output[1], 120, 56, 100);
+
+    /* Equal bilinear weights give the same averages */
+    memset(output, 0, 8 * 2 * 4);
+    AIPL_TEST_CHECK_EQ(aipl_demosaic_resize(raw, output, TEST_WIDTH,
+                                            TEST_WIDTH, TEST_HEIGHT,
+                                            AIPL_BAYER_RGGB,
+                                            AIPL_COLOR_ARGB8888, 2, 1,
+                                            AIPL_DEMOSAIC_SCALE_BILINEAR),
+                       AIPL_ERR_OK);
+    test_check_px(&output[0], 80, 36, 160);
+    test_check_px(&output[1], 120, 56, 100);
+
+    /* Quarter and three quarter weights, clamped at both ends */
+    memset(output, 0, 8 * 2 * 4);
+    AIPL_TEST_CHECK_EQ(aipl_demosaic_resize(raw, output, TEST_WIDTH,
+                                            TEST_WIDTH, TEST_HEIGHT,
+                                            AIPL_BAYER_RGGB,
+                                            AIPL_COLOR_ARGB8888, 8, 2,
+                                            AIPL_DEMOSAIC_SCALE_BILINEAR),
+                       AIPL_ERR_OK);
+
+    for (uint32_t y = 0; y < 2; ++y)
+    {
+        for (uint32_t x = 0; x < 8; ++x)
+        {
+            test_check_px(&output[y * 8 + x], bilinear_r[y][x],
+                          bilinear_g[x], bilinear_b[y][x]);
+        }
+    }
+
+    aipl_video_free(raw);
+    aipl_video_free(output);
+}
+
+static void test_roi(void)
+{
+    const uint32_t left = 1;
+    const uint32_t top = 1;
+    const uint32_t right = 6;
+    const uint32_t bottom = 3;
+    const uint32_t roi_w = right - left;
+    const uint32_t roi_h = bottom - top;
+
+    uint8_t* raw = aipl_video_alloc(TEST_RAW_SIZE);
+    aipl_argb8888_px_t* full = aipl_video_alloc(TEST_WIDTH * TEST_HEIGHT * 4);
+    aipl_argb8888_px_t* output = aipl_video_alloc(roi_w * roi_h * 4);
+
+    /* A flat frame stays flat, red and blue are not swapped */
+    test_fill_flat(raw, TEST_WIDTH, TEST_WIDTH, TEST_HEIGHT);
+
+    memset(output, 0, roi_w * roi_h * 4);
+    AIPL_TEST_CHECK_EQ(aipl_demosaic_roi(raw, output, TEST_WIDTH,
+                                         TEST_WIDTH, TEST_HEIGHT,
+                                         AIPL_BAYER_RGGB, AIPL_COLOR_ARGB8888,
+                                         left, top, right, bottom),
+                       AIPL_ERR_OK);
+
+    for (uint32_t i = 0; i < roi_w * roi_h; ++i)
+    {
+        test_check_px(&output[i], 100, 60, 20);
+    }
+
+    /*
+     * The first ROI pixel takes B of quad (0, 0), G1 of quad (0, 1),
+     * G2 of quad (1, 0) and R of quad (1, 1)
+     */
+    test_fill_gradient(raw);
+
+    memset(output, 0, roi_w * roi_h * 4);
+    AIPL_TEST_CHECK_EQ(aipl_demosaic_roi(raw, output, TEST_WIDTH,
+                                         TEST_WIDTH, TEST_HEIGHT,
+                                         AIPL_BAYER_RGGB, AIPL_COLOR_ARGB8888,
+                                         left, top, right, bottom),
+                       AIPL_ERR_OK);
+    test_check_px(&output[0], 140, 36, 200);
+
+    /* The rest matches the same region of the full frame */
+    AIPL_TEST_CHECK_EQ(aipl_demosaic(raw, full, TEST_WIDTH,
+                                     TEST_WIDTH, TEST_HEIGHT,
+                                     AIPL_BAYER_RGGB, AIPL_COLOR_ARGB8888),
+                       AIPL_ERR_OK);
+
+    for (uint32_t y = 0; y < roi_h; ++y)
+    {
+        if (memcmp(&output[y * roi_w], &full[(top + y) * TEST_WIDTH + left],
+                   roi_w * 4) != 0)
+        {
+            printf("ROI row %u differs from the full frame\n", (unsigned)y);
+            ++aipl_test_failures;
+        }
+    }
+
+    aipl_video_free(raw);
+    aipl_video_free(full);
+    aipl_video_free(output);
+}
+
+static void test_stats(void)
+{
+    /*
+     * Output green of each column and its luma, the last column takes
+     * the green samples of the quad past the image
+     */
+    static const uint8_t green[TEST_WIDTH] = {
+        60, 80, 100, 120, 140, 160, 180, 200
+    };
+    static const uint8_t luma[TEST_WIDTH] = {
+        68, 79, 91, 103, 114, 126, 138, 150
+    };
+    aipl_stats_cell_t cells[4];
+    uint32_t histogram[256];
+    aipl_demosaic_stats_t stats = {
+        .grid_width = 2,
+        .grid_height = 2,
+        .histogram_bins = 256,
+        .cells = cells,
+        .histogram = histogram,
+    };
+
+    uint8_t* raw = aipl_video_alloc(TEST_PITCH * TEST_HEIGHT);
+    aipl_argb8888_px_t* full = aipl_video_alloc(TEST_WIDTH * TEST_HEIGHT * 4);
+    aipl_argb8888_px_t* output = aipl_video_alloc(TEST_WIDTH * TEST_HEIGHT * 4);
+
+    /*
+     * Flat red and blue, green samples of quad column qx are 60 + 40 * qx.
+     * The pitch leaves room for one more quad column past the image
+     */
+    for (uint32_t qy = 0; qy < TEST_HEIGHT / 2; ++qy)
+    {
+        for (uint32_t qx = 0; qx < TEST_PITCH / 2; ++qx)
+        {
+            test_set_quad(raw, TEST_PITCH, qx, qy, 100, 60 + 40 * qx,
+                          60 + 40 * qx, 20);
+        }
+    }
+
+    AIPL_TEST_CHECK_EQ(aipl_demosaic_stats(raw, output, TEST_PITCH,
+                                           TEST_WIDTH, TEST_HEIGHT,
+                                           AIPL_BAYER_RGGB,
+                                           AIPL_COLOR_ARGB8888, &stats),
+                       AIPL_ERR_OK);
+
+    for (uint32_t y = 0; y < TEST_HEIGHT; ++y)
+    {
+        for (uint32_t x = 0; x < TEST_WIDTH; ++x)
+        {
+            test_check_px(&output[y * TEST_WIDTH + x], 100, green[x], 20);
+        }
+    }
+
+    /* The whole image, the last column included, matches aipl_demosaic() */
+    AIPL_TEST_CHECK_EQ(aipl_demosaic(raw, full, TEST_PITCH,
+                                     TEST_WIDTH, TEST_HEIGHT,
+                                     AIPL_BAYER_RGGB, AIPL_COLOR_ARGB8888),
+                       AIPL_ERR_OK);
+
+    for (uint32_t y = 0; y < TEST_HEIGHT; ++y)
+    {
+        if (memcmp(&output[y * TEST_WIDTH], &full[y * TEST_WIDTH],
+                   TEST_WIDTH * 4) != 0)
+        {
+            printf("statistics row %u differs from aipl_demosaic()\n",
+                   (unsigned)y);
+            ++aipl_test_failures;
+        }
+    }
+
+    /*
+     * Each cell is 4x2 pixels. The horizontal luma differences of a row
+     * are 11, 12, 12 in the left cell and 11, 12, 12, 12 in the right one
+     */
+    for (uint32_t c = 0; c < 4; ++c)
+    {
+        AIPL_TEST_CHECK_EQ(cells[c].sum_r, 800);
+        AIPL_TEST_CHECK_EQ(cells[c].sum_g, (c & 1) ? 1360 : 720);
+        AIPL_TEST_CHECK_EQ(cells[c].sum_b, 160);
+        AIPL_TEST_CHECK_EQ(cells[c].count, 8);
+        AIPL_TEST_CHECK_EQ(cells[c].sharpness, (c & 1) ? 94 : 70);
+    }
+
+    for (uint32_t i = 0; i < 256; ++i)
+    {
+        uint32_t count = 0;
+
+        for (uint32_t x = 0; x < TEST_WIDTH; ++x)
+        {
+            count += (luma[x] == i) ? TEST_HEIGHT : 0;
+        }
+        AIPL_TEST_CHECK_EQ(histogram[i], count);
+    }
+
+    /* 64 bins take the top 6 bits of luma */
+    stats.histogram_bins = 64;
+    AIPL_TEST_CHECK_EQ(aipl_demosaic_stats(raw, output, TEST_PITCH,
+                                           TEST_WIDTH, TEST_HEIGHT,
+                                           AIPL_BAYER_RGGB,
+                                           AIPL_COLOR_ARGB8888, &stats),
+                       AIPL_ERR_OK);
+    AIPL_TEST_CHECK_EQ(histogram[17], 4);
+    AIPL_TEST_CHECK_EQ(histogram[34], 4);
+    AIPL_TEST_CHECK_EQ(histogram[37], 4);
+    AIPL_TEST_CHECK_EQ(histogram[63], 0);
+
+    aipl_video_free(raw);
+    aipl_video_free(full);
+    aipl_video_free(output);
+}
+
+static void test_planar(void)
+{
+    static const uint32_t plane_pitch[3] = { 9, 12, 10 };
+    const uint32_t plane_size = TEST_WIDTH * TEST_HEIGHT;
+    const uint32_t size = (9 + 12 + 10) * TEST_HEIGHT;
+
+    uint8_t* raw = aipl_video_alloc(TEST_RAW_SIZE);
+    uint8_t* expected = aipl_video_alloc(plane_size * 3);
+    uint8_t* output = aipl_video_alloc(size);
+
+    aipl_test_fill(raw, TEST_RAW_SIZE, 3);
+
+    AIPL_TEST_CHECK_EQ(aipl_demosaic_rgb888p(raw, expected, TEST_WIDTH,
+                                             TEST_WIDTH, TEST_HEIGHT,
+                                             AIPL_BAYER_RGGB),
+                       AIPL_ERR_OK);
+
+    uint8_t* red = output;
+    uint8_t* green = red + plane_pitch[0] * TEST_HEIGHT;
+    uint8_t* blue = green + plane_pitch[1] * TEST_HEIGHT;
+
+    memset(output, 0, size);
+    AIPL_TEST_CHECK_EQ(aipl_demosaic_planar(raw, red, green, blue, TEST_WIDTH,
+                                            plane_pitch, TEST_WIDTH,
+                                            TEST_HEIGHT, AIPL_BAYER_RGGB),
+                       AIPL_ERR_OK);
+
+    for (uint32_t y = 0; y < TEST_HEIGHT; ++y)
+    {
+        const uint8_t* planes[3] = { red, green, blue };
+
+        for (uint32_t c = 0; c < 3; ++c)
+        {
+            if (memcmp(planes[c] + y * plane_pitch[c],
+                       expected + c * plane_size + y * TEST_WIDTH,
+                       TEST_WIDTH) != 0)
+            {
+                printf("plane %u row %u differs from RGB888P\n",
+                       (unsigned)c, (unsigned)y);
+                ++aipl_test_failures;
+            }
+        }
+    }
+
+    aipl_video_free(raw);
+    aipl_video_free(expected);
+    aipl_video_free(output);
+}
+
+static void test_corrected(void)
+{
+    /*
+     * Corrected samples of each column: red 84 * 1.5 and blue 16 * 2
+     * on even and odd columns, green 52 on both, all scaled by the
+     * grid gain (8 + x) / 8. The last column repeats the one before it
+     */
+    static const uint8_t red[TEST_WIDTH] = {
+        126, 158, 158, 189, 189, 221, 221, 221
+    };
+    static const uint8_t green[TEST_WIDTH] = {
+        55, 62, 68, 75, 81, 88, 94, 94
+    };
+    static const uint8_t blue[TEST_WIDTH] = {
+        36, 36, 44, 44, 52, 52, 60, 60
+    };
+    static const uint16_t channel_gains[4] = { 6144, 4096, 4096, 8192 };
+    static const uint16_t clip_gains[4] = { 4096, 3072, 3072, 6144 };
+
+    uint16_t grid[2][TEST_WIDTH][4];
+    aipl_raw_correction_t corr = {
+        .black_level = { 16, 8, 8, 4 },
+        .gains = &grid[0][0][0],
+        .grid_width = TEST_WIDTH,
+        .grid_height = 2,
+        .channel_gains = channel_gains,
+        .clip_highlights = false,
+    };
+
+    uint8_t* raw = aipl_video_alloc(TEST_RAW_SIZE);
+    aipl_argb8888_px_t* output = aipl_video_alloc(TEST_WIDTH * TEST_HEIGHT * 4);
+
+    /* Both grid rows are the same, so only the column position counts */
+    for (uint32_t y = 0; y < 2; ++y)
+    {
+        for (uint32_t x = 0; x < TEST_WIDTH; ++x)
+        {
+            for (uint32_t c = 0; c < 4; ++c)
+            {
+                grid[y][x][c] = 4096 + 512 * x;
+            }
+        }
+    }
+
+    test_fill_flat(raw, TEST_WIDTH, TEST_WIDTH, TEST_HEIGHT);
+
+    memset(output, 0, TEST_WIDTH * TEST_HEIGHT * 4);
+    AIPL_TEST_CHECK_EQ(aipl_demosaic_corrected(raw, output, TEST_WIDTH,
+                                               TEST_WIDTH, TEST_HEIGHT,
+                                               AIPL_BAYER_RGGB, &corr,
+                                               AIPL_COLOR_ARGB8888),
+                       AIPL_ERR_OK);
+
+    for (uint32_t y = 0; y < TEST_HEIGHT; ++y)
+    {
+        for (uint32_t x = 0; x < TEST_WIDTH; ++x)
+        {
+            test_check_px(&output[y * TEST_WIDTH + x],
+                          red[x], green[x], blue[x]);
+        }
+    }
+
+    /*
+     * Without a grid the green gain of 0.75 sets the highlight clip
+     * level to 191. Red 250 clips, green 250 becomes 188 and blue 20
+     * becomes 30 with its gain of 1.5
+     */
+    for (uint32_t qy = 0; qy < TEST_HEIGHT / 2; ++qy)
+    {
+        for (uint32_t qx = 0; qx < TEST_WIDTH / 2; ++qx)
+        {
+            test_set_quad(raw, TEST_WIDTH, qx, qy, 250, 250, 250, 20);
+        }
+    }
+
+    memset(corr.black_level, 0, sizeof(corr.black_level));
+    corr.gains = NULL;
+    corr.channel_gains = clip_gains;
+    corr.clip_highlights = true;
+
+    memset(output, 0, TEST_WIDTH * TEST_HEIGHT * 4);
+    AIPL_TEST_CHECK_EQ(aipl_demosaic_corrected(raw, output, TEST_WIDTH,
+                                               TEST_WIDTH, TEST_HEIGHT,
+                                               AIPL_BAYER_RGGB, &corr,
+                                               AIPL_COLOR_ARGB8888),
+                       AIPL_ERR_OK);
+
+    for (uint32_t i = 0; i < TEST_WIDTH * TEST_HEIGHT; ++i)
+    {
+        test_check_px(&output[i], 191, 188, 30);
+    }
+
+    aipl_video_free(raw);
+    aipl_video_free(output);
+}
@@ -0,0 +1,220 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/******************************************************************************
+ * @file    test_orient.c
+ * @brief   Orientation transform validation for all 8 EXIF orientations
+ *
+ * The default implementation is checked against a per-pixel reference.
+ * With D/AVE2D acceleration the texture mapping implementation is also
+ * checked against the default one, which covers the flip_u/flip_v
+ * handling of aipl_dave2d_texturing()
+ *
+******************************************************************************/
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <string.h>
+
+#include "aipl_cache.h"
+#include "aipl_config.h"
+#include "aipl_orient.h"
+#include "aipl_orient_default.h"
+#ifdef AIPL_DAVE2D_ACCELERATION
+#include "aipl_dave2d.h"
+#include "aipl_orient_dave2d.h"
+#endif
+#include "aipl_video_alloc.h"
+#include "aipl_test.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define TEST_WIDTH  37
+#define TEST_HEIGHT 23
+#define TEST_PITCH  40
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    uint32_t left;
+    uint32_t top;
+    uint32_t right;
+    uint32_t bottom;
+} test_rect_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void test_orient_reference(const uint8_t* input, uint8_t* output,
+                                  uint32_t bpp,
+                                  aipl_orientation_t orientation,
+                                  const test_rect_t* rect);
+
+static void test_orient_format(aipl_color_format_t format,
+                               const test_rect_t* rect);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const test_rect_t test_rects[] = {
+    { 0, 0, TEST_WIDTH, TEST_HEIGHT },
+    { 3, 5, 30, 16 },
+    { 1, 2, 2, 21 },
+};
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+int main(void)
+{
+#ifdef AIPL_DAVE2D_ACCELERATION
+    AIPL_TEST_CHECK(aipl_dave2d_init() == D2_OK);
+#endif
+
+    for (uint32_t r = 0; r < sizeof(test_rects) / sizeof(test_rects[0]); ++r)
+    {
+        test_orient_format(AIPL_COLOR_ARGB8888, &test_rects[r]);
+        test_orient_format(AIPL_COLOR_RGB565, &test_rects[r]);
+        test_orient_format(AIPL_COLOR_RGB888, &test_rects[r]);
+        test_orient_format(AIPL_COLOR_ALPHA8, &test_rects[r]);
+        test_orient_format(AIPL_COLOR_BGRA8888, &test_rects[r]);
+    }
+
+    return AIPL_TEST_RESULT("test_orient");
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static void test_orient_reference(const uint8_t* input, uint8_t* output,
+                                  uint32_t bpp,
+                                  aipl_orientation_t orientation,
+                                  const test_rect_t* rect)
+{
+    uint32_t w = rect->right - rect->left;
+    uint32_t h = rect->bottom - rect->top;
+    uint32_t out_w = aipl_orientation_is_transposed(orientation) ? h : w;
+
+    for (uint32_t y = 0; y < h; ++y)
+    {
+        for (uint32_t x = 0; x < w; ++x)
+        {
+            uint32_t ox;
+            uint32_t oy;
+
+            switch (orientation)
+            {
+                case AIPL_ORIENT_FLIP_H:
+                    ox = w - 1 - x;
+                    oy = y;
+                    break;
+                case AIPL_ORIENT_ROTATE_180:
+                    ox = w - 1 - x;
+                    oy = h - 1 - y;
+                    break;
+                case AIPL_ORIENT_FLIP_V:
+                    ox = x;
+                    oy = h - 1 - y;
+                    break;
+                case AIPL_ORIENT_TRANSPOSE:
+                    ox = y;
+                    oy = x;
+                    break;
+                case AIPL_ORIENT_ROTATE_90:
+                    ox = h - 1 - y;
+                    oy = x;
+                    break;
+                case AIPL_ORIENT_TRANSVERSE:
+                    ox = h - 1 - y;
+                    oy = w - 1 - x;
+                    break;
+                case AIPL_ORIENT_ROTATE_270:
+                    ox = y;
+                    oy = w - 1 - x;
+                    break;
+                default:
+                    ox = x;
+                    oy = y;
+                    break;
+            }
+
+            const uint8_t* src = input + ((rect->top + y) * TEST_PITCH
+                                          + rect->left + x) * bpp;
+            memcpy(output + (oy * out_w + ox) * bpp, src, bpp);
+        }
+    }
+}
+
+static void test_orient_format(aipl_color_format_t format,
+                               const test_rect_t* rect)
+{
+    uint32_t bpp = aipl_color_format_depth(format) / 8;
+    uint32_t size = (rect->right - rect->left) * (rect->bottom - rect->top)
+                    * bpp;
+
+    uint8_t* input = aipl_video_alloc(TEST_PITCH * TEST_HEIGHT * bpp);
+    uint8_t* expected = aipl_video_alloc(size);
+    uint8_t* output = aipl_video_alloc(size);
+
+    aipl_test_fill(input, TEST_PITCH * TEST_HEIGHT * bpp, format);
+
+    for (aipl_orientation_t o = AIPL_ORIENT_NORMAL;
+         o <= AIPL_ORIENT_ROTATE_270; ++o)
+    {
+        test_orient_reference(input, expected, bpp, o, rect);
+
+        memset(output, 0, size);
+        AIPL_TEST_CHECK_EQ(aipl_orient_default(input, output, TEST_PITCH,
+                                               TEST_WIDTH, TEST_HEIGHT,
+                                               format, o,
+                                               rect->left, rect->top,
+                                               rect->right, rect->bottom),
+                           AIPL_ERR_OK);
+        if (memcmp(output, expected, size) != 0)
+        {
+            printf("default %s orientation %d differs\n",
+                   aipl_color_format_str(format), o);
+            ++aipl_test_failures;
+        }
+
+#ifdef AIPL_DAVE2D_ACCELERATION
+        if (!aipl_dave2d_check_output_format(format))
+            continue;
+
+        memset(output, 0, size);
+        aipl_cpu_cache_clean(input, TEST_PITCH * TEST_HEIGHT * bpp);
+        aipl_cpu_cache_clean(output, size);
+        AIPL_TEST_CHECK_EQ(aipl_orient_dave2d(input, output, TEST_PITCH,
+                                              TEST_WIDTH, TEST_HEIGHT,
+                                              format, o,
+                                              rect->left, rect->top,
+                                              rect->right, rect->bottom),
+                           AIPL_ERR_OK);
+        aipl_cpu_cache_invalidate(output, size);
+        if (memcmp(output, expected, size) != 0)
+        {
+            printf("D/AVE2D %s orientation %d differs from default\n",
+                   aipl_color_format_str(format), o);
+            ++aipl_test_failures;
+        }
+#endif
+    }
+
+    aipl_video_free(input);
+    aipl_video_free(expected);
+    aipl_video_free(output);
+}
@@ -0,0 +1,159 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/******************************************************************************
+ * @file    test_tiled.c
+ * @brief   Tiled memory layout validation
+ *
+ * Images of partial tiles are converted to the tiled layout and back with
+ * different linear pitches on both sides, and flipped twice in the tiled
+ * layout. Operations without tile support must reject tiled images
+ *
+******************************************************************************/
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <string.h>
+
+#include "aipl_crop.h"
+#include "aipl_flip.h"
+#include "aipl_orient.h"
+#include "aipl_tiled.h"
+#include "aipl_warp_affine.h"
+#include "aipl_video_alloc.h"
+#include "aipl_test.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define TEST_WIDTH      11
+#define TEST_HEIGHT     9
+#define TEST_PITCH      13
+#define TEST_OUT_PITCH  12
+#define TEST_BPP        4
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void test_round_trip(void);
+
+static void test_reject(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+int main(void)
+{
+    test_round_trip();
+    test_reject();
+
+    return AIPL_TEST_RESULT("test_tiled");
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static void test_round_trip(void)
+{
+    const uint32_t tiled_size = 2 * 2 * AIPL_TILE_SIZE * AIPL_TILE_SIZE
+                                * TEST_BPP;
+
+    uint8_t* input = aipl_video_alloc(TEST_PITCH * TEST_HEIGHT * TEST_BPP);
+    uint8_t* tiled = aipl_video_alloc(tiled_size);
+    uint8_t* flipped = aipl_video_alloc(tiled_size);
+    uint8_t* output = aipl_video_alloc(TEST_OUT_PITCH * TEST_HEIGHT
+                                       * TEST_BPP);
+
+    aipl_test_fill(input, TEST_PITCH * TEST_HEIGHT * TEST_BPP, 5);
+
+    AIPL_TEST_CHECK_EQ(aipl_tiled_from_linear(input, tiled, TEST_PITCH,
+                                              TEST_WIDTH, TEST_HEIGHT,
+                                              AIPL_COLOR_ARGB8888),
+                       AIPL_ERR_OK);
+
+    /* Flipping twice restores the tiled image */
+    AIPL_TEST_CHECK_EQ(aipl_flip(tiled, flipped, TEST_WIDTH,
+                                 TEST_WIDTH, TEST_HEIGHT,
+                                 AIPL_COLOR_ARGB8888 | AIPL_COLOR_TILED,
+                                 true, true),
+                       AIPL_ERR_OK);
+    memset(tiled, 0, tiled_size);
+    AIPL_TEST_CHECK_EQ(aipl_flip(flipped, tiled, TEST_WIDTH,
+                                 TEST_WIDTH, TEST_HEIGHT,
+                                 AIPL_COLOR_ARGB8888 | AIPL_COLOR_TILED,
+                                 true, true),
+                       AIPL_ERR_OK);
+
+    memset(output, 0, TEST_OUT_PITCH * TEST_HEIGHT * TEST_BPP);
+    AIPL_TEST_CHECK_EQ(aipl_tiled_to_linear(tiled, output, TEST_OUT_PITCH,
+                                            TEST_WIDTH, TEST_HEIGHT,
+                                            AIPL_COLOR_ARGB8888),
+                       AIPL_ERR_OK);
+
+    for (uint32_t y = 0; y < TEST_HEIGHT; ++y)
+    {
+        if (memcmp(output + y * TEST_OUT_PITCH * TEST_BPP,
+                   input + y * TEST_PITCH * TEST_BPP,
+                   TEST_WIDTH * TEST_BPP) != 0)
+        {
+            printf("tiled round trip row %u differs\n", (unsigned)y);
+            ++aipl_test_failures;
+        }
+    }
+
+    aipl_video_free(input);
+    aipl_video_free(tiled);
+    aipl_video_free(flipped);
+    aipl_video_free(output);
+}
+
+static void test_reject(void)
+{
+    static const float identity[6] = { 1, 0, 0, 0, 1, 0 };
+    const aipl_color_format_t format = AIPL_COLOR_ARGB8888 | AIPL_COLOR_TILED;
+    const uint32_t size = AIPL_TILE_SIZE * AIPL_TILE_SIZE * TEST_BPP;
+
+    uint8_t* input = aipl_video_alloc(size);
+    uint8_t* output = aipl_video_alloc(size);
+
+    AIPL_TEST_CHECK(aipl_color_format_space(format) != AIPL_SPACE_RGB);
+    AIPL_TEST_CHECK_EQ(aipl_color_format_depth(format), 0);
+
+    AIPL_TEST_CHECK_EQ(aipl_crop(input, output, AIPL_TILE_SIZE,
+                                 AIPL_TILE_SIZE, AIPL_TILE_SIZE, format,
+                                 0, 0, 4, 4),
+                       AIPL_ERR_UNSUPPORTED_FORMAT);
+    AIPL_TEST_CHECK_EQ(aipl_orient(input, output, AIPL_TILE_SIZE,
+                                   AIPL_TILE_SIZE, AIPL_TILE_SIZE, format,
+                                   AIPL_ORIENT_ROTATE_90,
+                                   0, 0, AIPL_TILE_SIZE, AIPL_TILE_SIZE),
+                       AIPL_ERR_UNSUPPORTED_FORMAT);
+    AIPL_TEST_CHECK_EQ(aipl_warp_affine(input, output, AIPL_TILE_SIZE,
+                                        AIPL_TILE_SIZE, AIPL_TILE_SIZE,
+                                        format, AIPL_TILE_SIZE,
+                                        AIPL_TILE_SIZE, identity, false),
+                       AIPL_ERR_UNSUPPORTED_FORMAT);
+
+    aipl_video_free(input);
+    aipl_video_free(output);
+}
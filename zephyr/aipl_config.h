@@ -91,11 +91,13 @@
  #define TO_NV21         BIT(15)
  #define TO_YUY2         BIT(16)
  #define TO_UYVY         BIT(17)
+ #define TO_RGB888P      BIT(18)
  #define TO_ALL          (TO_ALPHA8_I400 | TO_ARGB8888 | TO_ARGB4444\
                           | TO_ARGB1555 | TO_RGBA8888 | TO_RGBA4444\
                           | TO_RGBA5551 | TO_BGR888 | TO_RGB888 | TO_RGB565\
                           | TO_YV12 | TO_I420 | TO_I422 | TO_I444\
-                          | TO_NV12 | TO_NV21 | TO_YUY2 | TO_UYVY)
+                          | TO_NV12 | TO_NV21 | TO_YUY2 | TO_UYVY\
+                          | TO_RGB888P)
 
  /**
   * Enable D/AVE2D acceleration
@@ -2364,6 +2366,41 @@
  #define AIPL_CONVERT_UYVY     0
  #endif
 
+ #define AIPL_CONVERT_RGB888P  0
+
+ /**
+  * Generic color conversion engine
+  *
+  * Options:
+  *  0 - only the conversions enabled above are available
+  *  1 - conversions not enabled above are done by the generic
+  *      engine that unpacks any format into an intermediate
+  *      block and packs it into any other format
+  *
+  * Disabled conversions are reached through aipl_color_convert(),
+  * their per pair functions are not built. With every conversion
+  * disabled above the engine takes about an eighth of the code size
+  * of all dedicated converters, at a fraction of their speed
+  */
+ #ifdef CONFIG_AIPL_CONVERT_GENERIC
+ #define AIPL_CONVERT_GENERIC  1
+ #else
+ #define AIPL_CONVERT_GENERIC  0
+ #endif
+
+ /**
+  * Number of significant bits of the Y16 samples, stored in the
+  * low bits of the 16-bit words. Used when Y16 is converted to and
+  * from other formats without an explicit shift
+  *
+  * Options: 10, 12 or 16
+  */
+ #ifdef CONFIG_AIPL_Y16_BITS
+ #define AIPL_Y16_BITS         CONFIG_AIPL_Y16_BITS
+ #else
+ #define AIPL_Y16_BITS         16
+ #endif
+
  #ifdef __cplusplus
  } /*extern "C"*/
  #endif